@@ -56,15 +56,15 @@ unsigned int Achievements::UpdateAchievementForPlayer(const char* achievementId,
     }
 
     const std::string uri = m_sessionManager->GetClientSettings()[GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_API_GATEWAY_BASE_URL] + "/" + achievementId + "/unlock";
-    const std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
-    if (idToken.empty())
+    const std::shared_ptr<const Authentication::SessionTokens> tokens = m_sessionManager->GetSessionTokens();
+    if (tokens->Tokens[(size_t)GameKit::TokenType::IdToken].empty())
     {
         Logging::Log(m_logCb, Level::Info, "Achievements::UpdateAchievementForPlayer() No ID token in session.");
         return GAMEKIT_ERROR_NO_ID_TOKEN;
     }
 
     const std::shared_ptr<Aws::Http::HttpRequest> request = Aws::Http::CreateHttpRequest(Aws::String(uri), Aws::Http::HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
-    request->SetAuthorization(Aws::String(idToken));
+    request->SetAuthorization(tokens->IdTokenAuthorization);
 
     Aws::Utils::Json::JsonValue body;
     body.WithInteger("increment_by", incrementBy);
@@ -90,8 +90,8 @@ unsigned int Achievements::GetAchievementForPlayer(const char* achievementId, co
     }
 
     const std::string uri = m_sessionManager->GetClientSettings()[GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_API_GATEWAY_BASE_URL] + "/" + achievementId;
-    const std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
-    if (idToken.empty())
+    const std::shared_ptr<const Authentication::SessionTokens> tokens = m_sessionManager->GetSessionTokens();
+    if (tokens->Tokens[(size_t)GameKit::TokenType::IdToken].empty())
     {
         Logging::Log(m_logCb, Level::Info, "Achievements::GetAchievementForPlayer() No ID token in session.");
         return GAMEKIT_ERROR_NO_ID_TOKEN;
@@ -105,7 +105,7 @@ unsigned int Achievements::GetAchievementForPlayer(const char* achievementId, co
     }
 
     const std::shared_ptr<Aws::Http::HttpRequest> request = Aws::Http::CreateHttpRequest(Aws::String(uri), Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
-    request->SetAuthorization(ToAwsString(idToken));
+    request->SetAuthorization(tokens->IdTokenAuthorization);
 
     // TODO set use_consistent_read as queryStringParam after it's added as a parameter for this.
 
@@ -122,8 +122,8 @@ unsigned int Achievements::ListAchievementsForPlayer(unsigned int pageSize, bool
     }
 
     const std::string uri = m_sessionManager->GetClientSettings()[GameKit::ClientSettings::Achievements::SETTINGS_ACHIEVEMENTS_API_GATEWAY_BASE_URL];
-    const std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
-    if (idToken.empty())
+    const std::shared_ptr<const Authentication::SessionTokens> tokens = m_sessionManager->GetSessionTokens();
+    if (tokens->Tokens[(size_t)GameKit::TokenType::IdToken].empty())
     {
         Logging::Log(m_logCb, Level::Info, "Achievements::ListAchievementsForPlayer() No ID token in session.");
         return GAMEKIT_ERROR_NO_ID_TOKEN;
@@ -136,7 +136,7 @@ unsigned int Achievements::ListAchievementsForPlayer(unsigned int pageSize, bool
     do
     {
         const std::shared_ptr<Aws::Http::HttpRequest> request = Aws::Http::CreateHttpRequest(Aws::String(uri), Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
-        request->SetAuthorization(ToAwsString(idToken));
+        request->SetAuthorization(tokens->IdTokenAuthorization);
 
         if (startKey != "")
         {
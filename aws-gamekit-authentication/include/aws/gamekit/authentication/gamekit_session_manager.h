@@ -4,8 +4,12 @@
 #pragma once
 // Standard Library
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <random>
 #include <string>
 
 // AWS SDK
@@ -58,13 +62,34 @@ namespace GameKit
     {
         static const int DEFAULT_REFRESH_SECONDS_BEFORE_EXPIRATION = 120;
         static const int MAX_REFRESH_RETRY_ATTEMPTS = 5;
+        static const int MAX_REFRESH_JITTER_SECONDS = 30;
+
+        /**
+         * @brief Immutable set of session tokens. A new snapshot is published each time a token changes, a snapshot that was read is never modified.
+        */
+        struct SessionTokens
+        {
+            std::array<std::string, (size_t)TokenType::TokenType_COUNT> Tokens; // Indexed by TokenType enum values
+
+            // Authorization header values built from the id token when it is published, so requests don't format them again
+            Aws::String IdTokenAuthorization; // The id token as it is
+            Aws::String BearerAuthorization; // "Bearer " followed by the id token
+
+            // Incremented with each published snapshot, the authorization header values may have changed when it differs
+            uint64_t Version = 0;
+        };
 
         class GAMEKIT_API GameKitSessionManager
         {
         private:
+            // Serializes writers only, readers load m_sessionTokens atomically without taking it
             std::mutex m_sessionTokensMutex;
-            std::array<std::string, (size_t)TokenType::TokenType_COUNT> m_sessionTokens; // Indexed by TokenType enum values
+            std::shared_ptr<const SessionTokens> m_sessionTokens;
             std::shared_ptr<Utils::Ticker> m_tokenRefresher;
+
+            // Counted by the token refresher and reset by SetSessionExpiration on the caller's thread, failed refreshes are retried by rescheduling the ticker rather than sleeping in it
+            std::atomic<unsigned int> m_refreshRetryAttempt{ 0 };
+            std::mt19937 m_refreshJitterEngine;
             FuncLogCallback m_logCb = nullptr;
             std::shared_ptr<std::map<std::string, std::string>> m_clientSettings;
             Aws::CognitoIdentityProvider::CognitoIdentityProviderClient* m_cognitoClient;
@@ -73,6 +98,12 @@ namespace GameKit
             void loadConfigFile(const std::string& clientConfigFile) const;
             void loadConfigContents(const std::string& clientConfigFileContents) const;
 
+            // Must be called with m_sessionTokensMutex held, publishes a copy of the current tokens with the given ones changed
+            void publishTokens(const std::map<TokenType, std::string>& changedTokens);
+
+            // Refresh before the token expires, earlier by a random jitter so clients that logged in together don't refresh in lockstep. Must be called with m_sessionTokensMutex held.
+            int nextRefreshInterval(int expirationInSeconds);
+
         protected:
             void executeTokenRefresh();
 
@@ -100,6 +131,20 @@ namespace GameKit
             */
             std::string GetToken(TokenType tokenType);
 
+            /**
+             * @brief Retrieves a snapshot of every token, without locking or copying them.
+             * The snapshot stays valid while it is held and is not affected by later token changes, such as a refresh.
+             * @return The current session tokens, never null.
+            */
+            std::shared_ptr<const SessionTokens> GetSessionTokens() const;
+
+            /**
+             * @brief Retrieves the version of the current session tokens, without locking.
+             * Clients that set the authorization header from GetSessionTokens() only need to set it again when this version changes.
+             * @return The version of the snapshot returned by GetSessionTokens().
+            */
+            uint64_t GetSessionTokensVersion() const;
+
             /**
              * @brief Deletes a token.
              * @param tokenType The type of token to delete.
@@ -17,8 +17,9 @@ namespace CognitoModel = Aws::CognitoIdentityProvider::Model;
 
 #pragma region Constructors/Destructor
 GameKitSessionManager::GameKitSessionManager(const std::string& clientConfigFile, FuncLogCallback logCallback)
-    :m_logCb(logCallback)
+    :m_refreshJitterEngine(std::random_device()()), m_logCb(logCallback)
 {
+    m_sessionTokens = std::make_shared<const SessionTokens>();
     m_awsClientsInitializedInternally = false;
     m_tokenRefresher = nullptr;
     m_cognitoClient = nullptr;
@@ -73,31 +74,39 @@ void GameKitSessionManager::InitializeDefaultAwsClients()
 void GameKitSessionManager::SetToken(TokenType tokenType, const std::string& value)
 {
     const std::lock_guard<std::mutex> lock(m_sessionTokensMutex);
-    m_sessionTokens[(size_t)tokenType] = value;
+    publishTokens({ { tokenType, value } });
 }
 
 std::string GameKitSessionManager::GetToken(TokenType tokenType)
 {
-    const std::lock_guard<std::mutex> lock(m_sessionTokensMutex);
-    return m_sessionTokens[(size_t)tokenType];
+    return GetSessionTokens()->Tokens[(size_t)tokenType];
+}
+
+std::shared_ptr<const SessionTokens> GameKitSessionManager::GetSessionTokens() const
+{
+    return std::atomic_load(&m_sessionTokens);
+}
+
+uint64_t GameKitSessionManager::GetSessionTokensVersion() const
+{
+    return GetSessionTokens()->Version;
 }
 
 void GameKitSessionManager::DeleteToken(TokenType tokenType)
 {
     const std::lock_guard<std::mutex> lock(m_sessionTokensMutex);
-    m_sessionTokens[(size_t)tokenType] = "";
+    publishTokens({ { tokenType, "" } });
 }
 
 void GameKitSessionManager::SetSessionExpiration(int expirationInSeconds)
 {
     const std::lock_guard<std::mutex> lock(m_sessionTokensMutex);
-    if (!m_sessionTokens[(size_t)TokenType::RefreshToken].empty())
+    if (!GetSessionTokens()->Tokens[(size_t)TokenType::RefreshToken].empty())
     {
-        // Execute refresh N minutes before token expires, or halfway to expiration if it is very soon
-        int interval = std::max<int>(expirationInSeconds - DEFAULT_REFRESH_SECONDS_BEFORE_EXPIRATION,
-            expirationInSeconds / 2);
+        const int interval = nextRefreshInterval(expirationInSeconds);
 
         m_tokenRefresher = Aws::MakeShared<Utils::TimestampTicker>("tokenRefresher", interval, std::bind(&GameKitSessionManager::executeTokenRefresh, this), m_logCb);
+        m_refreshRetryAttempt = 0;
 
         std::stringstream buffer;
         buffer << "GameKitSessionManager::SetSessionExpiration(): Next token refresh in " << interval << " seconds.";
@@ -188,10 +197,38 @@ void GameKitSessionManager::loadConfigContents(const std::string& clientConfigFi
     }
 }
 
+void GameKitSessionManager::publishTokens(const std::map<TokenType, std::string>& changedTokens)
+{
+    const std::shared_ptr<SessionTokens> tokens = std::make_shared<SessionTokens>(*GetSessionTokens());
+    for (const auto& changedToken : changedTokens)
+    {
+        tokens->Tokens[(size_t)changedToken.first] = changedToken.second;
+    }
+
+    if (changedTokens.count(TokenType::IdToken) > 0)
+    {
+        tokens->IdTokenAuthorization = ToAwsString(tokens->Tokens[(size_t)TokenType::IdToken]);
+        tokens->BearerAuthorization = "Bearer " + tokens->IdTokenAuthorization;
+    }
+
+    tokens->Version++;
+    std::atomic_store(&m_sessionTokens, std::shared_ptr<const SessionTokens>(tokens));
+}
+
+int GameKitSessionManager::nextRefreshInterval(int expirationInSeconds)
+{
+    // Execute refresh N minutes before token expires, or halfway to expiration if it is very soon
+    const int interval = std::max<int>(expirationInSeconds - DEFAULT_REFRESH_SECONDS_BEFORE_EXPIRATION, expirationInSeconds / 2);
+    const int maxJitter = std::max<int>(std::min<int>(MAX_REFRESH_JITTER_SECONDS, interval / 4), 0);
+
+    return interval - std::uniform_int_distribution<int>(0, maxJitter)(m_refreshJitterEngine);
+}
+
 void GameKitSessionManager::executeTokenRefresh()
 {
     Logger::Logging::Log(m_logCb, Logger::Level::Info, "GameKitSessionManager::executeTokenRefresh()");
-    if (GetToken(TokenType::RefreshToken).empty())
+    const std::shared_ptr<const SessionTokens> tokens = GetSessionTokens();
+    if (tokens->Tokens[(size_t)TokenType::RefreshToken].empty())
     {
         Logger::Logging::Log(m_logCb, Logger::Level::Info, "SessionManager::executeTokenRefresh: No refresh token present, stopping token refresh loop.");
         m_tokenRefresher->AbortLoop();
@@ -201,43 +238,45 @@ void GameKitSessionManager::executeTokenRefresh()
     auto request = CognitoModel::InitiateAuthRequest()
         .WithClientId(m_clientSettings->operator[](GameKit::ClientSettings::Authentication::SETTINGS_USER_POOL_CLIENT_ID).c_str())
         .WithAuthFlow(CognitoModel::AuthFlowType::REFRESH_TOKEN)
-        .AddAuthParameters("REFRESH_TOKEN", ToAwsString(GetToken(TokenType::RefreshToken)));
+        .AddAuthParameters("REFRESH_TOKEN", ToAwsString(tokens->Tokens[(size_t)TokenType::RefreshToken]));
 
-    auto outcome = m_cognitoClient->InitiateAuth(request);
-
-    unsigned int retryAttempt = 1;
-    while(!outcome.IsSuccess() && retryAttempt <= MAX_REFRESH_RETRY_ATTEMPTS)
+    const auto outcome = m_cognitoClient->InitiateAuth(request);
+    if (!outcome.IsSuccess())
     {
         auto error = outcome.GetError();
         auto errorMessage = "Error: SessionManager::executeTokenRefresh: " + error.GetExceptionName() + ": " + error.GetMessage();
         Logger::Logging::Log(m_logCb, Logger::Level::Error, errorMessage.c_str());
 
+        const unsigned int retryAttempt = ++m_refreshRetryAttempt;
+        if (retryAttempt > MAX_REFRESH_RETRY_ATTEMPTS)
+        {
+            Logger::Logging::Log(m_logCb, Logger::Level::Error, "Error: SessionManager::executeTokenRefresh: Failed, will no longer retry.");
+            m_tokenRefresher->AbortLoop();
+            return;
+        }
+
         const std::string retryMessage = "SessionManager::executeTokenRefresh: Retry attempt " + std::to_string(retryAttempt) + "/" + std::to_string(MAX_REFRESH_RETRY_ATTEMPTS);
         Logger::Logging::Log(m_logCb, Logger::Level::Info, retryMessage.c_str());
 
-        // This must be called within a thread from m_tokenRefresher so it doesn't block.
-        std::chrono::seconds sleepDuration{retryAttempt*retryAttempt};
-        std::this_thread::sleep_for(sleepDuration);
-
-        outcome = m_cognitoClient->InitiateAuth(request);
-        retryAttempt += 1;
-    }
-    if (!outcome.IsSuccess())
-    {
-        Logger::Logging::Log(m_logCb, Logger::Level::Error, "Error: SessionManager::executeTokenRefresh: Failed, will no longer retry.");
-        m_tokenRefresher->AbortLoop();
+        // The ticker waits for the retry instead of this thread, the current tokens stay in use until then since the refresh runs ahead of their expiration
+        m_tokenRefresher->RescheduleLoop(retryAttempt * retryAttempt);
         return;
     }
 
+    m_refreshRetryAttempt = 0;
+
     Aws::String accessToken = outcome.GetResult().GetAuthenticationResult().GetAccessToken();
     Aws::String idToken = outcome.GetResult().GetAuthenticationResult().GetIdToken();
     int expiresIn = outcome.GetResult().GetAuthenticationResult().GetExpiresIn();
 
-    SetToken(TokenType::AccessToken, ToStdString(accessToken));
-    SetToken(TokenType::IdToken, ToStdString(idToken));
+    int interval = 0;
+    {
+        // Both tokens are published in one snapshot, a reader never sees a new access token with an old id token
+        const std::lock_guard<std::mutex> lock(m_sessionTokensMutex);
+        publishTokens({ { TokenType::AccessToken, ToStdString(accessToken) }, { TokenType::IdToken, ToStdString(idToken) } });
+        interval = nextRefreshInterval(expiresIn);
+    }
 
-    // Execute refresh N minutes before token expires, or halfway to expiration if it is very soon
-    int interval = std::max<int>(expiresIn - DEFAULT_REFRESH_SECONDS_BEFORE_EXPIRATION, expiresIn / 2);
     std::stringstream buffer;
     buffer << "SessionManager::executeTokenRefresh: Next token refresh in " << interval << " seconds.";
     Logger::Logging::Log(m_logCb, Logger::Level::Info, buffer.str().c_str(), this);
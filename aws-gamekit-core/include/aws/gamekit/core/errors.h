@@ -105,6 +105,7 @@ namespace GameKit
     static const unsigned int GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_READ_FAILED = 0x010C07;
     static const unsigned int GAMEKIT_ERROR_USER_GAMEPLAY_DATA_UNPROCESSED_ITEMS = 0x010C08;
     static const unsigned int GAMEKIT_ERROR_USER_GAMEPLAY_DATA_PAYLOAD_TOO_LARGE = 0x010C09;
+    static const unsigned int GAMEKIT_WARNING_USER_GAMEPLAY_DATA_CACHED_VALUE = 0x010C0A;
 
     // Game Saving status codes (0x11000 - 0x113FF)
     static const unsigned int GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND = 0x11000;
@@ -0,0 +1,225 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <cstddef>
+#include <iostream>
+#include <streambuf>
+
+namespace GameKit
+{
+    namespace Utils
+    {
+        /**
+        * @brief Read-only stream buffer over memory owned by the caller.
+        *
+        * @details The buffer is read in place, nothing is copied. Seeking is supported for reading so the content can be
+        * read more than once, for example to hash it before it is sent. Writing always fails.
+        */
+        class BufferStreamBuf : public std::streambuf
+        {
+        public:
+            /**
+            * @brief Create a stream buffer over data. The memory must stay valid and unchanged while the buffer is used.
+            * @param data Start of the memory to read.
+            * @param size Number of bytes to read.
+            */
+            BufferStreamBuf(const void* data, size_t size)
+            {
+                char* begin = const_cast<char*>(static_cast<const char*>(data));
+                setg(begin, begin, begin + size);
+            }
+
+        protected:
+            pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override
+            {
+                off_type base = 0;
+                if (direction == std::ios_base::cur)
+                {
+                    base = gptr() - eback();
+                }
+                else if (direction == std::ios_base::end)
+                {
+                    base = egptr() - eback();
+                }
+
+                return seekpos(pos_type(base + offset), which);
+            }
+
+            pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+            {
+                const off_type offset = off_type(position);
+                if ((which & std::ios_base::in) == 0 || offset < 0 || offset > egptr() - eback())
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                setg(eback(), eback() + offset, egptr());
+                return position;
+            }
+        };
+
+        /**
+        * @brief Read-only stream over memory owned by the caller, see BufferStreamBuf.
+        *
+        * @details Can be used as the body of an HTTP request to send a buffer without copying it into a string stream first.
+        */
+        class BufferStream : public std::iostream
+        {
+        private:
+            BufferStreamBuf m_buffer;
+
+        public:
+            /**
+            * @brief Create a stream over data. The memory must stay valid and unchanged while the stream is used.
+            * @param data Start of the memory to read.
+            * @param size Number of bytes to read.
+            */
+            BufferStream(const void* data, size_t size) :
+                std::iostream(nullptr),
+                m_buffer(data, size)
+            {
+                rdbuf(&m_buffer);
+            }
+
+            BufferStream(const BufferStream&) = delete;
+            BufferStream& operator=(const BufferStream&) = delete;
+        };
+
+        /**
+        * @brief Stream buffer that writes into memory owned by the caller and reads back what was written.
+        *
+        * @details Writing stops at the end of the memory: the write that does not fit fails and HasOverflowed() becomes true.
+        * Seeking is supported for reading, within the bytes written so far.
+        */
+        class OutputBufferStreamBuf : public std::streambuf
+        {
+        private:
+            bool m_overflowed = false;
+
+        public:
+            /**
+            * @brief Create a stream buffer over data. The memory must stay valid while the buffer is used.
+            * @param data Start of the memory to write.
+            * @param capacity Number of bytes that can be written.
+            */
+            OutputBufferStreamBuf(void* data, size_t capacity)
+            {
+                char* begin = static_cast<char*>(data);
+                setp(begin, begin + capacity);
+                setg(begin, begin, begin);
+            }
+
+            /**
+            * @brief Number of bytes written.
+            */
+            size_t Size() const
+            {
+                return pptr() - pbase();
+            }
+
+            /**
+            * @brief Whether a write failed because the memory was full.
+            */
+            bool HasOverflowed() const
+            {
+                return m_overflowed;
+            }
+
+        protected:
+            int_type overflow(int_type ch) override
+            {
+                if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                {
+                    m_overflowed = true;
+                }
+
+                return traits_type::eof();
+            }
+
+            int_type underflow() override
+            {
+                // Bytes written since the last read become readable
+                if (gptr() < pptr())
+                {
+                    setg(eback(), gptr(), pptr());
+                    return traits_type::to_int_type(*gptr());
+                }
+
+                return traits_type::eof();
+            }
+
+            pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override
+            {
+                off_type base = 0;
+                if (direction == std::ios_base::cur)
+                {
+                    base = gptr() - eback();
+                }
+                else if (direction == std::ios_base::end)
+                {
+                    base = pptr() - pbase();
+                }
+
+                return seekpos(pos_type(base + offset), which);
+            }
+
+            pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+            {
+                const off_type offset = off_type(position);
+                if ((which & std::ios_base::out) != 0 || offset < 0 || offset > pptr() - pbase())
+                {
+                    return pos_type(off_type(-1));
+                }
+
+                setg(eback(), eback() + offset, pptr());
+                return position;
+            }
+        };
+
+        /**
+        * @brief Stream that writes into memory owned by the caller, see OutputBufferStreamBuf.
+        *
+        * @details Can be used as the response stream of an HTTP request to receive a body straight into a buffer instead of into a string stream.
+        */
+        class OutputBufferStream : public std::iostream
+        {
+        private:
+            OutputBufferStreamBuf m_buffer;
+
+        public:
+            /**
+            * @brief Create a stream over data. The memory must stay valid while the stream is used.
+            * @param data Start of the memory to write.
+            * @param capacity Number of bytes that can be written.
+            */
+            OutputBufferStream(void* data, size_t capacity) :
+                std::iostream(nullptr),
+                m_buffer(data, capacity)
+            {
+                rdbuf(&m_buffer);
+            }
+
+            OutputBufferStream(const OutputBufferStream&) = delete;
+            OutputBufferStream& operator=(const OutputBufferStream&) = delete;
+
+            /**
+            * @brief Number of bytes written.
+            */
+            size_t Size() const
+            {
+                return m_buffer.Size();
+            }
+
+            /**
+            * @brief Whether a write failed because the memory was full.
+            */
+            bool HasOverflowed() const
+            {
+                return m_buffer.HasOverflowed();
+            }
+        };
+    }
+}
@@ -0,0 +1,55 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// GameKit
+#include <aws/gamekit/core/api.h>
+
+#define COMPRESSION_DEFAULT_LEVEL 6
+#define COMPRESSION_STREAM_BUFFER_SIZE 16384
+
+namespace GameKit
+{
+    namespace Utils
+    {
+        /**
+        * @brief Deflate compression in the zlib format, backed by the miniz library that is also used by Zipper.
+        */
+        class GAMEKIT_API CompressionUtils
+        {
+        public:
+            /**
+            * @brief Compress a buffer.
+            *
+            * @param data Start of the buffer to compress.
+            * @param size Number of bytes to compress.
+            * @param outCompressed Receives the compressed bytes, replacing its content.
+            * @param level Compression level from 0 (no compression) to 9 (best compression).
+            * @returns True on success.
+            */
+            static bool Deflate(const void* data, size_t size, std::vector<uint8_t>& outCompressed, int level = COMPRESSION_DEFAULT_LEVEL);
+
+            /**
+            * @brief Decompress a stream into a buffer owned by the caller.
+            *
+            * @details The stream is read COMPRESSION_STREAM_BUFFER_SIZE bytes at a time and decompressed straight into outData,
+            * the compressed content is never held in memory as a whole. Bytes that follow the compressed data
+            * in the stream may be consumed as well. On failure the content of outData is unspecified.
+            *
+            * @param compressed Stream positioned at the start of the compressed bytes.
+            * @param outData Buffer that receives the decompressed bytes.
+            * @param capacity Size of outData in bytes.
+            * @param outSize Receives the number of decompressed bytes.
+            * @returns True on success, false if the stream is not valid compressed data or if the decompressed bytes do not fit in capacity.
+            */
+            static bool Inflate(std::istream& compressed, void* outData, size_t capacity, size_t& outSize);
+        };
+    }
+}
@@ -31,6 +31,7 @@ namespace GameKit
             void startNewInterval(int intervalSeconds) override;
             void countDownInterval(std::chrono::milliseconds sleepTime) override;
             bool isIntervalOver() const override;
+            std::chrono::milliseconds timeUntilIntervalEnd() const override;
 
         public:
             CountTicker(int interval, std::function<void()> tickFunc, FuncLogCallback logCb)
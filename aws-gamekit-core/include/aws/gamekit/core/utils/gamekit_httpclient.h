@@ -5,13 +5,23 @@
 
 // Standard Library
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 // AWS SDK
 #include <aws/core/http/HttpClient.h>
@@ -25,11 +35,18 @@
 #include <aws/gamekit/core/awsclients/default_clients.h>
 #include <aws/gamekit/core/utils/gamekit_httpclient_types.h>
 #include <aws/gamekit/core/utils/gamekit_httpclient_callbacks.h>
+#include <aws/gamekit/core/utils/gamekit_httpclient_journal.h>
 #include <aws/gamekit/core/utils/count_ticker.h>
+#include <aws/gamekit/core/utils/mpsc_ring_buffer.h>
 
 using namespace GameKit::Logger;
 
 #define OPERATION_ATTEMPTS_NO_LIMIT 0
+#define DEFAULT_MAX_CONCURRENT_REQUESTS 1
+
+// Queue files start with this value followed by the format version. Files written before the format was versioned start with the operation count.
+#define QUEUE_FILE_MAGIC 0x5154474B
+#define QUEUE_FILE_VERSION 2
 
 namespace GameKit
 {
@@ -42,32 +59,97 @@ namespace GameKit
             {
             private:
                 std::string m_clientName;
-                bool m_isConnectionOk;
+                std::atomic<bool> m_isConnectionOk;
                 size_t m_maxPendingQueueSize;
+                size_t m_maxConcurrentRequests;
                 unsigned int m_attempsCount;
                 unsigned int m_secondsInterval;
+                std::chrono::milliseconds m_operationTimeout;
                 GameKit::Utils::CountTicker m_requestPump;
                 bool m_abortProcessingRequested;
                 std::shared_ptr<Aws::Http::HttpClient> m_httpClient;
                 std::shared_ptr<IRetryStrategy> m_retryStrategy;
                 OperationQueue m_activeQueue; // this queue is only r/w in the background thread
                 OperationQueue m_pendingQueue; // this queue is always r/w under mutex
+                std::unordered_map<std::string, std::shared_ptr<IOperation>> m_pendingIndex; // newest pending operation per supersession key, r/w under the same mutex as the pending queue
+                MpscRingBuffer<std::shared_ptr<IOperation>> m_incomingQueue; // operations enqueued by callers, pushed without locking and drained into the pending queue under mutex
+                std::atomic<size_t> m_queuedOperationCount; // operations in the pending and active queues, published under m_queueProcessingMutex so callers can check the limit without locking
                 std::mutex m_queueProcessingMutex;
                 std::mutex m_requestMutex;
+                std::mutex m_connectionStateMutex; // guards the retry strategy and connection state transitions
+                std::mutex m_cacheProgressMutex; // guards the cached operations bookkeeping while the active queue is sent
+                std::vector<std::thread> m_requestWorkers; // started with the background thread, they send requests alongside it when m_maxConcurrentRequests is greater than 1
+                std::mutex m_requestWorkersMutex;
+                std::condition_variable m_requestWorkAvailableVar;
+                std::condition_variable m_requestWorkCompletedVar;
+                std::function<void()> m_requestWork; // r/w under m_requestWorkersMutex
+                uint64_t m_requestWorkGeneration; // incremented under m_requestWorkersMutex each time new work is handed to the workers
+                size_t m_busyRequestWorkers; // r/w under m_requestWorkersMutex
+                bool m_stopRequestWorkers; // r/w under m_requestWorkersMutex
                 NETWORK_STATE_RECEIVER_HANDLE m_stateReceiverHandle;
                 NetworkStatusChangeCallback m_statusCb;
                 CACHE_PROCESSED_RECEIVER_HANDLE m_cachedProcessedReceiverHandle;
                 CacheProcessedCallback m_cachedProcessedCb;
+                std::unique_ptr<OperationJournal> m_journal; // only replaced under m_queueProcessingMutex while the background thread is stopped
+
+                // Hand an operation over to the background thread. Operations already in the queues that are enqueued again for retry are never dropped by the limit.
+                bool enqueuePending(std::shared_ptr<IOperation> operation, bool isQueuedOperation = false);
+
+                // Publish the number of operations in the pending and active queues. The caller must hold m_queueProcessingMutex.
+                void publishQueuedOperationCount();
+
+                // Move operations enqueued by callers into the pending queue, in the order they were enqueued. The caller must hold m_queueProcessingMutex.
+                void drainIncomingQueue();
 
-                bool enqueuePending(std::shared_ptr<IOperation> operation);
+                // Append an operation to the pending queue and discard the pending operation it supersedes. The caller must hold m_queueProcessingMutex.
+                void pushPending(std::shared_ptr<IOperation> operation);
+
+                // Move the pending queue behind the operations left in the active queue, discarding the ones a pending operation supersedes.
+                // The caller must hold m_queueProcessingMutex.
+                void drainPendingQueue();
                 void preProcessQueue();
                 void processActiveQueue();
 
+                // Send the active queue one operation at a time. Returns true if every operation was sent successfully.
+                bool sendActiveQueueSequentially();
+
+                // Send the active queue with up to m_maxConcurrentRequests requests in flight. Operations that share an ordering key
+                // are sent in order, operations with an empty ordering key are sent alone. Returns true if every operation was sent successfully.
+                bool sendActiveQueueConcurrently();
+
+                // Start the request worker threads, m_maxConcurrentRequests - 1 of them since the background thread also sends requests.
+                void startRequestWorkers();
+
+                // Stop and join the request worker threads. The background thread must be stopped first.
+                void stopRequestWorkers();
+
+                void requestWorkerLoop(uint64_t lastGeneration);
+
+                // Run work on the background thread and on every request worker, and return once all of them returned.
+                void runOnRequestWorkers(const std::function<void()>& work);
+
+                // Send a single operation from the active queue and update the cached operations bookkeeping.
+                // Operations past their deadline at now, the time passed to isOperationDue(), are failed without sending them. Returns true on success or if the operation expired.
+                bool sendActiveOperation(std::shared_ptr<IOperation> operation, std::chrono::milliseconds now);
+
+                // Determine whether the background thread should send an operation now: its next attempt time has come and the retry strategy lets it through.
+                bool isOperationDue(const std::shared_ptr<IOperation>& operation, std::chrono::milliseconds now);
+
+                // Determine whether an operation has to wait for an earlier operation it is ordered after, given the ordering keys of the operations held back so far.
+                bool isOrderedAfterDeferred(const std::string& orderingKey, const std::set<std::string>& deferredKeys, bool deferredUnordered) const;
+
+                // Record in the journal that an operation left the queues, if journaling is enabled.
+                void journalRemove(std::shared_ptr<IOperation> operation);
+
+                // Deserialize the records of a versioned queue file, mapping the file in memory instead of reading it through a stream.
+                bool readMappedQueueFile(const std::string& file, const OperationDeserializer& deserializer, std::vector<std::shared_ptr<IOperation>>& outOperations) const;
+
             protected:
                 FuncLogCallback m_logCb = nullptr;
                 RequestModifier m_authorizationHeaderSetter;
+                AuthorizationVersionGetter m_authorizationVersionGetter;
                 bool m_stopProcessingOnError;
-                bool m_errorDuringProcessing;
+                std::atomic<bool> m_errorDuringProcessing;
 
                 size_t m_cachedOperationsRemaining = 0;
                 bool m_skipCacheProcessedCallback = false;
@@ -83,10 +165,23 @@ namespace GameKit
                 virtual bool shouldEnqueueWithUnhealthyConnection(const std::shared_ptr<IOperation> operation) const = 0;
 
                 // Logic to filter the internal queue before operations are processed.
+                // Operations superseded by a newer operation have already been discarded when the newer one was enqueued, and the queue is in the order operations were enqueued.
                 // Precondition: queue has items, filtered is empty.
-                // Postcondition: filtered has items to keep.
+                // Postcondition: filtered has items to keep. Operations that are not kept have Discard set, filtered may also hold new operations that replace them.
                 virtual void filterQueue(OperationQueue* queue, OperationQueue* filtered) = 0;
 
+                // Key used to order operations when the active queue is sent concurrently.
+                // Operations with the same key are always sent in the order they appear in the queue, operations with different keys may be sent in parallel.
+                // An empty key means the operation must be ordered against every other operation, which is the default.
+                virtual std::string getOrderingKey(const std::shared_ptr<IOperation> operation) const;
+
+                // Key used to find the pending operation a newly enqueued operation may supersede. Only the newest pending operation with the same key is considered.
+                // An empty key means the operation never supersedes and is never superseded, which is the default.
+                virtual const std::string& getSupersessionKey(const std::shared_ptr<IOperation>& operation) const;
+
+                // Determine whether a newer operation makes an older operation with the same supersession key unnecessary.
+                virtual bool supersedes(const std::shared_ptr<IOperation>& newer, const std::shared_ptr<IOperation>& older) const;
+
                 void removeCachedFromQueue(OperationQueue* queue, OperationQueue* filtered) const;
 
                 static bool isResponseCodeRetryable(Aws::Http::HttpResponseCode responseCode);
@@ -99,7 +194,10 @@ namespace GameKit
                 RequestResult makeOperationRequest(std::shared_ptr<IOperation> operation, bool isAsyncOperation, bool overrideConnectionStatus);
 
             public:
-                BaseHttpClient(const std::string& clientName, std::shared_ptr<Aws::Http::HttpClient> client, RequestModifier authSetter, unsigned int retryIntervalSeconds, std::shared_ptr<IRetryStrategy> retryStrategy, size_t maxPendingQueueSize, FuncLogCallback logCb);
+                // maxConcurrentRequests is the number of requests the background thread keeps in flight while flushing the queue. When set to 1 (default) requests are sent one at a time.
+                // When greater than 1, the background thread sends requests with a pool of maxConcurrentRequests - 1 worker threads, started and stopped with it.
+                // Success/failure callbacks of queued operations may then be invoked concurrently from different threads, and requests made by callers are not serialized with the queued ones.
+                BaseHttpClient(const std::string& clientName, std::shared_ptr<Aws::Http::HttpClient> client, RequestModifier authSetter, unsigned int retryIntervalSeconds, std::shared_ptr<IRetryStrategy> retryStrategy, size_t maxPendingQueueSize, FuncLogCallback logCb, size_t maxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS);
                 virtual ~BaseHttpClient();
 
                 void SetNetworkChangeCallback(NETWORK_STATE_RECEIVER_HANDLE receiverHandle, NetworkStatusChangeCallback statusChangeCallback);
@@ -113,6 +211,7 @@ namespace GameKit
 
                 // PersistQueue should be among the last methods to be called in a client. This is to ensure that all data that a player has in the queue has been saved to the cache.
                 // This method can only be called when the background thread is not running.
+                // Each operation is written as a record framed with its length and CRC, after a header holding QUEUE_FILE_MAGIC and QUEUE_FILE_VERSION.
                 // Example:
                 // client.StopRetryBackgroundThread();
                 // client.PersistQueue(myFile, serializer);
@@ -121,16 +220,39 @@ namespace GameKit
 
                 // LoadQueue should be among the first methods to be called in a client. This is to ensure the cache has been read into the queue so they can be processed for the player.
                 // This method can only be called when the background thread is not running.
+                // Versioned files are mapped in memory and each record is deserialized in place, files written before the format was versioned are still read as a stream.
                 // Example:
                 // client.StopRetryBackgroundThread();
                 // client.LoadQueue(myFile, deserializer);
                 // client.StartRetryBackgroundThread();
                 bool LoadQueue(const std::string& file, std::function<bool(std::istream&, std::shared_ptr<IOperation>&, FuncLogCallback)> deserializer, bool deleteFileAfterLoading = true);
 
+                // OpenJournal keeps an append-only journal of the queues in the given file, so enqueued operations survive a crash.
+                // Callers never write to the journal: the background thread appends the operations enqueued since its last tick with a single flush,
+                // so an operation enqueued less than one tick interval before a crash can be lost. Operations that are sent or discarded are recorded as removed.
+                // Operations left in the journal by a previous session are loaded into the queue, the same way LoadQueue does.
+                // This method can only be called when the background thread is not running.
+                // Example:
+                // client.OpenJournal(myJournalFile, serializer, deserializer);
+                // client.StartRetryBackgroundThread();
+                bool OpenJournal(const std::string& file, OperationSerializer serializer, OperationDeserializer deserializer);
+
+                // Stop journaling. Operations still in the queues stay in the journal file and are loaded by the next OpenJournal call.
+                // This method can only be called when the background thread is not running.
+                void CloseJournal();
+
                 // Helper to clear the offline cache from the queues, there is no need to clear the local file.
                 // LoadQueue moves all cached operations from the local file to the queue and clears the local file.
                 void DropAllCachedEvents();
 
+                // Time after which an operation fails instead of being retried, counted from the first time the client handles it. Zero, the default, means no deadline.
+                // Operations that already have a Deadline keep it. Call before starting the retry background thread.
+                void SetOperationTimeout(std::chrono::milliseconds timeout);
+
+                // When set, the authorization header of an operation is only set again by the header setter when the version changed since its previous attempt.
+                // Otherwise the header is set before every attempt. Call before starting the retry background thread.
+                void SetAuthorizationVersionGetter(AuthorizationVersionGetter versionGetter);
+
                 // Set the low level HTTP Client. Use only for testing.
                 void SetLowLevelHttpClient(std::shared_ptr<Aws::Http::HttpClient> client);
             };
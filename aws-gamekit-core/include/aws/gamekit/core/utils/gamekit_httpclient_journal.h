@@ -0,0 +1,85 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// GameKit
+#include <aws/gamekit/core/logging.h>
+#include <aws/gamekit/core/utils/gamekit_httpclient_types.h>
+
+using namespace GameKit::Logger;
+
+// Rewrite the journal when it holds this many records more than twice the number of live operations
+#define JOURNAL_COMPACTION_SLACK 64
+
+namespace GameKit
+{
+    namespace Utils
+    {
+        namespace HttpClient
+        {
+            typedef std::function<bool(std::ostream&, const std::shared_ptr<IOperation>, FuncLogCallback)> OperationSerializer;
+            typedef std::function<bool(std::istream&, std::shared_ptr<IOperation>&, FuncLogCallback)> OperationDeserializer;
+
+            // Append-only write-ahead log of the operations held in a BaseHttpClient queue.
+            // Every record is framed with its length and a CRC so a record torn by a crash is detected and ignored on replay.
+            // Enqueued operations are appended as the background thread picks them up, operations that leave the queue are recorded with a small removal record.
+            class GAMEKIT_API OperationJournal
+            {
+            private:
+                enum class RecordType : uint32_t
+                {
+                    Append = 0,
+                    Remove
+                };
+
+                std::string m_file;
+                std::ofstream m_outputFile;
+                OperationSerializer m_serializer;
+                OperationDeserializer m_deserializer;
+                FuncLogCallback m_logCb;
+                std::mutex m_journalMutex;
+                uint64_t m_nextSequence;
+                size_t m_recordCount;
+                size_t m_liveCount;
+
+                bool writeRecord(RecordType type, uint64_t sequence, const std::string& payload);
+                bool flushRecords();
+                bool rewrite(const std::vector<std::shared_ptr<IOperation>>& operations);
+
+            public:
+                OperationJournal(const std::string& file, OperationSerializer serializer, OperationDeserializer deserializer, FuncLogCallback logCb);
+                ~OperationJournal();
+
+                // Replay the journal file, return the operations that were not removed in the order they were appended, and compact the file.
+                // Replay stops at the first record that is incomplete or fails its CRC check.
+                bool Open(std::vector<std::shared_ptr<IOperation>>& outOperations);
+
+                // Append an operation. Operations that are already journaled are skipped.
+                bool Append(std::shared_ptr<IOperation> operation);
+
+                // Append several operations in order and flush them to disk once. Operations that are already journaled are skipped.
+                bool Append(const std::vector<std::shared_ptr<IOperation>>& operations);
+
+                // Record that an operation left the queue. Operations that are not journaled are skipped.
+                void Remove(std::shared_ptr<IOperation> operation);
+
+                // Drop every record, called when the queues are empty.
+                void Truncate();
+
+                // Rewrite the journal with only the given operations once enough removal records have accumulated.
+                void CompactIfNeeded(const OperationQueue& liveOperations);
+            };
+        }
+    }
+}
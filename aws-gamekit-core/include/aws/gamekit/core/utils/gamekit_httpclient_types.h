@@ -9,8 +9,12 @@
 #include <deque>
 #include <map>
 #include <chrono>
+#include <cstdint>
 #include <sstream>
 #include <iostream>
+#include <memory>
+#include <random>
+#include <unordered_map>
 
 // GameKit
 #include <aws/gamekit/core/errors.h>
@@ -30,6 +34,12 @@ using namespace GameKit::Logger;
 
 #define OPERATION_ATTEMPTS_NO_LIMIT 0
 
+#define RETRY_BUDGET_MAX_TOKENS 500
+#define RETRY_BUDGET_RETRY_COST 5
+#define RETRY_BUDGET_SUCCESS_REFILL 1
+#define RETRY_BUDGET_REFILL_PER_SECOND 1
+#define CIRCUIT_BREAKER_FAILURE_THRESHOLD 5
+
 namespace GameKit
 {
     namespace Utils
@@ -82,6 +92,18 @@ namespace GameKit
             GAMEKIT_API unsigned int GetCRC(const std::string& s);
 
             GAMEKIT_API unsigned int GetCRC(const char* s, size_t length);
+
+            // Write a record framed with its length and CRC, so a reader can detect records that are incomplete or corrupt.
+            GAMEKIT_API std::ostream& BinWriteRecord(std::ostream& os, const std::string& record);
+
+            // Read a record written with BinWriteRecord from memory, without copying it.
+            // On success outRecord points into data and offset is moved past the record.
+            // Returns false if the record is incomplete or its CRC does not match.
+            GAMEKIT_API bool TryReadRecord(const char* data, size_t size, size_t& offset, const char*& outRecord, size_t& outLength);
+
+            // Flag a stream that reads a record whose CRC was already verified, so deserializers can skip validating the content again.
+            GAMEKIT_API void SetRecordVerified(std::ios_base& stream, bool isVerified);
+            GAMEKIT_API bool IsRecordVerified(std::ios_base& stream);
         }
 
         namespace HttpClient
@@ -95,9 +117,15 @@ namespace GameKit
             // Callback to be called before sending a request. Used to update/modify request headers such as authorization.
             typedef std::function<void(std::shared_ptr<Aws::Http::HttpRequest>)> RequestModifier;
 
+            // Callback returning the version of the credentials the authorization header is built from, it must change whenever the header would change. 0 means unversioned.
+            typedef std::function<uint64_t()> AuthorizationVersionGetter;
+
             GAMEKIT_API bool TrySerializeRequestBinary(std::ostream& os, const std::shared_ptr<Aws::Http::HttpRequest> request, FuncLogCallback logCb = nullptr);
             GAMEKIT_API bool TryDeserializeRequestBinary(std::istream& is, std::shared_ptr<Aws::Http::HttpRequest>& outRequest, FuncLogCallback logCb = nullptr);
 
+            // Current time of the steady clock that operation timestamps, deadlines and next attempt times are measured with.
+            GAMEKIT_API std::chrono::milliseconds SteadyClockNow();
+
             // Base struct for retryable client operations
             struct GAMEKIT_API IOperation
             {
@@ -106,6 +134,13 @@ namespace GameKit
                 const unsigned int MaxAttempts;
                 bool Discard;
                 bool FromCache = false;
+                uint64_t JournalSequence = 0; // Sequence of the operation in the queue journal, 0 if not journaled
+                uint64_t AuthorizationVersion = 0; // Version of the authorization header the client last set on Request, 0 if it was never set. Not persisted.
+
+                // Retry scheduling, measured with SteadyClockNow(). These are not persisted, operations loaded from a file are due immediately and have no deadline.
+                std::chrono::milliseconds NextAttemptTime = std::chrono::milliseconds(0); // The background thread does not send the operation before this time, 0 if it is due
+                std::chrono::milliseconds Deadline = std::chrono::milliseconds(0); // The operation fails instead of being retried after this time, 0 for no deadline
+                std::chrono::milliseconds RetryDelay = std::chrono::milliseconds(0); // Delay the retry strategy chose before the current attempt
 
                 std::shared_ptr<Aws::Http::HttpRequest> Request;
                 const Aws::Http::HttpResponseCode ExpectedSuccessCode;
@@ -160,6 +195,16 @@ namespace GameKit
                 virtual void IncreaseThreshold() = 0;
                 virtual bool ShouldRetry() = 0;
                 virtual void Reset() = 0;
+
+                // Delay before an operation that failed with a retryable error is due again. The previous delay is in operation.RetryDelay.
+                virtual std::chrono::milliseconds GetRetryDelay(const IOperation& operation) { return std::chrono::milliseconds(0); };
+
+                // Called before the background thread sends a due operation. Returning false holds the operation back until a later pass.
+                virtual bool AcquireAttempt(const IOperation& operation) { return true; };
+
+                // Called after every request the background thread made for an operation it let through AcquireAttempt, requests made directly by callers are not recorded.
+                // isTransientFailure is true when the request failed with a retryable response code.
+                virtual void RecordAttempt(const IOperation& operation, bool isTransientFailure) { /* No-op by default */ };
             };
 
             // Constant Interval Strategy. With this strategy, operations are always retried in each interval.
@@ -182,6 +227,7 @@ namespace GameKit
                 unsigned int maxAttempts;
                 unsigned int currentStep;
                 unsigned int retryThreshold;
+                std::mt19937 randomEngine;
                 FuncLogCallback logCb = nullptr;
 
             public:
@@ -193,10 +239,99 @@ namespace GameKit
                 virtual void Reset() override;
             };
 
+            // Decorrelated Jitter Strategy. With this strategy, each operation waits a random delay between baseDelay and three times its previous delay, capped at maxDelay.
+            // Operations are scheduled independently, a failing operation does not hold back the others and clients that failed together don't retry in lockstep.
+            class GAMEKIT_API DecorrelatedJitterStrategy : public IRetryStrategy
+            {
+            private:
+                std::chrono::milliseconds baseDelay;
+                std::chrono::milliseconds maxDelay;
+                std::mt19937 randomEngine;
+                FuncLogCallback logCb = nullptr;
+
+            public:
+                DecorrelatedJitterStrategy(std::chrono::milliseconds baseDelay, std::chrono::milliseconds maxDelay, FuncLogCallback logCb = nullptr);
+                virtual ~DecorrelatedJitterStrategy();
+
+                virtual void IncreaseThreshold() override { /* No-op by design, delays are chosen per operation */ };
+                virtual bool ShouldRetry() override { /* Always true by design, operations that are not due are skipped */ return true; };
+                virtual void Reset() override { /* No-op by design */ };
+                virtual std::chrono::milliseconds GetRetryDelay(const IOperation& operation) override;
+            };
+
+            // Retry Budget Strategy. Wraps another strategy and limits retries with a token bucket.
+            // Each retry spends retryCost tokens, each request that does not fail transiently returns successRefill tokens and the bucket refills refillPerSecond tokens every second.
+            // While the bucket is empty operations that already failed are held back, so a struggling service is not flooded with retries.
+            class GAMEKIT_API RetryBudgetStrategy : public IRetryStrategy
+            {
+            private:
+                std::shared_ptr<IRetryStrategy> innerStrategy;
+                double maxTokens;
+                double retryCost;
+                double successRefill;
+                double refillPerSecond;
+                double tokens;
+                std::chrono::milliseconds lastRefill;
+                FuncLogCallback logCb = nullptr;
+
+                void refill();
+
+            public:
+                RetryBudgetStrategy(std::shared_ptr<IRetryStrategy> innerStrategy,
+                    unsigned int maxTokens = RETRY_BUDGET_MAX_TOKENS,
+                    unsigned int retryCost = RETRY_BUDGET_RETRY_COST,
+                    unsigned int successRefill = RETRY_BUDGET_SUCCESS_REFILL,
+                    unsigned int refillPerSecond = RETRY_BUDGET_REFILL_PER_SECOND,
+                    FuncLogCallback logCb = nullptr);
+                virtual ~RetryBudgetStrategy();
+
+                virtual void IncreaseThreshold() override;
+                virtual bool ShouldRetry() override;
+                virtual void Reset() override;
+                virtual std::chrono::milliseconds GetRetryDelay(const IOperation& operation) override;
+                virtual bool AcquireAttempt(const IOperation& operation) override;
+                virtual void RecordAttempt(const IOperation& operation, bool isTransientFailure) override;
+            };
+
+            // Circuit Breaker Strategy. Wraps another strategy and tracks transient failures per host.
+            // After failureThreshold consecutive failures the circuit for the host opens and its operations are held back for openDuration,
+            // then a single operation is let through and its outcome closes the circuit or opens it again. Operations for other hosts are not affected.
+            class GAMEKIT_API CircuitBreakerStrategy : public IRetryStrategy
+            {
+            private:
+                struct HostCircuit
+                {
+                    unsigned int ConsecutiveFailures = 0;
+                    std::chrono::milliseconds OpenUntil = std::chrono::milliseconds(0);
+                    bool TrialInFlight = false;
+                };
+
+                std::shared_ptr<IRetryStrategy> innerStrategy;
+                unsigned int failureThreshold;
+                std::chrono::milliseconds openDuration;
+                std::unordered_map<std::string, HostCircuit> circuits;
+                FuncLogCallback logCb = nullptr;
+
+            public:
+                CircuitBreakerStrategy(std::shared_ptr<IRetryStrategy> innerStrategy, std::chrono::milliseconds openDuration,
+                    unsigned int failureThreshold = CIRCUIT_BREAKER_FAILURE_THRESHOLD, FuncLogCallback logCb = nullptr);
+                virtual ~CircuitBreakerStrategy();
+
+                virtual void IncreaseThreshold() override;
+                virtual bool ShouldRetry() override;
+                virtual void Reset() override;
+                virtual std::chrono::milliseconds GetRetryDelay(const IOperation& operation) override;
+                virtual bool AcquireAttempt(const IOperation& operation) override;
+                virtual void RecordAttempt(const IOperation& operation, bool isTransientFailure) override;
+            };
+
             enum class StrategyType
             {
                 ExponentialBackoff = 0,
-                ConstantInterval
+                ConstantInterval,
+                DecorrelatedJitter,
+                RetryBudget, // Decorrelated jitter with a retry budget
+                CircuitBreaker // Decorrelated jitter with a retry budget and a circuit breaker per host
             };
         }
     }
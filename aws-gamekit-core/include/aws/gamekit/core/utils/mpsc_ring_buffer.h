@@ -0,0 +1,143 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace GameKit
+{
+    namespace Utils
+    {
+        /**
+        * @brief Bounded lock-free queue with many producers and a single consumer.
+        *
+        * @details Producers reserve room with an atomic counter before they claim a slot, so a push either succeeds without waiting on the consumer
+        * or fails immediately when the queue holds Capacity() elements. Each slot carries a sequence number that tells the consumer
+        * when the value in it has been published.
+        * Only one thread may call TryPop() at a time, callers serialize consumers themselves.
+        */
+        template <typename T>
+        class MpscRingBuffer
+        {
+        private:
+            struct Cell
+            {
+                std::atomic<size_t> Sequence;
+                T Value;
+            };
+
+            size_t m_capacity;
+            size_t m_mask;
+            std::unique_ptr<Cell[]> m_cells;
+            std::atomic<size_t> m_count;
+            alignas(64) std::atomic<size_t> m_tail; // next position claimed by a producer
+            alignas(64) size_t m_head; // next position read by the consumer
+
+            static size_t roundUpToPowerOfTwo(size_t value)
+            {
+                size_t result = 1;
+                while (result < value)
+                {
+                    result <<= 1;
+                }
+
+                return result;
+            }
+
+        public:
+            /**
+            * @brief Create a queue that holds at most capacity elements.
+            * @param capacity Maximum number of elements, at least 1.
+            */
+            explicit MpscRingBuffer(size_t capacity) :
+                m_capacity(capacity > 0 ? capacity : 1),
+                m_mask(roundUpToPowerOfTwo(m_capacity) - 1),
+                m_cells(new Cell[m_mask + 1]),
+                m_count(0),
+                m_tail(0),
+                m_head(0)
+            {
+                for (size_t i = 0; i <= m_mask; ++i)
+                {
+                    m_cells[i].Sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            MpscRingBuffer(const MpscRingBuffer&) = delete;
+            MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+
+            /**
+            * @brief Append an element. Safe to call from any number of threads.
+            * @return False if the queue is full, the element is not added.
+            */
+            bool TryPush(T value)
+            {
+                size_t count = m_count.load(std::memory_order_relaxed);
+                do
+                {
+                    if (count >= m_capacity)
+                    {
+                        return false;
+                    }
+                } while (!m_count.compare_exchange_weak(count, count + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+                const size_t position = m_tail.fetch_add(1, std::memory_order_relaxed);
+                Cell& cell = m_cells[position & m_mask];
+
+                // The reservation guarantees the element that used this cell has been popped, its cell may still be in the middle of being released
+                while (cell.Sequence.load(std::memory_order_acquire) != position)
+                {
+                    std::this_thread::yield();
+                }
+
+                cell.Value = std::move(value);
+                cell.Sequence.store(position + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            /**
+            * @brief Remove the oldest published element. Must only be called by one thread at a time.
+            * @return False if there is no published element to remove.
+            */
+            bool TryPop(T& outValue)
+            {
+                Cell& cell = m_cells[m_head & m_mask];
+                if (cell.Sequence.load(std::memory_order_acquire) != m_head + 1)
+                {
+                    return false;
+                }
+
+                outValue = std::move(cell.Value);
+                cell.Value = T();
+                cell.Sequence.store(m_head + m_mask + 1, std::memory_order_release);
+                m_head++;
+                m_count.fetch_sub(1, std::memory_order_release);
+
+                return true;
+            }
+
+            /**
+            * @brief Number of elements in the queue, including elements that are still being pushed.
+            */
+            size_t Size() const
+            {
+                return m_count.load(std::memory_order_acquire);
+            }
+
+            /**
+            * @brief Maximum number of elements in the queue.
+            */
+            size_t Capacity() const
+            {
+                return m_capacity;
+            }
+        };
+    }
+}
@@ -6,46 +6,50 @@
 // Standard Library
 #include <functional>
 #include <chrono>
+#include <condition_variable>
 #include <future>
 #include <cstdio>
+#include <mutex>
+#include <thread>
 
 // GameKit
 #include <aws/gamekit/core/api.h>
 #include <aws/gamekit/core/logging.h>
+#include <aws/gamekit/core/utils/timer_service.h>
 
 namespace GameKit
 {
     namespace Utils
     {
         /**
-        * @brief Utility class that calls a function in its own background thread at defined intervals.
+        * @brief Utility class that calls a function in a background thread at defined intervals.
+        *
+        * @details The tick function runs on an executor thread of the shared TimerService, so tickers do not own a thread each and a blocking tick does not delay other tickers.
         */
         class GAMEKIT_API Ticker
         {
         private:
-            static const int TICKER_PULSE = 250;
-
             std::mutex m_tickerMutex;
-            std::condition_variable m_completedVar;
             std::thread::id m_threadId;
-            std::thread m_funcThread;
+            TimerService::TimerId m_timerId;
             int m_interval = 0;
             std::function<void()> m_tickFunc;
             FuncLogCallback m_logCb;
             bool m_isRunning;
             bool m_aborted;
-            bool m_isCompleted;
             bool m_wasOnDestroyCalled;
 
+            bool onTimer(std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay);
+
         protected:
             /**
              * @brief This method must be called by derived types in their destructor.
              *
              * @details This method performs the destructor logic for this base class. It can't happen during the
-             * regular base class destructor (~Ticker()) because it calls Stop() which waits for the background thread
-             * to complete and causes an exception to be thrown. The exception happens because during the final loop
-             * of the background thread, the abstract method countDownInterval is called which no longer exists on
-             * the derived type (because the derived type's destructor has already been called).
+             * regular base class destructor (~Ticker()) because it calls Stop() which waits for a running tick
+             * to complete. A timer that fires while the base class destructor runs would call the abstract method
+             * countDownInterval which no longer exists on the derived type (because the derived type's destructor
+             * has already been called).
              */
             void OnDestroy();
 
@@ -57,11 +61,17 @@ namespace GameKit
 
             /**
              * @brief Count down the current interval.
-             * @param sleepTime The amount of time the background thread slept before calling this method.
+             * @param sleepTime The amount of time the ticker waited before calling this method.
              * This value does not include any time that passed while the device was sleeping or hibernating.
              */
             virtual void countDownInterval(std::chrono::milliseconds sleepTime) = 0;
 
+            /**
+             * @brief Get the time left until the current interval is over.
+             * @return The time the ticker should wait before the interval ends. Zero or negative if the interval is over.
+             */
+            virtual std::chrono::milliseconds timeUntilIntervalEnd() const = 0;
+
             /**
              * @brief Check if the interval is over.
              * @return Return true if the current interval is over, or false if still counting down.
@@ -83,10 +93,10 @@ namespace GameKit
             virtual ~Ticker();
 
             /**
-            * @brief Start the ticker loop in a background thread.
+            * @brief Start the ticker loop in the background.
             *
-            * @details Each ticker instance only supports one background thread running at a time.
-            * If Start() is called while the ticker is already running, a warning will be logged and no new thread will be started.
+            * @details Each ticker instance only supports one loop running at a time.
+            * If Start() is called while the ticker is already running, a warning will be logged and no new loop will be started.
             */
             void Start();
 
@@ -95,7 +105,7 @@ namespace GameKit
             *
             * @details The ticker can be restarted with a new interval by calling Start().
             *
-            * @details This method blocks until the background thread finishes terminating.
+            * @details Pending ticks are cancelled immediately. This method blocks until a tick function that is currently running returns.
             */
             void Stop();
 
@@ -110,7 +120,7 @@ namespace GameKit
             *
             * @details Once aborted, the ticker cannot be restarted with Start(). A new ticker must be created.
             *
-            * @details This method does not wait for the background thread to finish terminating before it returns.
+            * @details The loop ends once the tick function returns.
             */
             void AbortLoop();
 
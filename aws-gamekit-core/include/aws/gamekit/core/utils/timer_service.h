@@ -0,0 +1,148 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+// GameKit
+#include <aws/gamekit/core/api.h>
+
+namespace GameKit
+{
+    namespace Utils
+    {
+        /**
+        * @brief Process-wide scheduler that dispatches timer callbacks to a pool of executor threads.
+        *
+        * @details Timers are kept in a min-heap ordered by deadline. A single dispatcher thread sleeps until the earliest deadline
+        * and hands the due callback to an idle executor thread, starting a new executor if none is idle. The dispatcher never runs
+        * callbacks itself, so a callback that blocks (for example on a network request) does not delay the other timers.
+        * At most TIMER_SERVICE_MAX_EXECUTORS executors run at once, further due callbacks wait until one of them returns.
+        * Executors exit after being idle for TIMER_SERVICE_EXECUTOR_IDLE_SECONDS, so the number of threads follows the number of
+        * callbacks running at the same time rather than the number of timers.
+        * A timer callback never runs concurrently with itself. The dispatcher starts when the first timer is scheduled and exits once no timers are left.
+        *
+        * @details The instance is never destroyed so no thread is joined while the process exits or the library unloads. Call Shutdown() to stop the threads.
+        */
+        class GAMEKIT_API TimerService
+        {
+        public:
+            typedef uint64_t TimerId;
+
+            /**
+            * @brief Timer callback.
+            * @param sleepTime Time elapsed since the timer was scheduled, capped to the requested delay.
+            * This value does not include any time that passed while the device was sleeping or hibernating if the timer fired on its deadline.
+            * @param nextDelay Delay before the callback runs again.
+            * @return Return true to run the callback again after nextDelay, or false to remove the timer.
+            */
+            typedef std::function<bool(std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)> TimerCallback;
+
+            /**
+            * @brief Get the process-wide instance.
+            */
+            static TimerService& GetInstance();
+
+            /**
+            * @brief Schedule a callback to run after a delay.
+            * @param delay Delay before the first run.
+            * @param callback The function to call when the timer is due.
+            * @return Id of the new timer, used to reschedule or cancel it. Zero if the service is shutting down, the callback is then never called.
+            */
+            TimerId Schedule(std::chrono::milliseconds delay, TimerCallback callback);
+
+            /**
+            * @brief Move the deadline of a timer that is waiting to run. Has no effect if the timer is running or does not exist.
+            * @param timerId Id returned by Schedule().
+            * @param delay New delay, counted from now.
+            */
+            void Reschedule(TimerId timerId, std::chrono::milliseconds delay);
+
+            /**
+            * @brief Remove a timer.
+            *
+            * @details If the callback is running in another thread, this method blocks until it returns.
+            * If called from inside the callback, the timer is removed once the callback returns.
+            * @param timerId Id returned by Schedule().
+            */
+            void Cancel(TimerId timerId);
+
+            /**
+            * @brief Remove every timer and join the dispatcher and executor threads.
+            *
+            * @details Callbacks that are running are allowed to return first, callbacks that are not running are never called again.
+            * Must not be called from inside a timer callback. Timers can be scheduled again once this method returns.
+            */
+            void Shutdown();
+
+        private:
+            struct TimerEntry
+            {
+                TimerCallback Callback;
+                std::chrono::steady_clock::time_point ScheduledTime;
+                std::chrono::steady_clock::time_point Deadline;
+                std::chrono::milliseconds Delay;
+                uint64_t Generation = 0;
+                bool IsRunning = false; // set once the callback is handed to an executor
+                bool IsCancelled = false;
+                std::thread::id RunningThreadId;
+            };
+
+            struct HeapEntry
+            {
+                std::chrono::steady_clock::time_point Deadline;
+                TimerId Id;
+                uint64_t Generation;
+
+                bool operator>(const HeapEntry& other) const { return Deadline > other.Deadline; }
+            };
+
+            struct DispatchedCallback
+            {
+                TimerId Id;
+                TimerCallback Callback;
+                std::chrono::milliseconds SleepTime;
+            };
+
+            std::mutex m_mutex;
+            std::condition_variable m_deadlineChangedVar;
+            std::condition_variable m_callbackDispatchedVar;
+            std::condition_variable m_callbackCompletedVar;
+            std::map<TimerId, TimerEntry> m_timers;
+            std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> m_deadlines;
+            std::deque<DispatchedCallback> m_dispatched; // due callbacks waiting for an executor
+            std::thread m_dispatcher;
+            std::map<std::thread::id, std::thread> m_executors;
+            std::vector<std::thread::id> m_exitedExecutors; // executors that left their loop and still need to be joined
+            size_t m_idleExecutors = 0;
+            size_t m_executorCount = 0; // executors started and not exited, including one the dispatcher is starting
+            size_t m_runningCallbacks = 0;
+            TimerId m_nextTimerId = 1;
+            bool m_isDispatcherRunning = false;
+            bool m_isShuttingDown = false;
+
+            TimerService() {}
+            ~TimerService() {}
+            TimerService(const TimerService&) = delete;
+            TimerService& operator=(const TimerService&) = delete;
+
+            void pushDeadline(TimerId timerId, TimerEntry& timer, std::chrono::milliseconds delay);
+            bool isStale(const HeapEntry& entry) const;
+            bool dispatch(TimerId timerId);
+            void startExecutor(std::unique_lock<std::mutex>& lock);
+            void dispatcherLoop();
+            void executorLoop();
+        };
+    }
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 // Standard Library
+#include <algorithm>
 #include <chrono>
 #include <functional>
 
@@ -24,12 +25,15 @@ namespace GameKit
         class GAMEKIT_API TimestampTicker : public Ticker
         {
         private:
+            static const int MAX_SLEEP_TIME = 5000;
+
             std::chrono::time_point<std::chrono::steady_clock> m_intervalEndTime = std::chrono::time_point<std::chrono::steady_clock>();
 
         protected:
             void startNewInterval(int intervalSeconds) override;
             void countDownInterval(std::chrono::milliseconds sleepTime) override;
             bool isIntervalOver() const override;
+            std::chrono::milliseconds timeUntilIntervalEnd() const override;
 
         public:
             TimestampTicker(int interval, std::function<void()> tickFunc, FuncLogCallback logCb)
@@ -3,6 +3,7 @@
 
 // GameKit
 #include <aws/gamekit/core/awsclients/api_initializer.h>
+#include <aws/gamekit/core/utils/timer_service.h>
 
 // Aws
 #include <aws/core/Aws.h>
@@ -99,6 +100,9 @@ void GameKit::AwsApiInitializer::Shutdown(FuncLogCallback log, const void* calle
     if (m_count == 1 || (m_count > 1 && force))
     {
         message = "AwsApiInitializer::Shutdown(): Shutting down (count: " + std::to_string(m_count) + ", force: " + std::to_string(force) + ")";
+
+        // Stop the timer threads before the SDK goes away; background ticks may still be issuing requests.
+        GameKit::Utils::TimerService::GetInstance().Shutdown();
         Aws::ShutdownAPI(*m_awsSdkOptions);
 
         m_awsSdkOptions = nullptr;
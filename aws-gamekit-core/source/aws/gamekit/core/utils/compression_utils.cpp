@@ -0,0 +1,99 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// GameKit
+#include <aws/gamekit/core/utils/compression_utils.h>
+
+// Include single-file miniz library as header only, the implementation is compiled with zipper.cpp
+#define MINIZ_CUSTOM_FOPEN_FREOPEN_STAT
+#define MINIZ_NO_ZLIB_COMPATIBLE_NAMES
+#define MINIZ_HEADER_FILE_ONLY
+#include "../miniz.inc"
+#undef MINIZ_HEADER_FILE_ONLY
+
+using namespace GameKit::Utils;
+
+#pragma region Public Methods
+bool CompressionUtils::Deflate(const void* data, size_t size, std::vector<uint8_t>& outCompressed, int level)
+{
+    outCompressed.clear();
+
+    mz_stream stream{};
+    if (mz_deflateInit(&stream, level) != MZ_OK)
+    {
+        return false;
+    }
+
+    outCompressed.resize(mz_deflateBound(&stream, (mz_ulong)size));
+    stream.next_in = static_cast<const unsigned char*>(data);
+    stream.avail_in = (unsigned int)size;
+    stream.next_out = outCompressed.data();
+    stream.avail_out = (unsigned int)outCompressed.size();
+
+    const int status = mz_deflate(&stream, MZ_FINISH);
+    mz_deflateEnd(&stream);
+
+    if (status != MZ_STREAM_END)
+    {
+        outCompressed.clear();
+        return false;
+    }
+
+    outCompressed.resize(stream.total_out);
+    return true;
+}
+
+bool CompressionUtils::Inflate(std::istream& compressed, void* outData, size_t capacity, size_t& outSize)
+{
+    outSize = 0;
+
+    mz_stream stream{};
+    if (mz_inflateInit(&stream) != MZ_OK)
+    {
+        return false;
+    }
+
+    std::vector<char> input(COMPRESSION_STREAM_BUFFER_SIZE);
+    stream.next_out = static_cast<unsigned char*>(outData);
+    stream.avail_out = (unsigned int)capacity;
+
+    // Once outData is full, output goes to this byte instead: anything written to it means the data does not fit
+    unsigned char overflow = 0;
+
+    int status = MZ_OK;
+    while (status == MZ_OK && stream.total_out <= capacity)
+    {
+        if (stream.avail_out == 0)
+        {
+            stream.next_out = &overflow;
+            stream.avail_out = 1;
+        }
+
+        if (stream.avail_in == 0)
+        {
+            compressed.read(input.data(), (std::streamsize)input.size());
+            const std::streamsize read = compressed.gcount();
+            if (read <= 0)
+            {
+                // The stream ended before the compressed data did
+                break;
+            }
+
+            stream.next_in = reinterpret_cast<const unsigned char*>(input.data());
+            stream.avail_in = (unsigned int)read;
+        }
+
+        status = mz_inflate(&stream, MZ_NO_FLUSH);
+    }
+
+    mz_inflateEnd(&stream);
+
+    if (status != MZ_STREAM_END || stream.total_out > capacity)
+    {
+        return false;
+    }
+
+    outSize = stream.total_out;
+    return true;
+}
+#pragma endregion
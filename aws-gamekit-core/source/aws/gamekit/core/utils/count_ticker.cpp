@@ -25,4 +25,9 @@ bool CountTicker::isIntervalOver() const
 {
     return m_intervalTimeLeft.count() <= 0;
 }
+
+std::chrono::milliseconds CountTicker::timeUntilIntervalEnd() const
+{
+    return m_intervalTimeLeft;
+}
 #pragma endregion
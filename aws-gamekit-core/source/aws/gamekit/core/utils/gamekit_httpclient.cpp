@@ -5,10 +5,16 @@
 #include <resolv.h>
 #endif
 
+#include <cstring>
+
 #include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
 #include <aws/gamekit/core/utils/file_utils.h>
 #include <aws/gamekit/core/utils/gamekit_httpclient.h>
 
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/iostreams/stream.hpp>
+
 using namespace GameKit::Utils::HttpClient;
 using namespace GameKit::Utils;
 
@@ -20,7 +26,8 @@ BaseHttpClient::BaseHttpClient(
     unsigned int retryIntervalSeconds,
     std::shared_ptr<IRetryStrategy> retryStrategy,
     size_t maxPendingQueueSize,
-    FuncLogCallback logCb) :
+    FuncLogCallback logCb,
+    size_t maxConcurrentRequests) :
     m_clientName(clientName),
     m_httpClient(client),
     m_authorizationHeaderSetter(authSetter),
@@ -29,17 +36,24 @@ BaseHttpClient::BaseHttpClient(
     m_stopProcessingOnError(true),
     m_errorDuringProcessing(false),
     m_maxPendingQueueSize(maxPendingQueueSize),
+    m_maxConcurrentRequests(std::max<size_t>(maxConcurrentRequests, 1)),
     m_secondsInterval(retryIntervalSeconds),
+    m_operationTimeout(0),
     m_retryStrategy(retryStrategy),
     m_logCb(logCb),
     m_requestPump(m_secondsInterval, std::bind(&BaseHttpClient::preProcessQueue, this), logCb),
     m_abortProcessingRequested(false),
     m_activeQueue(),
     m_pendingQueue(),
+    m_incomingQueue(2 * (maxPendingQueueSize + 1)), // room for the operations the background thread enqueues again for retry, which are admitted past the limit
+    m_queuedOperationCount(0),
     m_stateReceiverHandle(nullptr),
     m_statusCb(nullptr),
     m_cachedProcessedReceiverHandle(nullptr),
-    m_cachedProcessedCb(nullptr)
+    m_cachedProcessedCb(nullptr),
+    m_requestWorkGeneration(0),
+    m_busyRequestWorkers(0),
+    m_stopRequestWorkers(false)
 {}
 
 BaseHttpClient::~BaseHttpClient()
@@ -47,6 +61,7 @@ BaseHttpClient::~BaseHttpClient()
     StopRetryBackgroundThread();
     std::lock_guard<std::mutex> lock(m_queueProcessingMutex);
     m_httpClient->DisableRequestProcessing();
+    drainIncomingQueue();
 
     if (!m_activeQueue.empty())
     {
@@ -77,9 +92,11 @@ void BaseHttpClient::StartRetryBackgroundThread()
 {
     if (!m_requestPump.IsRunning())
     {
-        std::string message = "Starting request pump thread with " + std::to_string(m_secondsInterval) + " seconds interval";
+        std::string message = "Starting request pump thread with " + std::to_string(m_secondsInterval) + " seconds interval and " +
+            std::to_string(m_maxConcurrentRequests) + " concurrent requests";
         Logging::Log(m_logCb, Level::Info, message.c_str());
         m_retryStrategy->Reset();
+        startRequestWorkers();
         m_requestPump.Start();
     }
 }
@@ -92,7 +109,12 @@ void BaseHttpClient::StopRetryBackgroundThread()
         Logging::Log(m_logCb, Level::Info, message.c_str());
         m_abortProcessingRequested = true;
         m_requestPump.Stop();
+        stopRequestWorkers();
         m_abortProcessingRequested = false;
+
+        // Journal the operations enqueued since the last tick
+        std::lock_guard<std::mutex> queueLock(m_queueProcessingMutex);
+        drainIncomingQueue();
     }
 }
 
@@ -111,8 +133,12 @@ bool BaseHttpClient::PersistQueue(const std::string& file, std::function<bool(st
     auto nativePath = GameKit::Utils::FileUtils::PathFromUtf8(file);
 
     std::lock_guard<std::mutex> requestLock(m_requestMutex);
+    std::lock_guard<std::mutex> queueLock(m_queueProcessingMutex);
+    drainIncomingQueue();
 
-    size_t operationCount = m_activeQueue.size() + m_pendingQueue.size();
+    // Pending operations superseded by a newer one are not persisted
+    size_t operationCount = m_activeQueue.size() + std::count_if(m_pendingQueue.begin(), m_pendingQueue.end(),
+        [](const std::shared_ptr<IOperation>& operation) { return !operation->Discard; });
     if (operationCount == 0)
     {
         Logging::Log(m_logCb, Level::Info, "Nothing to persist, queues are empty.");
@@ -127,31 +153,45 @@ bool BaseHttpClient::PersistQueue(const std::string& file, std::function<bool(st
         return false;
     }
 
-    std::lock_guard<std::mutex> queueLock(m_queueProcessingMutex);
     try
     {
         outputFile.exceptions(std::ostream::failbit | std::ostream::badbit); // throw on failure
 
+        GameKit::Utils::Serialization::BinWrite(outputFile, static_cast<uint32_t>(QUEUE_FILE_MAGIC));
+        GameKit::Utils::Serialization::BinWrite(outputFile, static_cast<uint32_t>(QUEUE_FILE_VERSION));
         GameKit::Utils::Serialization::BinWrite(outputFile, operationCount);
 
+        // Each operation is framed with its length and CRC so it can be read back without validating its content again
+        std::stringstream record;
         for (auto& operation : m_activeQueue)
         {
-            if (!serializer(outputFile, operation, m_logCb))
+            record.str(std::string());
+            if (!serializer(record, operation, m_logCb))
             {
                 Logging::Log(m_logCb, Level::Error, "Could not persist active queue.");
                 outputFile.close();
                 return false;
             }
+
+            GameKit::Utils::Serialization::BinWriteRecord(outputFile, record.str());
         }
 
         for (auto& operation : m_pendingQueue)
         {
-            if (!serializer(outputFile, operation, m_logCb))
+            if (operation->Discard)
+            {
+                continue;
+            }
+
+            record.str(std::string());
+            if (!serializer(record, operation, m_logCb))
             {
                 Logging::Log(m_logCb, Level::Error, "Could not persist pending queue.");
                 outputFile.close();
                 return false;
             }
+
+            GameKit::Utils::Serialization::BinWriteRecord(outputFile, record.str());
         }
 
         outputFile.close();
@@ -167,6 +207,14 @@ bool BaseHttpClient::PersistQueue(const std::string& file, std::function<bool(st
     {
         m_activeQueue.clear();
         m_pendingQueue.clear();
+        m_pendingIndex.clear();
+        publishQueuedOperationCount();
+
+        // The operations now live in the persisted file
+        if (m_journal)
+        {
+            m_journal->Truncate();
+        }
     }
 
     message = "Wrote " + std::to_string(operationCount) + " operations to: " + file;
@@ -212,24 +260,56 @@ bool BaseHttpClient::LoadQueue(const std::string& file, std::function<bool(std::
     {
         inputFile.exceptions(std::istream::failbit | std::istream::badbit); // throw on failure
 
-        GameKit::Utils::Serialization::BinRead(inputFile, operationCount);
+        std::vector<std::shared_ptr<IOperation>> operations;
+        uint32_t magic = 0;
+        GameKit::Utils::Serialization::BinRead(inputFile, magic);
 
-        std::lock_guard<std::mutex> queueLock(m_queueProcessingMutex);
-        for (size_t i = 0; i < operationCount; ++i)
+        if (magic == QUEUE_FILE_MAGIC)
         {
-            std::shared_ptr<IOperation> operation;
-            if (!deserializer(inputFile, operation, m_logCb))
+            inputFile.close();
+            if (!readMappedQueueFile(file, deserializer, operations))
             {
-                Logging::Log(m_logCb, Level::Error, "Could not deserialize queue.");
-                inputFile.close();
                 return false;
             }
+        }
+        else
+        {
+            // Files written before the format was versioned start with the operation count
+            inputFile.seekg(0);
+            GameKit::Utils::Serialization::BinRead(inputFile, operationCount);
+
+            for (size_t i = 0; i < operationCount; ++i)
+            {
+                std::shared_ptr<IOperation> operation;
+                if (!deserializer(inputFile, operation, m_logCb))
+                {
+                    Logging::Log(m_logCb, Level::Error, "Could not deserialize queue.");
+                    inputFile.close();
+                    return false;
+                }
+
+                operations.push_back(operation);
+            }
 
-            operation->FromCache = true;
-            m_pendingQueue.push_back(operation);
+            inputFile.close();
         }
 
-        inputFile.close();
+        operationCount = operations.size();
+
+        {
+            std::lock_guard<std::mutex> queueLock(m_queueProcessingMutex);
+            for (auto& operation : operations)
+            {
+                operation->FromCache = true;
+                pushPending(operation);
+            }
+            publishQueuedOperationCount();
+
+            if (m_journal)
+            {
+                m_journal->Append(operations);
+            }
+        }
 
         if (deleteFileAfterLoading)
         {
@@ -272,6 +352,96 @@ bool BaseHttpClient::LoadQueue(const std::string& file, std::function<bool(std::
     return true;
 }
 
+bool BaseHttpClient::OpenJournal(const std::string& file, OperationSerializer serializer, OperationDeserializer deserializer)
+{
+    std::string message = "Opening queue journal: " + file;
+    Logging::Log(m_logCb, Level::Info, message.c_str());
+
+    if (m_requestPump.IsRunning())
+    {
+        message = "Queue journal cannot be opened while request pump is running, stop the request pump first.";
+        Logging::Log(m_logCb, Level::Error, message.c_str());
+        return false;
+    }
+
+    std::lock_guard<std::mutex> requestLock(m_requestMutex);
+    std::lock_guard<std::mutex> queueLock(m_queueProcessingMutex);
+    drainIncomingQueue();
+
+    std::unique_ptr<OperationJournal> journal = std::make_unique<OperationJournal>(file, serializer, deserializer, m_logCb);
+    std::vector<std::shared_ptr<IOperation>> recovered;
+    if (!journal->Open(recovered))
+    {
+        message = "Could not open queue journal " + file;
+        Logging::Log(m_logCb, Level::Error, message.c_str());
+        return false;
+    }
+
+    // Operations still queued from a previous OpenJournal call on the same file are already in the journal
+    std::map<uint64_t, std::shared_ptr<IOperation>> queuedBySequence;
+    for (const auto& queue : { &m_activeQueue, &m_pendingQueue })
+    {
+        for (auto& operation : *queue)
+        {
+            if (operation->JournalSequence != 0)
+            {
+                queuedBySequence[operation->JournalSequence] = operation;
+            }
+        }
+    }
+
+    size_t recoveredCount = 0;
+    for (auto& operation : recovered)
+    {
+        auto queued = queuedBySequence.find(operation->JournalSequence);
+        if (queued != queuedBySequence.end())
+        {
+            queuedBySequence.erase(queued);
+            continue;
+        }
+
+        operation->FromCache = true;
+        pushPending(operation);
+        recoveredCount++;
+    }
+    publishQueuedOperationCount();
+
+    // Queued operations that are not in this journal yet
+    for (auto& operation : queuedBySequence)
+    {
+        operation.second->JournalSequence = 0;
+    }
+
+    std::vector<std::shared_ptr<IOperation>> queued(m_activeQueue.begin(), m_activeQueue.end());
+    queued.insert(queued.end(), m_pendingQueue.begin(), m_pendingQueue.end());
+    journal->Append(queued);
+
+    m_journal = std::move(journal);
+
+    message = "Recovered " + std::to_string(recoveredCount) + " operations from: " + file;
+    Logging::Log(m_logCb, Level::Info, message.c_str());
+
+    if (recoveredCount != 0)
+    {
+        m_cachedOperationsRemaining += recoveredCount;
+    }
+
+    return true;
+}
+
+void BaseHttpClient::CloseJournal()
+{
+    if (m_requestPump.IsRunning())
+    {
+        std::string message = "Queue journal cannot be closed while request pump is running, stop the request pump first.";
+        Logging::Log(m_logCb, Level::Error, message.c_str());
+        return;
+    }
+
+    std::lock_guard<std::mutex> queueLock(m_queueProcessingMutex);
+    m_journal.reset();
+}
+
 void BaseHttpClient::removeCachedFromQueue(OperationQueue* queue, OperationQueue* filtered) const
 {
     Logging::Log(m_logCb, Level::Verbose, "UserGameplayDataHttpClient::RemoveCachedFromQueue");
@@ -301,6 +471,34 @@ void BaseHttpClient::removeCachedFromQueue(OperationQueue* queue, OperationQueue
     Logging::Log(m_logCb, Level::Info, message.c_str());
 }
 
+std::string BaseHttpClient::getOrderingKey(const std::shared_ptr<IOperation> operation) const
+{
+    // By default every operation is ordered against every other operation
+    return std::string();
+}
+
+const std::string& BaseHttpClient::getSupersessionKey(const std::shared_ptr<IOperation>& operation) const
+{
+    // By default operations are never superseded
+    static const std::string noKey;
+    return noKey;
+}
+
+bool BaseHttpClient::supersedes(const std::shared_ptr<IOperation>& newer, const std::shared_ptr<IOperation>& older) const
+{
+    return false;
+}
+
+void BaseHttpClient::SetOperationTimeout(std::chrono::milliseconds timeout)
+{
+    m_operationTimeout = timeout;
+}
+
+void BaseHttpClient::SetAuthorizationVersionGetter(AuthorizationVersionGetter versionGetter)
+{
+    m_authorizationVersionGetter = versionGetter;
+}
+
 void BaseHttpClient::SetLowLevelHttpClient(std::shared_ptr<Aws::Http::HttpClient> client)
 {
     m_httpClient = client;
@@ -308,24 +506,123 @@ void BaseHttpClient::SetLowLevelHttpClient(std::shared_ptr<Aws::Http::HttpClient
 #pragma endregion
 
 #pragma region Private/Protected Methods
-bool BaseHttpClient::enqueuePending(std::shared_ptr<IOperation> operation)
+bool BaseHttpClient::enqueuePending(std::shared_ptr<IOperation> operation, bool isQueuedOperation)
 {
-    std::lock_guard<std::mutex> lock(m_queueProcessingMutex);
+    // Callers never wait on the background thread, the operation is handed over through the incoming queue
     if (!m_requestPump.IsRunning())
     {
         Logging::Log(m_logCb, Level::Warning, "Retry background thread is not running, request will not be enqueued.");
         return false;
     }
 
-    if (isPendingQueueBelowLimit())
+    // An operation enqueued again for retry is still counted in the queues it came from
+    if (!isQueuedOperation && !isPendingQueueBelowLimit())
     {
-        m_pendingQueue.push_back(operation);
-        std::string message = "Pending queue size: " + std::to_string(m_pendingQueue.size());
-        Logging::Log(m_logCb, Level::Verbose, message.c_str());
-        return true;
-    } // else, the request is dropped and an error has been logged
+        return false; // the request is dropped and an error has been logged
+    }
 
-    return false;
+    // The background thread journals the operation when it drains the incoming queue, callers never touch the journal file
+    if (!m_incomingQueue.TryPush(operation))
+    {
+        // Other callers filled the queue since the limit was checked
+        Logging::Log(m_logCb, Level::Error, "Size of internal pending queue is above limit. New requests will be dropped.");
+        return false;
+    }
+
+    std::string message = "Pending queue size: " + std::to_string(m_incomingQueue.Size());
+    Logging::Log(m_logCb, Level::Verbose, message.c_str());
+    return true;
+}
+
+void BaseHttpClient::drainIncomingQueue()
+{
+    std::vector<std::shared_ptr<IOperation>> incoming;
+    std::shared_ptr<IOperation> operation;
+    while (m_incomingQueue.TryPop(operation))
+    {
+        // Count the operation before it reaches the pending queue, so callers never miss it while it moves
+        m_queuedOperationCount++;
+        incoming.push_back(operation);
+    }
+
+    if (incoming.empty())
+    {
+        return;
+    }
+
+    // One flush for everything enqueued since the last drain, before any of it can be sent and removed from the journal
+    if (m_journal)
+    {
+        m_journal->Append(incoming);
+    }
+
+    for (auto& incomingOperation : incoming)
+    {
+        pushPending(incomingOperation);
+    }
+
+    publishQueuedOperationCount();
+}
+
+void BaseHttpClient::publishQueuedOperationCount()
+{
+    m_queuedOperationCount = m_pendingQueue.size() + m_activeQueue.size();
+}
+
+void BaseHttpClient::pushPending(std::shared_ptr<IOperation> operation)
+{
+    const std::string& key = getSupersessionKey(operation);
+    if (!key.empty())
+    {
+        std::shared_ptr<IOperation>& newest = m_pendingIndex[key];
+        if (newest == nullptr || operation->Timestamp >= newest->Timestamp)
+        {
+            if (newest != nullptr && supersedes(operation, newest))
+            {
+                // The superseded operation stays in the queue until it is drained, its journal record is removed then
+                newest->Discard = true;
+            }
+
+            newest = operation;
+        }
+        else if (supersedes(newest, operation))
+        {
+            // An operation enqueued again for retry can arrive after newer operations with the same key
+            operation->Discard = true;
+        }
+    }
+
+    m_pendingQueue.push_back(operation);
+}
+
+void BaseHttpClient::drainPendingQueue()
+{
+    // Operations left in the active queue were enqueued before the pending operations, except the ones enqueued again for retry
+    for (auto& operation : m_activeQueue)
+    {
+        const std::string& key = getSupersessionKey(operation);
+        if (key.empty())
+        {
+            continue;
+        }
+
+        auto newest = m_pendingIndex.find(key);
+        if (newest != m_pendingIndex.end() && newest->second->Timestamp >= operation->Timestamp && supersedes(newest->second, operation))
+        {
+            operation->Discard = true;
+        }
+    }
+
+    m_pendingQueue.insert(m_pendingQueue.begin(), m_activeQueue.begin(), m_activeQueue.end());
+    m_activeQueue.clear();
+    m_pendingIndex.clear();
+
+    // Operations enqueued again for retry land behind operations enqueued while they were being sent, only then is a sort needed
+    auto timestampCompare = [](const std::shared_ptr<IOperation>& lhs, const std::shared_ptr<IOperation>& rhs) { return lhs->Timestamp < rhs->Timestamp; };
+    if (!std::is_sorted(m_pendingQueue.begin(), m_pendingQueue.end(), timestampCompare))
+    {
+        std::stable_sort(m_pendingQueue.begin(), m_pendingQueue.end(), timestampCompare);
+    }
 }
 
 void BaseHttpClient::preProcessQueue()
@@ -335,6 +632,7 @@ void BaseHttpClient::preProcessQueue()
 
     {
         std::lock_guard<std::mutex> lock(m_queueProcessingMutex);
+        drainIncomingQueue();
 
         size_t activeCount = m_activeQueue.size();
         size_t pendingCount = m_pendingQueue.size();
@@ -352,10 +650,22 @@ void BaseHttpClient::preProcessQueue()
 
             m_errorDuringProcessing = false;
 
+            // Every journaled operation has been sent or discarded
+            if (m_journal)
+            {
+                m_journal->Truncate();
+            }
+
             return;
         }
 
-        if (!m_retryStrategy->ShouldRetry())
+        bool shouldRetry;
+        {
+            std::lock_guard<std::mutex> stateLock(m_connectionStateMutex);
+            shouldRetry = m_retryStrategy->ShouldRetry();
+        }
+
+        if (!shouldRetry)
         {
             Logging::Log(m_logCb, Level::Info, "Skipped processing operations due to retry strategy.");
             return;
@@ -364,13 +674,32 @@ void BaseHttpClient::preProcessQueue()
         std::string message = "Processing " + std::to_string(activeCount) + " operations in active queue, " + std::to_string(pendingCount) + " operations in pending queue";
         Logging::Log(m_logCb, Level::Info, message.c_str());
 
-        // Append operations from active to pending queue to preserve order
-        std::move(m_activeQueue.begin(), m_activeQueue.end(), std::back_inserter(m_pendingQueue));
-        m_activeQueue.clear();
+        // Put operations from active queue in front of pending queue to preserve order
+        drainPendingQueue();
 
         // Filter pending queue, using active queue as target.
         filterQueue(&m_pendingQueue, &m_activeQueue);
+
+        // Filtering may replace operations with new ones, journal those before the operations they replace are removed
+        if (m_journal)
+        {
+            m_journal->Append(std::vector<std::shared_ptr<IOperation>>(m_activeQueue.begin(), m_activeQueue.end()));
+        }
+
+        for (auto& operation : m_pendingQueue)
+        {
+            if (operation->Discard)
+            {
+                journalRemove(operation);
+            }
+        }
         m_pendingQueue.clear();
+        publishQueuedOperationCount();
+
+        if (m_journal)
+        {
+            m_journal->CompactIfNeeded(m_activeQueue);
+        }
     }
 
     // At this point we've determined that there are events to process in the active queue, 
@@ -384,75 +713,345 @@ void BaseHttpClient::processActiveQueue()
 
     std::string message = "Processing active queue with " + std::to_string(m_activeQueue.size()) + " items";
     Logging::Log(m_logCb, Level::Info, message.c_str());
-    bool overrideConnectionStatus = true;
 
-    do
+    bool allSent = m_maxConcurrentRequests > 1 ? sendActiveQueueConcurrently() : sendActiveQueueSequentially();
+
+    {
+        // The operations that were sent have left the active queue, the ones to retry are in the incoming queue
+        std::lock_guard<std::mutex> lock(m_queueProcessingMutex);
+        publishQueuedOperationCount();
+    }
+
+    if (allSent && !m_abortProcessingRequested)
+    {
+        // all items in the active queue were sent, let's flush the pending queue
+        // in case new items arrived while processing
+        Logging::Log(m_logCb, Level::Info, "All items sent, flushing remaining items");
+
+        preProcessQueue();
+    }
+    else
+    {
+        // not all items were sent, return and wait for next invocation
+        Logging::Log(m_logCb, Level::Warning, "Not all items in the queue were sent, items will be retried.");
+    }
+}
+
+bool BaseHttpClient::sendActiveQueueSequentially()
+{
+    // Operations that are not due stay in the queue, together with the operations ordered after them
+    OperationQueue deferred;
+    std::set<std::string> deferredKeys;
+    bool deferredUnordered = false;
+    bool succeeded = true;
+    const std::chrono::milliseconds now = SteadyClockNow();
+
+    while (succeeded && !m_activeQueue.empty() && !m_abortProcessingRequested)
     {
         auto operation = m_activeQueue.front();
         m_activeQueue.pop_front();
 
-        auto result = makeOperationRequest(operation, false, overrideConnectionStatus);
-
-        if (operation->FromCache)
+        const std::string key = getOrderingKey(operation);
+        if (isOrderedAfterDeferred(key, deferredKeys, deferredUnordered) || !isOperationDue(operation, now))
         {
-            if (result.ResultType == RequestResultType::RequestMadeSuccess)
+            deferred.push_back(operation);
+            if (key.empty())
             {
-                m_cachedOperationsRemaining--;
+                deferredUnordered = true;
             }
-            else if (!m_skipCacheProcessedCallback)
+            else
             {
-                notifyCachedOperationsProcessed(false);
-                m_skipCacheProcessedCallback = true;
+                deferredKeys.insert(key);
             }
 
-            if (m_cachedOperationsRemaining == 0)
+            continue;
+        }
+
+        succeeded = sendActiveOperation(operation, now);
+    }
+
+    m_activeQueue.insert(m_activeQueue.begin(), deferred.begin(), deferred.end());
+
+    return succeeded && m_activeQueue.empty();
+}
+
+bool BaseHttpClient::sendActiveQueueConcurrently()
+{
+    // Take the whole active queue as a batch. Operations that are not sent are put back in their original order.
+    std::vector<std::shared_ptr<IOperation>> batch(m_activeQueue.begin(), m_activeQueue.end());
+    m_activeQueue.clear();
+
+    // Use char instead of bool so each worker writes to its own element
+    std::vector<char> taken(batch.size(), 0);
+    bool succeeded = true;
+    size_t segmentStart = 0;
+    const std::chrono::milliseconds now = SteadyClockNow();
+
+    // Set when a lane holds back an operation that is not due, the operations after the next barrier have to wait for it
+    std::atomic<bool> laneDeferred(false);
+
+    while (succeeded && segmentStart < batch.size() && !m_abortProcessingRequested)
+    {
+        // Operations without ordering key are a barrier, send them alone
+        if (getOrderingKey(batch[segmentStart]).empty())
+        {
+            if (laneDeferred || !isOperationDue(batch[segmentStart], now))
             {
-                notifyCachedOperationsProcessed(true);
+                break;
             }
+
+            taken[segmentStart] = 1;
+            succeeded = sendActiveOperation(batch[segmentStart], now);
+            segmentStart++;
+            continue;
         }
 
-        if (result.ResultType == RequestResultType::RequestMadeSuccess)
+        // Group the operations up to the next barrier into lanes, each lane keeps the queue order of its operations
+        std::map<std::string, std::vector<size_t>> lanesByKey;
+        size_t segmentEnd = segmentStart;
+        for (; segmentEnd < batch.size(); ++segmentEnd)
         {
-            // Override connection state to keep processing items and flush the queue
-            Logging::Log(m_logCb, Level::Info, "Request succeeded, continue processing.");
-            overrideConnectionStatus = true;
+            std::string key = getOrderingKey(batch[segmentEnd]);
+            if (key.empty())
+            {
+                break;
+            }
+
+            lanesByKey[key].push_back(segmentEnd);
         }
-        else
+
+        std::vector<std::vector<size_t>> lanes;
+        lanes.reserve(lanesByKey.size());
+        for (auto& lane : lanesByKey)
         {
-            // Hit a failure, stop making requests. Operations will be retried in the next tick.
-            Logging::Log(m_logCb, Level::Warning, "Will stop making requests");
-            overrideConnectionStatus = false;
+            lanes.push_back(std::move(lane.second));
+        }
 
-#if defined(ANDROID) || defined(__ANDROID__)
-            // In Android, getaddrinfo() will keep failing even after the connection is restored 
-            // so we need to call res_init() to resolve hosts again.
-            std::lock_guard<std::mutex> requestLock(m_requestMutex);
-            Logging::Log(m_logCb, Level::Warning, "Calling res_init()");
-            res_init();
-#endif
-            // Rewind request content body buffer, otherwise requests will be invalid
-            if (operation->Request->HasContentType() || operation->Request->HasContentLength())
+        std::atomic<size_t> nextLane(0);
+        std::atomic<bool> laneFailed(false);
+        auto worker = [&]()
+        {
+            for (size_t lane = nextLane++; lane < lanes.size(); lane = nextLane++)
             {
-                operation->Request->GetContentBody()->clear();
-                operation->Request->GetContentBody()->seekg(0);
+                for (size_t position : lanes[lane])
+                {
+                    if (laneFailed || m_abortProcessingRequested)
+                    {
+                        return;
+                    }
+
+                    // The rest of the lane waits for an operation that is not due
+                    if (!isOperationDue(batch[position], now))
+                    {
+                        laneDeferred = true;
+                        break;
+                    }
+
+                    taken[position] = 1;
+                    if (!sendActiveOperation(batch[position], now))
+                    {
+                        // Hit a failure, other lanes stop after their request in flight completes
+                        laneFailed = true;
+                        return;
+                    }
+                }
             }
+        };
+
+        size_t workerCount = std::min(m_maxConcurrentRequests, lanes.size());
+        std::string message = "Sending " + std::to_string(segmentEnd - segmentStart) + " operations in " + std::to_string(lanes.size()) +
+            " lanes with " + std::to_string(workerCount) + " workers";
+        Logging::Log(m_logCb, Level::Verbose, message.c_str());
+
+        // Workers without a lane to take return right away
+        runOnRequestWorkers(worker);
+
+        succeeded = !laneFailed;
+        segmentStart = segmentEnd;
+    }
+
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+        if (!taken[i])
+        {
+            m_activeQueue.push_back(batch[i]);
         }
+    }
+
+    return succeeded && m_activeQueue.empty();
+}
 
-    } while (overrideConnectionStatus && !m_activeQueue.empty() && !m_abortProcessingRequested);
+void BaseHttpClient::startRequestWorkers()
+{
+    std::lock_guard<std::mutex> lock(m_requestWorkersMutex);
+    m_stopRequestWorkers = false;
 
-    if (overrideConnectionStatus && m_activeQueue.empty() && !m_abortProcessingRequested)
+    // The background thread is one of the m_maxConcurrentRequests senders
+    for (size_t i = 1; i < m_maxConcurrentRequests; ++i)
     {
-        // all items in the active queue were sent, let's flush the pending queue
-        // in case new items arrived while processing
-        Logging::Log(m_logCb, Level::Info, "All items sent, flushing remaining items");
+        m_requestWorkers.emplace_back(&BaseHttpClient::requestWorkerLoop, this, m_requestWorkGeneration);
+    }
+}
 
-        preProcessQueue();
+void BaseHttpClient::stopRequestWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_requestWorkersMutex);
+        m_stopRequestWorkers = true;
+    }
+    m_requestWorkAvailableVar.notify_all();
+
+    for (auto& workerThread : m_requestWorkers)
+    {
+        workerThread.join();
+    }
+
+    m_requestWorkers.clear();
+}
+
+void BaseHttpClient::requestWorkerLoop(uint64_t lastGeneration)
+{
+    std::unique_lock<std::mutex> lock(m_requestWorkersMutex);
+    while (true)
+    {
+        m_requestWorkAvailableVar.wait(lock, [&] { return m_stopRequestWorkers || m_requestWorkGeneration != lastGeneration; });
+        if (m_stopRequestWorkers)
+        {
+            return;
+        }
+
+        lastGeneration = m_requestWorkGeneration;
+        const std::function<void()> work = m_requestWork;
+
+        lock.unlock();
+        work();
+        lock.lock();
+
+        if (--m_busyRequestWorkers == 0)
+        {
+            m_requestWorkCompletedVar.notify_all();
+        }
+    }
+}
+
+void BaseHttpClient::runOnRequestWorkers(const std::function<void()>& work)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_requestWorkersMutex);
+        m_requestWork = work;
+        m_busyRequestWorkers = m_requestWorkers.size();
+        m_requestWorkGeneration++;
+    }
+    m_requestWorkAvailableVar.notify_all();
+
+    work();
+
+    std::unique_lock<std::mutex> lock(m_requestWorkersMutex);
+    m_requestWorkCompletedVar.wait(lock, [&] { return m_busyRequestWorkers == 0; });
+    m_requestWork = nullptr;
+}
+
+bool BaseHttpClient::sendActiveOperation(std::shared_ptr<IOperation> operation, std::chrono::milliseconds now)
+{
+    // Use the time isOperationDue() was given: an operation it let through AcquireAttempt is always sent, so its attempt is recorded
+    const bool expired = operation->Deadline.count() != 0 && now > operation->Deadline;
+    RequestResult result(RequestResultType::RequestMadeFailure, std::shared_ptr<Aws::Http::HttpResponse>());
+    if (expired)
+    {
+        std::string message = "Operation with timestamp " + std::to_string(operation->Timestamp.count()) + " passed its deadline after " +
+            std::to_string(operation->Attempts) + " attempts, failing it.";
+        Logging::Log(m_logCb, Level::Warning, message.c_str());
+
+        // No request was made for this attempt, the failure callback receives a null response
+        if (operation->FailureCallback != nullptr)
+        {
+            operation->FailureCallback(operation->CallbackContext, std::shared_ptr<Aws::Http::HttpResponse>());
+        }
     }
     else
     {
-        // not all items were sent, return and wait for next invocation
-        Logging::Log(m_logCb, Level::Warning, "Not all items in the queue were sent, items will be retried.");
+        result = makeOperationRequest(operation, false, true);
+    }
+
+    // Operations that were not enqueued again for retry have left the queues
+    if (result.ResultType != RequestResultType::RequestAttemptedAndEnqueued)
+    {
+        journalRemove(operation);
     }
+
+    if (operation->FromCache)
+    {
+        std::lock_guard<std::mutex> cacheLock(m_cacheProgressMutex);
+        if (result.ResultType == RequestResultType::RequestMadeSuccess)
+        {
+            m_cachedOperationsRemaining--;
+        }
+        else if (!m_skipCacheProcessedCallback)
+        {
+            notifyCachedOperationsProcessed(false);
+            m_skipCacheProcessedCallback = true;
+        }
+
+        if (m_cachedOperationsRemaining == 0)
+        {
+            notifyCachedOperationsProcessed(true);
+        }
+    }
+
+    if (expired)
+    {
+        // The operation failed without making a request, keep processing items
+        return true;
+    }
+
+    if (result.ResultType == RequestResultType::RequestMadeSuccess)
+    {
+        // Keep processing items and flush the queue
+        Logging::Log(m_logCb, Level::Info, "Request succeeded, continue processing.");
+        return true;
+    }
+
+    // Hit a failure, stop making requests. Operations will be retried in the next tick.
+    Logging::Log(m_logCb, Level::Warning, "Will stop making requests");
+
+#if defined(ANDROID) || defined(__ANDROID__)
+    // In Android, getaddrinfo() will keep failing even after the connection is restored 
+    // so we need to call res_init() to resolve hosts again.
+    std::lock_guard<std::mutex> requestLock(m_requestMutex);
+    Logging::Log(m_logCb, Level::Warning, "Calling res_init()");
+    res_init();
+#endif
+    // Rewind request content body buffer, otherwise requests will be invalid
+    if (operation->Request->HasContentType() || operation->Request->HasContentLength())
+    {
+        operation->Request->GetContentBody()->clear();
+        operation->Request->GetContentBody()->seekg(0);
+    }
+
+    return false;
+}
+
+bool BaseHttpClient::isOperationDue(const std::shared_ptr<IOperation>& operation, std::chrono::milliseconds now)
+{
+    // Operations past their deadline are due right away so they are failed, without asking the retry strategy
+    if (operation->Deadline.count() != 0 && now > operation->Deadline)
+    {
+        return true;
+    }
+
+    if (operation->NextAttemptTime > now)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> stateLock(m_connectionStateMutex);
+    return m_retryStrategy->AcquireAttempt(*operation);
+}
+
+bool BaseHttpClient::isOrderedAfterDeferred(const std::string& orderingKey, const std::set<std::string>& deferredKeys, bool deferredUnordered) const
+{
+    // An operation without ordering key is ordered after every other operation
+    return deferredUnordered || (orderingKey.empty() ? !deferredKeys.empty() : deferredKeys.count(orderingKey) != 0);
 }
 
 void BaseHttpClient::DropAllCachedEvents()
@@ -465,14 +1064,23 @@ void BaseHttpClient::DropAllCachedEvents()
     }
 
     std::lock_guard<std::mutex> lock(m_queueProcessingMutex);
+    drainIncomingQueue();
 
-    // append operations from active to pending queue
-    std::move(m_activeQueue.begin(), m_activeQueue.end(), std::back_inserter(m_pendingQueue));
-    m_activeQueue.clear();
+    // put operations from active queue in front of pending queue
+    drainPendingQueue();
 
     // Filter pending queue, using active as target queue.
     removeCachedFromQueue(&m_pendingQueue, &m_activeQueue);
+
+    for (auto& operation : m_pendingQueue)
+    {
+        if (operation->Discard)
+        {
+            journalRemove(operation);
+        }
+    }
     m_pendingQueue.clear();
+    publishQueuedOperationCount();
 
     // Pending queue should be empty by now and active queue should now have all non cached operations
     if (!m_pendingQueue.empty())
@@ -481,6 +1089,75 @@ void BaseHttpClient::DropAllCachedEvents()
     }
 }
 
+bool BaseHttpClient::readMappedQueueFile(const std::string& file, const OperationDeserializer& deserializer, std::vector<std::shared_ptr<IOperation>>& outOperations) const
+{
+    // Throws on failure, the caller logs the error
+    boost::iostreams::mapped_file_source mappedFile(FileUtils::PathFromUtf8(file));
+
+    const char* data = mappedFile.data();
+    const size_t size = mappedFile.size();
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    size_t operationCount = 0;
+    const size_t headerSize = sizeof(magic) + sizeof(version) + sizeof(operationCount);
+    if (size < headerSize)
+    {
+        Logging::Log(m_logCb, Level::Error, "Queue file header is incomplete.");
+        return false;
+    }
+
+    memcpy(&magic, data, sizeof(magic));
+    memcpy(&version, data + sizeof(magic), sizeof(version));
+    memcpy(&operationCount, data + sizeof(magic) + sizeof(version), sizeof(operationCount));
+
+    if (version > QUEUE_FILE_VERSION)
+    {
+        std::string message = "Queue file version " + std::to_string(version) + " is not supported.";
+        Logging::Log(m_logCb, Level::Error, message.c_str());
+        return false;
+    }
+
+    // Don't trust the count of a corrupt file for the allocation, every record takes at least its framing
+    const size_t recordFramingSize = sizeof(size_t) + sizeof(unsigned int);
+    outOperations.reserve(std::min(operationCount, (size - headerSize) / recordFramingSize));
+
+    size_t offset = headerSize;
+    for (size_t i = 0; i < operationCount; ++i)
+    {
+        const char* record = nullptr;
+        size_t recordLength = 0;
+        if (!GameKit::Utils::Serialization::TryReadRecord(data, size, offset, record, recordLength))
+        {
+            Logging::Log(m_logCb, Level::Error, "Could not deserialize queue, record is incomplete or corrupt.");
+            return false;
+        }
+
+        // The record is read in place from the mapped file, its CRC already matched so the content is not validated again
+        boost::iostreams::stream<boost::iostreams::array_source> recordStream(record, recordLength);
+        GameKit::Utils::Serialization::SetRecordVerified(recordStream, true);
+
+        std::shared_ptr<IOperation> operation;
+        if (!deserializer(recordStream, operation, m_logCb))
+        {
+            Logging::Log(m_logCb, Level::Error, "Could not deserialize queue.");
+            return false;
+        }
+
+        outOperations.push_back(operation);
+    }
+
+    return true;
+}
+
+void BaseHttpClient::journalRemove(std::shared_ptr<IOperation> operation)
+{
+    if (m_journal)
+    {
+        m_journal->Remove(operation);
+    }
+}
+
 void BaseHttpClient::notifyNetworkStateChange() const
 {
     if (m_statusCb != nullptr)
@@ -510,8 +1187,9 @@ bool BaseHttpClient::isResponseCodeRetryable(Aws::Http::HttpResponseCode respons
 
 bool BaseHttpClient::isPendingQueueBelowLimit() const
 {
-    // no need to lock, the mutex was locked by the caller
-    bool belowLimit = m_pendingQueue.size() <= m_maxPendingQueueSize;
+    // no need to lock, the incoming queue and the published count can be read from any thread.
+    // The pending queue has always accepted an operation while it held maxPendingQueueSize operations.
+    bool belowLimit = m_incomingQueue.Size() + m_queuedOperationCount <= m_maxPendingQueueSize;
 
     if (!belowLimit)
     {
@@ -525,7 +1203,11 @@ RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> o
 {
     Logging::Log(m_logCb, Level::Verbose, "MakeOperationRequest outgoing request");
 
-    m_authorizationHeaderSetter(operation->Request);
+    // The deadline counts from the first time the client handles the operation
+    if (operation->Deadline.count() == 0 && m_operationTimeout.count() > 0)
+    {
+        operation->Deadline = SteadyClockNow() + m_operationTimeout;
+    }
 
     // Operations set as Async are enqueued for later processing if the queue is running, otherwise they are
     // executed immediately.
@@ -544,22 +1226,40 @@ RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> o
         }
     }
 
+    // Only the background thread overrides the connection status, for operations it takes from the queues.
+    // Only those attempts went through IRetryStrategy::AcquireAttempt, so only their outcome is recorded: requests made by callers
+    // are never held back by a retry budget or an open circuit and don't count against them either.
+    const bool isQueuedOperation = overrideConnectionStatus;
+
     // If connection is healthy or the request pump is not running, make request immediately
     overrideConnectionStatus |= !m_requestPump.IsRunning();
     if ((m_isConnectionOk && !(m_stopProcessingOnError && m_errorDuringProcessing)) || overrideConnectionStatus)
     {
-        std::lock_guard<std::mutex> requestLock(m_requestMutex);
+        // With a single request in flight, requests are serialized with the background thread.
+        // Otherwise the background thread may have several requests in flight, and shared connection state is only updated under m_connectionStateMutex.
+        std::unique_lock<std::mutex> requestLock(m_requestMutex, std::defer_lock);
+        if (m_maxConcurrentRequests == 1)
+        {
+            requestLock.lock();
+        }
+
         operation->Attempts++;
 
-        // refresh authorization header and send request
+        // refresh authorization header if the credentials changed since the previous attempt, and send request
         if (m_authorizationHeaderSetter != nullptr)
         {
-            m_authorizationHeaderSetter(operation->Request);
+            const uint64_t authorizationVersion = m_authorizationVersionGetter != nullptr ? m_authorizationVersionGetter() : 0;
+            if (authorizationVersion == 0 || authorizationVersion != operation->AuthorizationVersion)
+            {
+                m_authorizationHeaderSetter(operation->Request);
+                operation->AuthorizationVersion = authorizationVersion;
+            }
         }
 
         auto requestStart = std::chrono::steady_clock::now();
 
-        auto response = m_httpClient->MakeRequest(operation->Request);
+        std::shared_ptr<Aws::Http::HttpClient> httpClient = m_httpClient;
+        auto response = httpClient->MakeRequest(operation->Request);
 
         auto requestEnd = std::chrono::steady_clock::now();
         auto latencyMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(requestEnd - requestStart).count();
@@ -574,7 +1274,14 @@ RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> o
             std::string message = "Request succeeded in attempt " + std::to_string(operation->Attempts);
             Logging::Log(m_logCb, Level::Verbose, message.c_str());
 
-            m_retryStrategy->Reset();
+            {
+                std::lock_guard<std::mutex> stateLock(m_connectionStateMutex);
+                m_retryStrategy->Reset();
+                if (isQueuedOperation)
+                {
+                    m_retryStrategy->RecordAttempt(*operation, false);
+                }
+            }
 
             if (operation->SuccessCallback != nullptr)
             {
@@ -588,19 +1295,40 @@ RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> o
             // Handle transient error and set network status
             std::string message = "Request failed, setting connection status to \"Unhealthy\".";
             Logging::Log(m_logCb, Level::Warning, message.c_str());
-            bool previousConnectionState = m_isConnectionOk;
-            m_isConnectionOk = !(response->GetResponseCode() == Aws::Http::HttpResponseCode::REQUEST_NOT_MADE);
-            m_errorDuringProcessing = response->GetResponseCode() != Aws::Http::HttpResponseCode::REQUEST_NOT_MADE;
-
-            if (previousConnectionState != m_isConnectionOk)
             {
-                notifyNetworkStateChange();
+                std::lock_guard<std::mutex> stateLock(m_connectionStateMutex);
+                bool previousConnectionState = m_isConnectionOk;
+                m_isConnectionOk = !(response->GetResponseCode() == Aws::Http::HttpResponseCode::REQUEST_NOT_MADE);
+                m_errorDuringProcessing = response->GetResponseCode() != Aws::Http::HttpResponseCode::REQUEST_NOT_MADE;
+
+                if (previousConnectionState != m_isConnectionOk)
+                {
+                    notifyNetworkStateChange();
+                }
+
+                m_retryStrategy->IncreaseThreshold();
+                if (isQueuedOperation)
+                {
+                    m_retryStrategy->RecordAttempt(*operation, true);
+                }
+                operation->RetryDelay = m_retryStrategy->GetRetryDelay(*operation);
             }
 
-            m_retryStrategy->IncreaseThreshold();
+            operation->NextAttemptTime = SteadyClockNow() + operation->RetryDelay;
+            if (operation->Deadline.count() != 0 && operation->NextAttemptTime > operation->Deadline)
+            {
+                Logging::Log(m_logCb, Level::Warning, "Operation would be retried after its deadline, failing it.");
+
+                if (operation->FailureCallback != nullptr)
+                {
+                    operation->FailureCallback(operation->CallbackContext, response);
+                }
+
+                return RequestResult(RequestResultType::RequestMadeFailure, response);
+            }
 
             // Enqueue
-            if (enqueuePending(operation))
+            if (enqueuePending(operation, isQueuedOperation))
             {
                 Logging::Log(m_logCb, Level::Warning, "Added request to retry queue.");
                 return RequestResult(RequestResultType::RequestAttemptedAndEnqueued, response);
@@ -615,6 +1343,12 @@ RequestResult BaseHttpClient::makeOperationRequest(std::shared_ptr<IOperation> o
             // Handle permanent error
             Logging::Log(m_logCb, Level::Warning, "Not retryable request failed.");
 
+            if (isQueuedOperation)
+            {
+                std::lock_guard<std::mutex> stateLock(m_connectionStateMutex);
+                m_retryStrategy->RecordAttempt(*operation, isResponseCodeRetryable(response->GetResponseCode()));
+            }
+
             // Request failed and is not retryable, return failure
             if (operation->FailureCallback != nullptr)
             {
@@ -0,0 +1,385 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <map>
+#include <sstream>
+
+// GameKit
+#include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
+#include <aws/gamekit/core/utils/file_utils.h>
+#include <aws/gamekit/core/utils/gamekit_httpclient_journal.h>
+
+using namespace GameKit::Utils;
+using namespace GameKit::Utils::HttpClient;
+using namespace GameKit::Utils::Serialization;
+
+#pragma region Constructors/Destructor
+OperationJournal::OperationJournal(const std::string& file, OperationSerializer serializer, OperationDeserializer deserializer, FuncLogCallback logCb) :
+    m_file(file),
+    m_serializer(serializer),
+    m_deserializer(deserializer),
+    m_logCb(logCb),
+    m_nextSequence(1),
+    m_recordCount(0),
+    m_liveCount(0)
+{}
+
+OperationJournal::~OperationJournal()
+{
+    std::lock_guard<std::mutex> lock(m_journalMutex);
+    if (m_outputFile.is_open())
+    {
+        m_outputFile.close();
+    }
+}
+#pragma endregion
+
+#pragma region Public Methods
+bool OperationJournal::Open(std::vector<std::shared_ptr<IOperation>>& outOperations)
+{
+    std::lock_guard<std::mutex> lock(m_journalMutex);
+
+    std::string message = "Opening operation journal: " + m_file;
+    Logging::Log(m_logCb, Level::Info, message.c_str());
+
+    // Operations that were appended and not removed, ordered by sequence which is the order they were appended in
+    std::map<uint64_t, std::shared_ptr<IOperation>> liveOperations;
+    size_t recordsRead = 0;
+
+    std::ifstream inputFile(FileUtils::PathFromUtf8(m_file), std::ios::binary);
+    if (!inputFile.fail())
+    {
+        std::stringstream contentStream;
+        contentStream << inputFile.rdbuf();
+        inputFile.close();
+
+        const std::string contents = contentStream.str();
+        size_t offset = 0;
+        const char* record = nullptr;
+        size_t recordLength = 0;
+
+        while (offset < contents.size())
+        {
+            // A record that is incomplete or fails its CRC check was torn by a crash, the records after it can't be trusted
+            if (!TryReadRecord(contents.data(), contents.size(), offset, record, recordLength))
+            {
+                Logging::Log(m_logCb, Level::Warning, "OperationJournal::Open(): Journal ends with an incomplete or corrupt record, ignoring it.");
+                break;
+            }
+
+            std::istringstream bodyStream(std::string(record, recordLength));
+            SetRecordVerified(bodyStream, true);
+
+            RecordType type = RecordType::Append;
+            uint64_t sequence = 0;
+            BinRead(bodyStream, type);
+            BinRead(bodyStream, sequence);
+
+            m_nextSequence = std::max(m_nextSequence, sequence + 1);
+            recordsRead++;
+
+            if (type == RecordType::Remove)
+            {
+                liveOperations.erase(sequence);
+                continue;
+            }
+
+            std::shared_ptr<IOperation> operation;
+            if (bodyStream.fail() || !m_deserializer(bodyStream, operation, m_logCb))
+            {
+                Logging::Log(m_logCb, Level::Error, "OperationJournal::Open(): Could not deserialize journaled operation, skipping it.");
+                continue;
+            }
+
+            operation->JournalSequence = sequence;
+            liveOperations[sequence] = operation;
+        }
+    }
+
+    outOperations.clear();
+    outOperations.reserve(liveOperations.size());
+    for (auto& operation : liveOperations)
+    {
+        outOperations.push_back(operation.second);
+    }
+
+    message = "Replayed " + std::to_string(recordsRead) + " journal records, " + std::to_string(outOperations.size()) + " operations pending.";
+    Logging::Log(m_logCb, Level::Info, message.c_str());
+
+    // Start from a compact journal so replay cost does not grow across sessions
+    return rewrite(outOperations);
+}
+
+bool OperationJournal::Append(std::shared_ptr<IOperation> operation)
+{
+    std::lock_guard<std::mutex> lock(m_journalMutex);
+
+    if (operation->JournalSequence != 0)
+    {
+        return true;
+    }
+
+    if (!m_outputFile.is_open())
+    {
+        return false;
+    }
+
+    std::stringstream payload;
+    if (!m_serializer(payload, operation, m_logCb))
+    {
+        Logging::Log(m_logCb, Level::Error, "OperationJournal::Append(): Could not serialize operation, it will not survive a crash.");
+        return false;
+    }
+
+    const uint64_t sequence = m_nextSequence++;
+    if (!writeRecord(RecordType::Append, sequence, payload.str()) || !flushRecords())
+    {
+        return false;
+    }
+
+    operation->JournalSequence = sequence;
+    m_recordCount++;
+    m_liveCount++;
+
+    return true;
+}
+
+bool OperationJournal::Append(const std::vector<std::shared_ptr<IOperation>>& operations)
+{
+    std::lock_guard<std::mutex> lock(m_journalMutex);
+
+    if (!m_outputFile.is_open())
+    {
+        return false;
+    }
+
+    std::vector<std::pair<std::shared_ptr<IOperation>, uint64_t>> written;
+    bool success = true;
+    for (const auto& operation : operations)
+    {
+        if (operation->JournalSequence != 0)
+        {
+            continue;
+        }
+
+        std::stringstream payload;
+        if (!m_serializer(payload, operation, m_logCb))
+        {
+            Logging::Log(m_logCb, Level::Error, "OperationJournal::Append(): Could not serialize operation, it will not survive a crash.");
+            success = false;
+            continue;
+        }
+
+        const uint64_t sequence = m_nextSequence++;
+        if (!writeRecord(RecordType::Append, sequence, payload.str()))
+        {
+            success = false;
+            break;
+        }
+
+        written.emplace_back(operation, sequence);
+    }
+
+    if (written.empty())
+    {
+        return success;
+    }
+
+    // Operations are only marked as journaled once their records are on disk
+    if (!flushRecords())
+    {
+        return false;
+    }
+
+    for (auto& entry : written)
+    {
+        entry.first->JournalSequence = entry.second;
+    }
+    m_recordCount += written.size();
+    m_liveCount += written.size();
+
+    return success;
+}
+
+void OperationJournal::Remove(std::shared_ptr<IOperation> operation)
+{
+    std::lock_guard<std::mutex> lock(m_journalMutex);
+
+    if (operation->JournalSequence == 0 || !m_outputFile.is_open())
+    {
+        return;
+    }
+
+    if (writeRecord(RecordType::Remove, operation->JournalSequence, std::string()) && flushRecords())
+    {
+        operation->JournalSequence = 0;
+        m_recordCount++;
+        if (m_liveCount > 0)
+        {
+            m_liveCount--;
+        }
+    }
+}
+
+void OperationJournal::Truncate()
+{
+    std::lock_guard<std::mutex> lock(m_journalMutex);
+
+    if (m_recordCount == 0 || !m_outputFile.is_open())
+    {
+        return;
+    }
+
+    m_outputFile.close();
+    m_outputFile.open(FileUtils::PathFromUtf8(m_file), std::ios::binary | std::ios::trunc);
+    if (m_outputFile.fail())
+    {
+        std::string message = "OperationJournal::Truncate(): Failed to reopen " + m_file + " for write.";
+        Logging::Log(m_logCb, Level::Error, message.c_str());
+    }
+
+    m_recordCount = 0;
+    m_liveCount = 0;
+}
+
+void OperationJournal::CompactIfNeeded(const OperationQueue& liveOperations)
+{
+    std::lock_guard<std::mutex> lock(m_journalMutex);
+
+    if (m_recordCount <= 2 * m_liveCount + JOURNAL_COMPACTION_SLACK)
+    {
+        return;
+    }
+
+    std::string message = "OperationJournal::CompactIfNeeded(): Compacting " + std::to_string(m_recordCount) + " records into " + std::to_string(liveOperations.size()) + " operations.";
+    Logging::Log(m_logCb, Level::Verbose, message.c_str());
+
+    rewrite(std::vector<std::shared_ptr<IOperation>>(liveOperations.begin(), liveOperations.end()));
+}
+#pragma endregion
+
+#pragma region Private Methods
+bool OperationJournal::writeRecord(RecordType type, uint64_t sequence, const std::string& payload)
+{
+    std::stringstream body;
+    BinWrite(body, type);
+    BinWrite(body, sequence);
+    body.write(payload.data(), payload.size());
+
+    BinWriteRecord(m_outputFile, body.str());
+
+    if (m_outputFile.fail())
+    {
+        Logging::Log(m_logCb, Level::Error, "OperationJournal: Could not write journal record.");
+        m_outputFile.clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool OperationJournal::flushRecords()
+{
+    // Records are flushed so they are on disk before the caller continues
+    m_outputFile.flush();
+
+    if (m_outputFile.fail())
+    {
+        Logging::Log(m_logCb, Level::Error, "OperationJournal: Could not flush journal records.");
+        m_outputFile.clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool OperationJournal::rewrite(const std::vector<std::shared_ptr<IOperation>>& operations)
+{
+    // Write the compacted journal next to the current one and swap it in, so a crash during compaction keeps the old journal
+    const std::string tempFile = m_file + ".tmp";
+    const FileUtils::PlatformPathString nativePath = FileUtils::PathFromUtf8(m_file);
+    const FileUtils::PlatformPathString nativeTempPath = FileUtils::PathFromUtf8(tempFile);
+
+    if (m_outputFile.is_open())
+    {
+        m_outputFile.close();
+    }
+
+    m_outputFile.open(nativeTempPath, std::ios::binary | std::ios::trunc);
+    if (m_outputFile.fail())
+    {
+        std::string message = "OperationJournal: Failed to open file " + tempFile + " for write.";
+        Logging::Log(m_logCb, Level::Error, message.c_str());
+        return false;
+    }
+
+    size_t recordCount = 0;
+    for (const auto& operation : operations)
+    {
+        std::stringstream payload;
+        if (!m_serializer(payload, operation, m_logCb))
+        {
+            Logging::Log(m_logCb, Level::Error, "OperationJournal: Could not serialize operation, it will not survive a crash.");
+            operation->JournalSequence = 0;
+            continue;
+        }
+
+        if (operation->JournalSequence == 0)
+        {
+            operation->JournalSequence = m_nextSequence++;
+        }
+
+        if (!writeRecord(RecordType::Append, operation->JournalSequence, payload.str()))
+        {
+            m_outputFile.close();
+            return false;
+        }
+
+        recordCount++;
+    }
+
+    if (!flushRecords())
+    {
+        m_outputFile.close();
+        return false;
+    }
+    m_outputFile.close();
+
+#if __ANDROID__
+    // Workaround for Android's "Not implemented" error when calling boost::filesystem functions
+    int result = rename(nativeTempPath.c_str(), nativePath.c_str());
+    if (result != 0)
+    {
+        std::string message = "OperationJournal: Could not replace journal, result: " + std::to_string(result) + ", errno: " + std::to_string(errno);
+        Logging::Log(m_logCb, Level::Error, message.c_str());
+        return false;
+    }
+#else
+    boost::system::error_code error;
+    boost::filesystem::rename(nativeTempPath, nativePath, error);
+    if (error)
+    {
+        std::string message = "OperationJournal: Could not replace journal, error: " + error.message();
+        Logging::Log(m_logCb, Level::Error, message.c_str());
+        return false;
+    }
+#endif
+
+    m_outputFile.open(nativePath, std::ios::binary | std::ios::app);
+    if (m_outputFile.fail())
+    {
+        std::string message = "OperationJournal: Failed to open file " + m_file + " for append.";
+        Logging::Log(m_logCb, Level::Error, message.c_str());
+        return false;
+    }
+
+    m_recordCount = recordCount;
+    m_liveCount = recordCount;
+
+    return true;
+}
+#pragma endregion
@@ -1,6 +1,8 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <cstring>
 
 // AWS SDK
 #include <aws/core/http/HttpClient.h>
@@ -104,9 +106,73 @@ unsigned int GameKit::Utils::Serialization::GetCRC(const char* s, size_t length)
 
     return crc.checksum();
 }
+
+std::ostream& GameKit::Utils::Serialization::BinWriteRecord(std::ostream& os, const std::string& record)
+{
+    BinWrite(os, record);
+    BinWrite(os, GetCRC(record));
+
+    return os;
+}
+
+bool GameKit::Utils::Serialization::TryReadRecord(const char* data, size_t size, size_t& offset, const char*& outRecord, size_t& outLength)
+{
+    size_t length = 0;
+    unsigned int crc = 0;
+
+    if (offset > size || size - offset < sizeof(size_t))
+    {
+        return false;
+    }
+
+    memcpy(&length, data + offset, sizeof(size_t));
+
+    // A length that runs past the end of the data is either corrupt or the record was cut short
+    const size_t remaining = size - offset - sizeof(size_t);
+    if (length > remaining || remaining - length < sizeof(unsigned int))
+    {
+        return false;
+    }
+
+    const char* record = data + offset + sizeof(size_t);
+    memcpy(&crc, record + length, sizeof(unsigned int));
+    if (crc != GetCRC(record, length))
+    {
+        return false;
+    }
+
+    outRecord = record;
+    outLength = length;
+    offset += sizeof(size_t) + length + sizeof(unsigned int);
+
+    return true;
+}
+
+namespace
+{
+    int recordVerifiedIndex()
+    {
+        static const int index = std::ios_base::xalloc();
+        return index;
+    }
+}
+
+void GameKit::Utils::Serialization::SetRecordVerified(std::ios_base& stream, bool isVerified)
+{
+    stream.iword(recordVerifiedIndex()) = isVerified ? 1 : 0;
+}
+
+bool GameKit::Utils::Serialization::IsRecordVerified(std::ios_base& stream)
+{
+    return stream.iword(recordVerifiedIndex()) != 0;
+}
 #pragma endregion
 
 #pragma region HttpClient Public Methods
+std::chrono::milliseconds GameKit::Utils::HttpClient::SteadyClockNow()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch());
+}
 
 GameKit::Utils::HttpClient::IOperation::IOperation(unsigned int maxAttempts,
     bool discard,
@@ -264,17 +330,20 @@ bool GameKit::Utils::HttpClient::TryDeserializeRequestBinary(std::istream& is, s
                 return false;
             }
 
-            // verify body crc matches
             BinRead(is, bodyCrc);
-            unsigned int computedCrc = GetCRC(contentBody);
-            if (computedCrc != bodyCrc)
+
+            // The body was validated before it was written, if the enclosing record passed its CRC check it does not need to be validated again
+            const bool isRecordVerified = IsRecordVerified(is);
+
+            // verify body crc matches
+            if (!isRecordVerified && GetCRC(contentBody) != bodyCrc)
             {
                 Logging::Log(logCb, Level::Error, "Could not deserialize HttpRequest, content CRC mismatch");
                 return false;
             }
 
             // if body is Json, verify it can be parsed
-            if (Aws::Utils::StringUtils::CaselessCompare(contentType.c_str(), "application/json"))
+            if (!isRecordVerified && Aws::Utils::StringUtils::CaselessCompare(contentType.c_str(), "application/json"))
             {
                 Aws::Utils::Json::JsonValue bodyObject(ToAwsString(contentBody));
                 if (!bodyObject.WasParseSuccessful())
@@ -358,7 +427,7 @@ unsigned int RequestResult::ToErrorCode() const
 #pragma endregion
 
 #pragma region ExponentialBackoffStrategy Public Methods
-ExponentialBackoffStrategy::ExponentialBackoffStrategy(unsigned int maxAttempts, FuncLogCallback logCb) : tickCounter(0), currentStep(0), retryThreshold(0), maxAttempts(maxAttempts), logCb(logCb)
+ExponentialBackoffStrategy::ExponentialBackoffStrategy(unsigned int maxAttempts, FuncLogCallback logCb) : tickCounter(0), currentStep(0), retryThreshold(0), maxAttempts(maxAttempts), randomEngine(std::random_device()()), logCb(logCb)
 {}
 
 ExponentialBackoffStrategy::~ExponentialBackoffStrategy()
@@ -368,7 +437,7 @@ void ExponentialBackoffStrategy::IncreaseThreshold()
 {
     currentStep++;
     retryThreshold = pow(2, currentStep);
-    retryThreshold = (std::rand() % retryThreshold) + 1;
+    retryThreshold = std::uniform_int_distribution<unsigned int>(1, retryThreshold)(randomEngine);
 
     std::string message = "ExponentialBackoffStrategy step " + std::to_string(currentStep) + ", next retry threshold " + std::to_string(retryThreshold);
     Logging::Log(logCb, Level::Verbose, message.c_str());
@@ -391,3 +460,175 @@ void ExponentialBackoffStrategy::Reset()
     retryThreshold = 0;
 }
 #pragma endregion
+
+#pragma region DecorrelatedJitterStrategy Public Methods
+DecorrelatedJitterStrategy::DecorrelatedJitterStrategy(std::chrono::milliseconds baseDelay, std::chrono::milliseconds maxDelay, FuncLogCallback logCb) :
+    baseDelay(baseDelay), maxDelay(std::max(baseDelay, maxDelay)), randomEngine(std::random_device()()), logCb(logCb)
+{}
+
+DecorrelatedJitterStrategy::~DecorrelatedJitterStrategy()
+{}
+
+std::chrono::milliseconds DecorrelatedJitterStrategy::GetRetryDelay(const IOperation& operation)
+{
+    const long long previousDelay = std::max(operation.RetryDelay, baseDelay).count();
+    const long long upperBound = std::min<long long>(previousDelay * 3, maxDelay.count());
+    const std::chrono::milliseconds delay(std::uniform_int_distribution<long long>(std::min<long long>(baseDelay.count(), upperBound), upperBound)(randomEngine));
+
+    std::string message = "DecorrelatedJitterStrategy attempt " + std::to_string(operation.Attempts) + ", next retry in " + std::to_string(delay.count()) + " ms";
+    Logging::Log(logCb, Level::Verbose, message.c_str());
+
+    return delay;
+}
+#pragma endregion
+
+#pragma region RetryBudgetStrategy Public Methods
+RetryBudgetStrategy::RetryBudgetStrategy(std::shared_ptr<IRetryStrategy> innerStrategy, unsigned int maxTokens, unsigned int retryCost, unsigned int successRefill, unsigned int refillPerSecond, FuncLogCallback logCb) :
+    innerStrategy(innerStrategy), maxTokens(maxTokens), retryCost(retryCost), successRefill(successRefill), refillPerSecond(refillPerSecond), tokens(maxTokens), lastRefill(SteadyClockNow()), logCb(logCb)
+{}
+
+RetryBudgetStrategy::~RetryBudgetStrategy()
+{}
+
+void RetryBudgetStrategy::IncreaseThreshold()
+{
+    innerStrategy->IncreaseThreshold();
+}
+
+bool RetryBudgetStrategy::ShouldRetry()
+{
+    return innerStrategy->ShouldRetry();
+}
+
+void RetryBudgetStrategy::Reset()
+{
+    // The budget is not reset, it only refills over time and with successful requests
+    innerStrategy->Reset();
+}
+
+std::chrono::milliseconds RetryBudgetStrategy::GetRetryDelay(const IOperation& operation)
+{
+    return innerStrategy->GetRetryDelay(operation);
+}
+
+bool RetryBudgetStrategy::AcquireAttempt(const IOperation& operation)
+{
+    if (!innerStrategy->AcquireAttempt(operation))
+    {
+        return false;
+    }
+
+    // First attempts are not retries, they don't spend the budget
+    if (operation.Attempts == 0)
+    {
+        return true;
+    }
+
+    refill();
+    if (tokens < retryCost)
+    {
+        std::string message = "RetryBudgetStrategy budget exhausted with " + std::to_string(tokens) + " tokens, holding back retry";
+        Logging::Log(logCb, Level::Verbose, message.c_str());
+        return false;
+    }
+
+    tokens -= retryCost;
+    return true;
+}
+
+void RetryBudgetStrategy::RecordAttempt(const IOperation& operation, bool isTransientFailure)
+{
+    if (!isTransientFailure)
+    {
+        refill();
+        tokens = std::min(maxTokens, tokens + successRefill);
+    }
+
+    innerStrategy->RecordAttempt(operation, isTransientFailure);
+}
+#pragma endregion
+
+#pragma region RetryBudgetStrategy Private Methods
+void RetryBudgetStrategy::refill()
+{
+    const std::chrono::milliseconds now = SteadyClockNow();
+    tokens = std::min(maxTokens, tokens + refillPerSecond * (now - lastRefill).count() / 1000.0);
+    lastRefill = now;
+}
+#pragma endregion
+
+#pragma region CircuitBreakerStrategy Public Methods
+CircuitBreakerStrategy::CircuitBreakerStrategy(std::shared_ptr<IRetryStrategy> innerStrategy, std::chrono::milliseconds openDuration, unsigned int failureThreshold, FuncLogCallback logCb) :
+    innerStrategy(innerStrategy), failureThreshold(std::max(failureThreshold, 1u)), openDuration(openDuration), logCb(logCb)
+{}
+
+CircuitBreakerStrategy::~CircuitBreakerStrategy()
+{}
+
+void CircuitBreakerStrategy::IncreaseThreshold()
+{
+    innerStrategy->IncreaseThreshold();
+}
+
+bool CircuitBreakerStrategy::ShouldRetry()
+{
+    return innerStrategy->ShouldRetry();
+}
+
+void CircuitBreakerStrategy::Reset()
+{
+    innerStrategy->Reset();
+}
+
+std::chrono::milliseconds CircuitBreakerStrategy::GetRetryDelay(const IOperation& operation)
+{
+    return innerStrategy->GetRetryDelay(operation);
+}
+
+bool CircuitBreakerStrategy::AcquireAttempt(const IOperation& operation)
+{
+    auto circuit = circuits.find(operation.Request->GetUri().GetAuthority().c_str());
+    if (circuit != circuits.end() && circuit->second.ConsecutiveFailures >= failureThreshold)
+    {
+        // Open, or half-open with the trial operation still in flight
+        if (SteadyClockNow() < circuit->second.OpenUntil || circuit->second.TrialInFlight)
+        {
+            return false;
+        }
+
+        if (!innerStrategy->AcquireAttempt(operation))
+        {
+            return false;
+        }
+
+        circuit->second.TrialInFlight = true;
+        return true;
+    }
+
+    return innerStrategy->AcquireAttempt(operation);
+}
+
+void CircuitBreakerStrategy::RecordAttempt(const IOperation& operation, bool isTransientFailure)
+{
+    const std::string host = operation.Request->GetUri().GetAuthority().c_str();
+    if (!isTransientFailure)
+    {
+        circuits.erase(host);
+    }
+    else
+    {
+        HostCircuit& circuit = circuits[host];
+        circuit.ConsecutiveFailures++;
+        circuit.TrialInFlight = false;
+        if (circuit.ConsecutiveFailures >= failureThreshold)
+        {
+            circuit.OpenUntil = SteadyClockNow() + openDuration;
+
+            std::string message = "CircuitBreakerStrategy circuit open for host " + host + " after " + std::to_string(circuit.ConsecutiveFailures) + " consecutive failures";
+            Logging::Log(logCb, Level::Warning, message.c_str());
+        }
+    }
+
+    innerStrategy->RecordAttempt(operation, isTransientFailure);
+}
+#pragma endregion
@@ -15,8 +15,8 @@ Ticker::Ticker(int interval, std::function<void()> tickFunc, FuncLogCallback log
     m_logCb = logCb;
     m_isRunning = false;
     m_aborted = false;
-    m_isCompleted = false;
     m_wasOnDestroyCalled = false;
+    m_timerId = 0;
 }
 
 Ticker::~Ticker()
@@ -48,7 +48,7 @@ void Ticker::Start()
         std::lock_guard<std::mutex> lock(m_tickerMutex);
         if (m_isRunning)
         {
-            Logging::Log(m_logCb, Level::Warning, "Ticker::Start(): This ticker is already running. It can only support one background thread at a time. Skipped starting a new thread.", this);
+            Logging::Log(m_logCb, Level::Warning, "Ticker::Start(): This ticker is already running. It can only support one loop at a time. Skipped starting a new loop.", this);
             return;
         }
     }
@@ -57,35 +57,16 @@ void Ticker::Start()
     buffer << "Ticker::Start(): Interval: " << m_interval;
     Logging::Log(m_logCb, Level::Info, buffer.str().c_str(), this);
 
-    m_isRunning = true;
-    m_funcThread = std::thread([&]()
     {
-        std::chrono::milliseconds pulse{ TICKER_PULSE };
+        std::lock_guard<std::mutex> lock(m_tickerMutex);
+        m_isRunning = true;
         startNewInterval(m_interval);
 
-        while (m_isRunning && !m_aborted)
+        m_timerId = TimerService::GetInstance().Schedule(timeUntilIntervalEnd(), [this](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
         {
-            // Wake the ticker every TICKER_PULSE and count down the current interval
-            std::this_thread::sleep_for(pulse);
-            countDownInterval(pulse);
-
-            if (isIntervalOver())
-            {
-                // execute the tickFunc
-                m_threadId = std::this_thread::get_id();
-                m_tickFunc();
-                m_threadId = std::thread::id();
-
-                // set the next intervalEndTime
-                startNewInterval(m_interval);
-            }
-        }
-        Logging::Log(m_logCb, Level::Info, "Ticker::Stop(): Ticker loop exited.", this);
-
-        // notify Stop() method that this thread completed
-        m_isCompleted = true;
-        m_completedVar.notify_one();
-    });
+            return onTimer(sleepTime, nextDelay);
+        });
+    }
 
     Logging::Log(m_logCb, Level::Info, "Ticker::Start(): Ticker loop started.", this);
 }
@@ -94,23 +75,17 @@ void Ticker::Stop()
 {
     Logging::Log(m_logCb, Level::Info, "Ticker::Stop()", this);
 
-    // notify thread that we're stopping
+    TimerService::TimerId timerId;
     {
         std::lock_guard<std::mutex> lock(m_tickerMutex);
         Logging::Log(m_logCb, Level::Info, "Ticker::Stop(): Stopping...", this);
         m_isRunning = false;
+        timerId = m_timerId;
     }
 
-    m_funcThread.join();
+    // cancel outside the lock, this waits for a running tick function which may need the lock to finish
+    TimerService::GetInstance().Cancel(timerId);
 
-    {
-        // wait for thread to send completion signal
-        std::unique_lock<std::mutex> lock(m_tickerMutex);
-        m_completedVar.wait(lock, [&] { return m_isCompleted; });
-    }
-
-    // reset the flag in case the Ticker is restarted
-    m_isCompleted = false;
     Logging::Log(m_logCb, Level::Info, "Ticker::Stop(): Stopped.", this);
 }
 
@@ -141,3 +116,39 @@ void Ticker::RescheduleLoop(int newInterval)
     Logging::Log(m_logCb, Level::Info, buffer.str().c_str(), this);
 }
 #pragma endregion
+
+#pragma region Private Methods
+bool Ticker::onTimer(std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+{
+    std::unique_lock<std::mutex> lock(m_tickerMutex);
+    if (!m_isRunning)
+    {
+        return false;
+    }
+
+    countDownInterval(sleepTime);
+    if (!isIntervalOver())
+    {
+        nextDelay = timeUntilIntervalEnd();
+        return true;
+    }
+
+    // execute the tickFunc without holding the lock so it can call AbortLoop() and RescheduleLoop()
+    lock.unlock();
+    m_threadId = std::this_thread::get_id();
+    m_tickFunc();
+    m_threadId = std::thread::id();
+    lock.lock();
+
+    if (!m_isRunning || m_aborted)
+    {
+        Logging::Log(m_logCb, Level::Info, "Ticker::onTimer(): Ticker loop exited.", this);
+        return false;
+    }
+
+    // set the next intervalEndTime
+    startNewInterval(m_interval);
+    nextDelay = timeUntilIntervalEnd();
+    return true;
+}
+#pragma endregion
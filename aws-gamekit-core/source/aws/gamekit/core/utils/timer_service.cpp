@@ -0,0 +1,324 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <algorithm>
+
+// GameKit
+#include <aws/gamekit/core/utils/timer_service.h>
+
+#define TIMER_SERVICE_EXECUTOR_IDLE_SECONDS 30
+#define TIMER_SERVICE_MAX_EXECUTORS 8
+
+using namespace GameKit::Utils;
+
+#pragma region Constructors/Destructor
+TimerService& TimerService::GetInstance()
+{
+    // Never destroyed, a static destructor joining threads could deadlock while the process exits or the library unloads
+    static TimerService* instance = new TimerService();
+    return *instance;
+}
+#pragma endregion
+
+#pragma region Public Methods
+TimerService::TimerId TimerService::Schedule(std::chrono::milliseconds delay, TimerCallback callback)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_isShuttingDown)
+    {
+        return 0;
+    }
+
+    const TimerId timerId = m_nextTimerId++;
+    TimerEntry& timer = m_timers[timerId];
+    timer.Callback = callback;
+    pushDeadline(timerId, timer, delay);
+
+    if (!m_isDispatcherRunning)
+    {
+        // A dispatcher that exited when the last timer was removed still needs to be joined
+        if (m_dispatcher.joinable())
+        {
+            m_dispatcher.join();
+        }
+
+        m_isDispatcherRunning = true;
+        m_dispatcher = std::thread(&TimerService::dispatcherLoop, this);
+    }
+
+    return timerId;
+}
+
+void TimerService::Reschedule(TimerId timerId, std::chrono::milliseconds delay)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto timer = m_timers.find(timerId);
+    if (timer == m_timers.end() || timer->second.IsRunning || timer->second.IsCancelled)
+    {
+        return;
+    }
+
+    // Keep the original scheduled time and delay so the callback receives the time that actually elapsed
+    timer->second.Generation++;
+    timer->second.Deadline = std::chrono::steady_clock::now() + std::max(delay, std::chrono::milliseconds::zero());
+    m_deadlines.push({ timer->second.Deadline, timerId, timer->second.Generation });
+    m_deadlineChangedVar.notify_one();
+}
+
+void TimerService::Cancel(TimerId timerId)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    auto timer = m_timers.find(timerId);
+    if (timer == m_timers.end())
+    {
+        return;
+    }
+
+    if (timer->second.IsRunning)
+    {
+        // The executor removes cancelled timers once their callback returns
+        timer->second.IsCancelled = true;
+        if (timer->second.RunningThreadId != std::this_thread::get_id())
+        {
+            m_callbackCompletedVar.wait(lock, [&] { return m_timers.find(timerId) == m_timers.end(); });
+        }
+
+        return;
+    }
+
+    m_timers.erase(timer);
+    m_deadlineChangedVar.notify_one();
+}
+
+void TimerService::Shutdown()
+{
+    std::thread dispatcher;
+    std::map<std::thread::id, std::thread> executors;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_isShuttingDown = true;
+
+        // Callbacks that were dispatched but not started yet are dropped with the timers that are waiting
+        for (const DispatchedCallback& dispatched : m_dispatched)
+        {
+            m_timers.erase(dispatched.Id);
+            m_runningCallbacks--;
+        }
+        m_dispatched.clear();
+
+        for (auto timer = m_timers.begin(); timer != m_timers.end();)
+        {
+            if (timer->second.IsRunning)
+            {
+                timer->second.IsCancelled = true;
+                ++timer;
+            }
+            else
+            {
+                timer = m_timers.erase(timer);
+            }
+        }
+
+        m_deadlines = std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>>();
+        m_deadlineChangedVar.notify_all();
+        m_callbackDispatchedVar.notify_all();
+        m_callbackCompletedVar.notify_all();
+
+        m_callbackCompletedVar.wait(lock, [&] { return m_runningCallbacks == 0; });
+
+        dispatcher = std::move(m_dispatcher);
+    }
+
+    // Join without holding the lock, the threads need it to leave their loop.
+    // The dispatcher goes first since it starts executors outside the lock and adds them to m_executors afterwards.
+    if (dispatcher.joinable())
+    {
+        dispatcher.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        executors = std::move(m_executors);
+        m_executors.clear();
+    }
+
+    for (auto& executor : executors)
+    {
+        executor.second.join();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_exitedExecutors.clear();
+    m_isDispatcherRunning = false;
+    m_isShuttingDown = false;
+}
+#pragma endregion
+
+#pragma region Private Methods
+void TimerService::pushDeadline(TimerId timerId, TimerEntry& timer, std::chrono::milliseconds delay)
+{
+    timer.Delay = std::max(delay, std::chrono::milliseconds::zero());
+    timer.ScheduledTime = std::chrono::steady_clock::now();
+    timer.Deadline = timer.ScheduledTime + timer.Delay;
+    timer.Generation++;
+
+    m_deadlines.push({ timer.Deadline, timerId, timer.Generation });
+    m_deadlineChangedVar.notify_one();
+}
+
+bool TimerService::isStale(const HeapEntry& entry) const
+{
+    auto timer = m_timers.find(entry.Id);
+    return timer == m_timers.end() || timer->second.IsRunning || timer->second.Generation != entry.Generation;
+}
+
+bool TimerService::dispatch(TimerId timerId)
+{
+    TimerEntry& timer = m_timers[timerId];
+    timer.IsRunning = true;
+
+    // Cap the elapsed time to the requested delay so time spent while the device was sleeping is not included
+    const std::chrono::milliseconds elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - timer.ScheduledTime);
+    m_dispatched.push_back({ timerId, timer.Callback, std::min(elapsed, timer.Delay) });
+    m_runningCallbacks++;
+
+    m_callbackDispatchedVar.notify_one();
+
+    // A callback waiting for an executor gets its own until TIMER_SERVICE_MAX_EXECUTORS are running,
+    // past that it stays in m_dispatched until an executor returns from its current callback
+    if (m_idleExecutors >= m_dispatched.size() || m_executorCount >= TIMER_SERVICE_MAX_EXECUTORS)
+    {
+        return false;
+    }
+
+    m_executorCount++;
+    return true;
+}
+
+void TimerService::startExecutor(std::unique_lock<std::mutex>& lock)
+{
+    // An executor records its id as the last thing it does while holding the lock, joining it does not wait for long
+    std::vector<std::thread> exitedExecutors;
+    for (const std::thread::id& executorId : m_exitedExecutors)
+    {
+        auto executor = m_executors.find(executorId);
+        if (executor != m_executors.end())
+        {
+            exitedExecutors.push_back(std::move(executor->second));
+            m_executors.erase(executor);
+        }
+    }
+    m_exitedExecutors.clear();
+
+    // Join and create threads without holding the lock so timers can be scheduled and callbacks can complete meanwhile
+    lock.unlock();
+    for (std::thread& exitedExecutor : exitedExecutors)
+    {
+        exitedExecutor.join();
+    }
+    std::thread executor(&TimerService::executorLoop, this);
+    lock.lock();
+
+    // If the executor already left its loop its id is in m_exitedExecutors, it is joined by the next call or by Shutdown()
+    const std::thread::id executorId = executor.get_id();
+    m_executors[executorId] = std::move(executor);
+}
+
+void TimerService::dispatcherLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (!m_isShuttingDown && !m_timers.empty())
+    {
+        while (!m_deadlines.empty() && isStale(m_deadlines.top()))
+        {
+            m_deadlines.pop();
+        }
+
+        // All remaining timers are running
+        if (m_deadlines.empty())
+        {
+            m_deadlineChangedVar.wait(lock);
+            continue;
+        }
+
+        const HeapEntry next = m_deadlines.top();
+        if (std::chrono::steady_clock::now() < next.Deadline)
+        {
+            m_deadlineChangedVar.wait_until(lock, next.Deadline);
+            continue;
+        }
+
+        m_deadlines.pop();
+        if (dispatch(next.Id))
+        {
+            startExecutor(lock);
+        }
+    }
+
+    m_isDispatcherRunning = false;
+}
+
+void TimerService::executorLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        if (m_dispatched.empty())
+        {
+            if (m_isShuttingDown)
+            {
+                break;
+            }
+
+            m_idleExecutors++;
+            const bool hasWork = m_callbackDispatchedVar.wait_for(lock, std::chrono::seconds(TIMER_SERVICE_EXECUTOR_IDLE_SECONDS),
+                [&] { return m_isShuttingDown || !m_dispatched.empty(); });
+            m_idleExecutors--;
+
+            if (!hasWork)
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        const DispatchedCallback dispatched = m_dispatched.front();
+        m_dispatched.pop_front();
+        m_timers[dispatched.Id].RunningThreadId = std::this_thread::get_id();
+
+        // Run the callback without holding the lock so it can schedule, reschedule or cancel timers
+        lock.unlock();
+        std::chrono::milliseconds nextDelay = std::chrono::milliseconds::zero();
+        const bool runAgain = dispatched.Callback(dispatched.SleepTime, nextDelay);
+        lock.lock();
+
+        // Cancel() and Shutdown() wait for running callbacks, so the entry is still in the map
+        TimerEntry& completedTimer = m_timers[dispatched.Id];
+        completedTimer.IsRunning = false;
+        completedTimer.RunningThreadId = std::thread::id();
+
+        if (runAgain && !completedTimer.IsCancelled)
+        {
+            pushDeadline(dispatched.Id, completedTimer, nextDelay);
+        }
+        else
+        {
+            m_timers.erase(dispatched.Id);
+            m_deadlineChangedVar.notify_one();
+        }
+
+        m_runningCallbacks--;
+        m_callbackCompletedVar.notify_all();
+    }
+
+    m_executorCount--;
+    m_exitedExecutors.push_back(std::this_thread::get_id());
+}
+#pragma endregion
@@ -25,4 +25,11 @@ bool TimestampTicker::isIntervalOver() const
 {
     return std::chrono::steady_clock::now() >= m_intervalEndTime;
 }
+
+std::chrono::milliseconds TimestampTicker::timeUntilIntervalEnd() const
+{
+    // Wake up at least every MAX_SLEEP_TIME so an interval that ended while the device was sleeping is detected soon after it wakes up
+    std::chrono::milliseconds timeLeft = std::chrono::ceil<std::chrono::milliseconds>(m_intervalEndTime - std::chrono::steady_clock::now());
+    return std::min(timeLeft, std::chrono::milliseconds(MAX_SLEEP_TIME));
+}
 #pragma endregion
@@ -127,6 +127,29 @@ extern "C"
      */
     GAMEKIT_API void GameKitSetFileActions(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, FileActions fileActions);
 
+    /**
+     * @brief Keep the information of every save slot in a single binary index file instead of one SaveInfo.json file per slot.
+     *
+     * @details This method reads the index file with a single call to FileActions::fileReadCallback() and adds its slots to the cached slots,
+     * like GameKitAddLocalSlots() does for SaveInfo.json files. Use it instead of GameKitAddLocalSlots() when the player has many slots.
+     * Slots that were already cached and are missing from the index, for example slots loaded by GameKitAddLocalSlots(), are added to it.
+     *
+     * @details Once the index is set, GameKitSaveSlot(), GameKitLoadSlot() and GameKitLoadSlots() update the slot's record in the index
+     * instead of writing the SaveInfo.json file at GameSavingModel::localSlotInformationFilePath, and GameKitDeleteSlot() removes the slot's record.
+     * The index is written with FileActions::fileWriteCallback() after each update, alternately to `indexFilePath` and to a second copy at `indexFilePath` + ".2",
+     * and this method keeps the newest copy that is intact. A crash during a write therefore loses at most that update. Each record is protected by a CRC: when neither copy
+     * is intact, a corrupt or incomplete record is logged and dropped along with the records after it, the affected slots are restored by the next call to GameKitGetAllSlotSyncStatuses().
+     *
+     * @details After a different player logs in, call GameKitClearSyncedSlots() then call this method again with that player's index file.
+     *
+     * @param gameSavingInstance A pointer to a GameSaving instance created with GameKitGameSavingInstanceCreateWithSessionManager().
+     * @param indexFilePath Path of the index file, it is created by the first update when it doesn't exist. Pass nullptr or an empty string to go back to SaveInfo.json files.
+     * @return A GameKit status code indicating the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
+     * - GAMEKIT_SUCCESS: The index was read, or is new, and is used from now on.
+     * - GAMEKIT_ERROR_FILE_READ_FAILED: The index file could not be read. Nothing changed, the previous index or the SaveInfo.json files are still used.
+     */
+    GAMEKIT_API unsigned int GameKitSetSlotMetadataIndex(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, const char* indexFilePath);
+
     /**
      * @brief Get a complete and updated view of the player's save slots (both local and cloud).
      *
@@ -158,6 +181,34 @@ extern "C"
         bool waitForAllPages,
         unsigned int pageSize);
 
+    /**
+     * @brief Update the player's save slots with only the cloud saves that changed since the last call to this method or to GameKitGetAllSlotSyncStatuses().
+     *
+     * @details Use this method instead of GameKitGetAllSlotSyncStatuses() to poll for changes made from other devices. The backend only returns
+     * the cloud saves that were written or deleted since the change token it handed out with the previous listing, so the cost of a call
+     * grows with the number of changes instead of the number of slots. Cached slots that did not change keep their Slot::slotSyncStatus.
+     *
+     * @details The callback receives the same slots as with GameKitGetAllSlotSyncStatuses(): the per page invocations contain the changed slots,
+     * the final invocation contains every cached slot or the cached slots that were not in a page.
+     *
+     * @details This method behaves exactly like GameKitGetAllSlotSyncStatuses() when there is no change token yet, for example on the first call after
+     * GameKitClearSyncedSlots(), or when the backend does not hand out change tokens.
+     *
+     * @param gameSavingInstance A pointer to a GameSaving instance created with GameKitGameSavingInstanceCreateWithSessionManager().
+     * @param receiver (Optional) This pointer will be passed to the callback function as the `dispatchReceiver`.
+     * @param resultCb The callback function to invoke and return data to when the method has finished.
+     * @param waitForAllPages If true, the `resultCb` will not be invoked until this method fully completes. If false, it will be invoked after each page of slots are updated.
+     * @param pageSize If waitForAllPages is false, then this is the number of slots to return during each invocation of the callback. Otherwise this parameter is ignored.
+     * @return A GameKit status code indicating the result of the API call. Status codes are defined in errors.h. This method's possible status codes are the same as GameKitGetAllSlotSyncStatuses().
+     * When a call fails the change token is kept, the next call asks for the same changes again.
+     */
+    GAMEKIT_API unsigned int GameKitGetChangedSlotSyncStatuses(
+        GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance,
+        DISPATCH_RECEIVER_HANDLE receiver,
+        GameSavingResponseCallback resultCb,
+        bool waitForAllPages,
+        unsigned int pageSize);
+
     /**
      * @brief Get an updated view and recommended syncing action for the player's specific save slot.
      *
@@ -298,6 +349,38 @@ extern "C"
         GameSavingDataResponseCallback resultCb,
         GameSavingModel model);
 
+    /**
+     * @brief Download several of the player's cloud slots, each into its own local data buffer.
+     *
+     * @details Each slot goes through the same steps as GameKitLoadSlot(), including writing its SaveInfo.json file. Instead of one slot after the other,
+     * up to `maxConcurrentTransfers` slots fetch their sync status, their pre-signed S3 url and their save file at the same time.
+     * Use this when a player needs many slots at once, for example when they log in on a new device.
+     *
+     * @details `slotResultCb` is invoked once per model as soon as that slot is loaded or fails, in no particular order, with the same arguments GameKitLoadSlot() passes to its callback.
+     * `completionCb` is invoked once after every slot was reported, with `complete` set to true, the cached slots, and the same status code this method returns.
+     * Both callbacks are invoked on the calling thread before this method returns.
+     *
+     * @param gameSavingInstance A pointer to a GameSaving instance created with GameKitGameSavingInstanceCreateWithSessionManager().
+     * @param receiver (Optional) This pointer will be passed to both callback functions as the `dispatchReceiver`.
+     * @param slotResultCb The callback function to invoke with the result of each slot.
+     * @param completionCb The callback function to invoke once all slots have been reported.
+     * @param models Array of structs containing all required fields for loading data from the cloud, see GameKitLoadSlot(). Each model needs its own data buffer.
+     * @param modelCount The number of models in `models`.
+     * @param maxConcurrentTransfers The maximum number of slots downloaded at the same time. A value of 0 is treated as 1. LOAD_SLOTS_DEFAULT_MAX_CONCURRENT_TRANSFERS is a sensible default.
+     * @return A GameKit status code indicating the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
+     * - GAMEKIT_SUCCESS: Every slot was loaded.
+     * - GAMEKIT_ERROR_NO_ID_TOKEN: The player is not logged in. No slot was loaded and `slotResultCb` is not invoked.
+     * - Any status code of GameKitLoadSlot(): The status of the first model, in array order, that failed to load. `slotResultCb` received the status of every slot.
+     */
+    GAMEKIT_API unsigned int GameKitLoadSlots(
+        GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance,
+        DISPATCH_RECEIVER_HANDLE receiver,
+        GameSavingDataResponseCallback slotResultCb,
+        GameSavingResponseCallback completionCb,
+        const GameSavingModel* models,
+        unsigned int modelCount,
+        unsigned int maxConcurrentTransfers);
+
     /**
      * @brief Destroy the passed in GameSaving instance.
      *
@@ -4,9 +4,13 @@
 #pragma once
 
 // Standard Library
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 // AWS SDK
 #include <aws/core/http/HttpClient.h>
@@ -17,6 +21,7 @@
 #include <aws/gamekit/authentication/gamekit_session_manager.h>
 #include <aws/gamekit/core/gamekit_feature.h>
 #include <aws/gamekit/core/logging.h>
+#include <aws/gamekit/core/utils/buffer_stream.h>
 #include <aws/gamekit/core/utils/current_time_provider.h>
 #include <aws/gamekit/core/utils/file_utils.h>
 #include <aws/gamekit/core/utils/validation_utils.h>
@@ -38,10 +43,13 @@ namespace GameKit
         virtual void AddLocalSlots(const char* const* localSlotInformationFilePaths, unsigned int arraySize) = 0;
         virtual void SetFileActions(FileActions fileActions) = 0;
         virtual unsigned int GetAllSlotSyncStatuses(DISPATCH_RECEIVER_HANDLE receiver, GameSavingResponseCallback resultCb, bool waitForAllPages, unsigned int pageSize) = 0;
+        virtual unsigned int GetChangedSlotSyncStatuses(DISPATCH_RECEIVER_HANDLE receiver, GameSavingResponseCallback resultCb, bool waitForAllPages, unsigned int pageSize) = 0;
         virtual unsigned int GetSlotSyncStatus(DISPATCH_RECEIVER_HANDLE receiver, GameSavingSlotActionResponseCallback resultCb, const char* slotName) = 0;
         virtual unsigned int DeleteSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingSlotActionResponseCallback resultCb, const char* slotName) = 0;
         virtual unsigned int SaveSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingSlotActionResponseCallback resultCb, GameSavingModel model) = 0;
         virtual unsigned int LoadSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingDataResponseCallback resultCb, GameSavingModel model) = 0;
+        virtual unsigned int LoadSlots(DISPATCH_RECEIVER_HANDLE receiver, GameSavingDataResponseCallback slotResultCb, GameSavingResponseCallback completionCb, const GameSavingModel* models, unsigned int modelCount, unsigned int maxConcurrentTransfers) = 0;
+        virtual unsigned int SetSlotMetadataIndex(const char* indexFilePath) = 0;
     };
 
     namespace GameSaving
@@ -62,20 +70,83 @@ namespace GameKit
             static const std::string HASH;
             static const std::string TIME_TO_LIVE;
             static const std::string LAST_MODIFIED_EPOCH_TIME;
+            static const std::string UNCOMPRESSED_SIZE;
+            static const std::string EXPECTED_LAST_MODIFIED_EPOCH_TIME;
             static const std::string CONSISTENT_READ;
+            static const std::string CHANGE_TOKEN;
 
             static const Aws::String S3_SHA_256_METADATA_HEADER;
             static const Aws::String S3_SLOT_METADATA_HEADER;
             static const Aws::String S3_EPOCH_METADATA_HEADER;
+            static const Aws::String S3_UNCOMPRESSED_SIZE_METADATA_HEADER;
+            static const Aws::String S3_ETAG_HEADER;
+            static const Aws::String S3_IF_MATCH_HEADER;
+            static const Aws::String S3_IF_NONE_MATCH_HEADER;
+
+            // Compressed save files start with COMPRESSED_SLOT_MAGIC, a codec byte and the uncompressed size as a little-endian 64 bit integer.
+            static const std::string COMPRESSED_SLOT_MAGIC;
+            static const uint8_t COMPRESSED_SLOT_CODEC_DEFLATE = 1;
+            static const unsigned int COMPRESSED_SLOT_HEADER_SIZE = 13;
+
+            // Pre-signed S3 urls are reused until this long before they expire
+            static const unsigned int PRESIGNED_URL_SAFETY_MARGIN_SECONDS = 30;
+            static const std::string DOWNLOAD_URL_CACHE_PREFIX;
+            static const std::string UPLOAD_URL_CACHE_PREFIX;
+
+            // The slot metadata index starts with SLOT_METADATA_INDEX_MAGIC, SLOT_METADATA_INDEX_VERSION, the write sequence and the slot count,
+            // followed by one record per slot framed with its length and CRC. Every field has a fixed width.
+            // It is kept in two copies written in turn, the second copy's path ends with SLOT_METADATA_INDEX_SECOND_COPY_SUFFIX.
+            static const uint32_t SLOT_METADATA_INDEX_MAGIC = 0x4958534B;
+            static const uint32_t SLOT_METADATA_INDEX_VERSION = 2;
+            static const std::string SLOT_METADATA_INDEX_SECOND_COPY_SUFFIX;
             #pragma endregion
 
+            // One copy of the slot metadata index as it was read
+            struct SlotMetadataIndexCopy
+            {
+                uint64_t sequence = 0;
+                bool isComplete = true;
+                std::map<std::string, std::string> records;
+                std::vector<CachedSlot> slots;
+            };
+
+            struct PresignedUrl
+            {
+                std::string url;
+                std::string signedHeaders;
+                int64_t reusableUntilMs;
+            };
+
             Authentication::GameKitSessionManager* m_sessionManager;
             std::shared_ptr<Aws::Http::HttpClient> m_httpClient;
+            std::shared_ptr<Aws::Http::HttpClient> m_transferHttpClient; // sends and receives save files, only times out when a transfer stalls
             std::shared_ptr<Utils::ICurrentTimeProvider> m_currentTimeProvider;
             std::unordered_map<std::string, CachedSlot> m_syncedSlots;
-            std::mutex m_gameSavingMutex;
+
+            // Guards m_syncedSlots and m_slotMutexes only, it is never held during a request, a file operation or a callback
+            mutable std::mutex m_gameSavingMutex;
+
+            // Handed out by the backend with the last complete listing of the cloud slots, empty when the backend doesn't support change tokens. Guarded by m_gameSavingMutex.
+            std::string m_changeToken;
+
+            // Incremented by ClearSyncedSlots, a listing that started before a clear must not store its change token. Guarded by m_gameSavingMutex.
+            uint64_t m_syncedSlotsGeneration = 0;
+
+            // Serializes the operations on each slot, operations on different slots run concurrently
+            std::unordered_map<std::string, std::shared_ptr<std::mutex>> m_slotMutexes;
             Caller m_caller;
 
+            // Pre-signed S3 urls keyed by direction and slot name, LoadSlots() workers use them concurrently
+            std::unordered_map<std::string, PresignedUrl> m_presignedUrls;
+            std::mutex m_presignedUrlsMutex;
+
+            // Framed slot records of the slot metadata index keyed by slot name, an update only re-encodes the record of its slot.
+            // The index is not used while m_slotMetadataIndexPath is empty. Held while the index is written so concurrent updates don't interleave.
+            std::string m_slotMetadataIndexPath;
+            std::map<std::string, std::string> m_slotMetadataIndexRecords;
+            uint64_t m_slotMetadataIndexSequence = 0;
+            std::mutex m_slotMetadataIndexMutex;
+
             FileWriteCallback m_fileWriteCallback;
             FileReadCallback m_fileReadCallback;
             FileGetSizeCallback m_fileSizeCallback;
@@ -84,12 +155,39 @@ namespace GameKit
             DISPATCH_RECEIVER_HANDLE m_fileSizeDispatchReceiver;
 
             bool isPlayerLoggedIn(const std::string& methodName) const;
+
+            // Lists the cloud slots for GetAllSlotSyncStatuses(), or only the ones changed since m_changeToken for GetChangedSlotSyncStatuses().
+            unsigned int getSlotSyncStatuses(DISPATCH_RECEIVER_HANDLE receiver, GameSavingResponseCallback resultCb, bool waitForAllPages, unsigned int pageSize, bool changesOnly);
             unsigned int getSlotSyncStatusInternal(CachedSlot& slot);
             unsigned int validateSlotStatusForDownload(CachedSlot& slot, bool overrideSync) const;
-            unsigned int getPresignedS3UrlForSlot(const char* slotName, unsigned int urlTtl, std::string& returnedS3Url) const;
-            unsigned int downloadSlotFromS3(const std::string& presignedSlotDownloadUrl, std::shared_ptr<Aws::Http::HttpResponse>& returnedResponse) const;
+            unsigned int getPresignedS3UrlForSlot(const char* slotName, unsigned int urlTtl, std::string& returnedS3Url);
+
+            // Looks up a cached pre-signed url, it is only returned if it was signed for the same headers and is not close to expiring.
+            bool findPresignedUrl(const std::string& key, const std::string& signedHeaders, std::string& outUrl);
+            void cachePresignedUrl(const std::string& key, const std::string& signedHeaders, const std::string& url, unsigned int urlTtl);
+            void evictPresignedUrl(const std::string& key);
+
+            // Download a slot into the model's data buffer. outSlotStream is the response body when it was received straight into the buffer, null when it has to be copied there.
+            // Error responses are received into a scratch stream instead, the buffer is undefined when the download fails.
+            unsigned int downloadSlotFromS3(const std::string& presignedSlotDownloadUrl, GameSavingModel& model, std::shared_ptr<Aws::Http::HttpResponse>& returnedResponse, bool& outIsCompressed, Utils::OutputBufferStream*& outSlotStream) const;
+
+            // Requires m_gameSavingMutex to be held
             unsigned int addSlot(const std::string& slotName);
 
+            std::shared_ptr<std::mutex> getSlotMutex(const std::string& slotName);
+
+            // Copies a cached slot out of m_syncedSlots, operations work on the copy while their requests are in flight.
+            bool findCachedSlot(const std::string& slotName, CachedSlot& outSlot) const;
+
+            // Writes a copy back to m_syncedSlots, returns false if the slot was removed from the cache in the meantime.
+            bool storeCachedSlot(const CachedSlot& slot);
+
+            std::vector<CachedSlot> getCachedSlots() const;
+
+            // Runs update on a cached slot while holding its slot mutex, so listings merge into m_syncedSlots in between slot operations.
+            // The slot is added to the cache first when addIfMissing is set, otherwise returns false if it is not cached.
+            bool updateCachedSlot(const std::string& slotName, bool addIfMissing, const std::function<void(CachedSlot&)>& update);
+
             /**
              * @brief Loads an array of slot information files to the local slot cache.
              *
@@ -101,12 +199,53 @@ namespace GameKit
             /**
              * @brief Utility that saves the information about a slot to a local location.
              *
+             * @details When a slot metadata index is set, the slot's record in the index is updated instead and filePath is not used.
+             *
              * @param slot object containing the slot's information to save locally.
              * @param filePath a null terminated array of characters containing the absolute or relative path and filename where the slot data will be saved.
              * For example: "foo.json", "..\\foo.json", or "C:\\Program Files\\foo.json".
              * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
              */
-            unsigned int saveSlotInformation(const Slot& slot, const char* filePath);
+            unsigned int saveSlotInformation(const CachedSlot& slot, const char* filePath);
+
+            /**
+             * @brief Reads both copies of the slot metadata index, one read each, and keeps the newest copy that is intact.
+             *
+             * @param indexFilePath Path of the index file, missing or empty copies are an empty index.
+             * @param outIndex Receives the framed slot records keyed by slot name and the slots decoded from them. When neither copy is intact,
+             * the records of the newest copy before its first incomplete or corrupt one are kept.
+             * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+            */
+            unsigned int readSlotMetadataIndex(const std::string& indexFilePath, SlotMetadataIndexCopy& outIndex) const;
+
+            // Reads one copy of the slot metadata index. outExists is false when the copy is missing or empty.
+            unsigned int readSlotMetadataIndexCopy(const std::string& copyPath, SlotMetadataIndexCopy& outCopy, bool& outExists) const;
+
+            // Path of the copy of the slot metadata index that the write with this sequence goes to.
+            static std::string getSlotMetadataIndexCopyPath(const std::string& indexFilePath, uint64_t sequence);
+
+            /**
+             * @brief Replaces the slot's record in the slot metadata index, then writes the index. Requires m_slotMetadataIndexMutex to be held.
+             *
+             * @param slot The slot to store, or only its name when isDeleted is true.
+             * @param isDeleted Removes the slot's record instead.
+             * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+            */
+            unsigned int updateSlotMetadataIndex(const CachedSlot& slot, bool isDeleted);
+
+            // Writes the header and every record of the slot metadata index over its older copy, so a write torn by a crash leaves the newer copy intact.
+            // Requires m_slotMetadataIndexMutex to be held.
+            unsigned int writeSlotMetadataIndex();
+
+            /**
+             * @brief Fetches the slot's sync status, then downloads it. Only touches the slot and the model, so LoadSlots() runs it on several slots at once.
+             *
+             * @param model a struct containing slot information and the data buffer to download the save information into.
+             * @param slot a copy of the slot's local information, merged back into the cached slots by the caller.
+             * @param outActualSlotSize actual size of the slot downloaded
+             * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+            */
+            unsigned int fetchStatusAndDownloadSlot(GameSavingModel& model, CachedSlot& slot, unsigned int& outActualSlotSize);
 
             /**
              * @brief Called by the game to download a slots data from the cloud, or for resolving a SHOULD_DOWNLOAD_CLOUD sync status. Slot status should
@@ -128,6 +267,44 @@ namespace GameKit
             */
             unsigned int uploadLocalSlot(GameSavingModel& model, CachedSlot& slot);
 
+            /**
+             * @brief Utility that decompresses a compressed save file into the model's data buffer and checks it against the SHA-256 of the uncompressed data.
+             *
+             * @param payload The compressed save file, starting with its header.
+             * @param providedSha SHA-256 of the uncompressed save file, as stored with it in the cloud.
+             * @param model a struct containing the data buffer to decompress the save file into.
+             * @param outActualSlotSize size of the decompressed save file
+             * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+            */
+            unsigned int readCompressedSlot(std::iostream& payload, const std::string& providedSha, GameSavingModel& model, unsigned int& outActualSlotSize) const;
+
+            /**
+             * @brief Called by SaveSlot() when GameSavingModel::conditionalWrite is not set. Saves the slot's information to a file, fetches its sync status, uploads it, then saves its information again.
+             *
+             * @param model a struct containing slot information and the data buffer with the save information to upload.
+             * @param slot object containing the slot's local information
+             * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+            */
+            unsigned int saveSlotAfterStatusCheck(GameSavingModel& model, CachedSlot& slot);
+
+            /**
+             * @brief Called by SaveSlot() when GameSavingModel::conditionalWrite is set. Uploads with the cloud save file's ETag as a precondition, then saves the slot's information to a file once.
+             * The sync status is only fetched first when the cloud save file's ETag is not known.
+             *
+             * @param model a struct containing slot information and the data buffer with the save information to upload.
+             * @param slot object containing the slot's local information
+             * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+            */
+            unsigned int saveSlotConditionally(GameSavingModel& model, CachedSlot& slot);
+
+            /**
+             * @brief Utility that copies the local information of a new save file into the slot.
+             *
+             * @param slot A reference to the local cached slot.
+             * @param model Information about the new save file.
+            */
+            void updateLocalSlotInformation(CachedSlot& slot, const GameSavingModel& model) const;
+
             /**
              * @brief Utility that updates the slot's local information, then saves it to a file, and then gets the updated sync status for the slot.
              *
@@ -148,6 +325,9 @@ namespace GameKit
 
             static bool isValidCallback(DISPATCH_RECEIVER_HANDLE receiver, void* resultCb);
             static std::string getSha256(std::iostream& buffer);
+            static bool compressSlotData(const uint8_t* data, unsigned int dataSize, std::vector<uint8_t>& outPayload);
+            static bool isCompressedSlotPayload(std::iostream& payload);
+            static std::string encodeSlotMetadataIndexRecord(const CachedSlot& slot);
             static void updateSlotFromJson(const JsonView& jsonBody, CachedSlot& returnedSlot);
             static void updateSlotSyncStatus(CachedSlot& returnedSlot);
             static void markSlotAsSyncedWithLocal(CachedSlot& returnedSlot);
@@ -165,13 +345,16 @@ namespace GameKit
             void AddLocalSlots(const char* const* localSlotInformationFilePaths, unsigned int arraySize) override;
             void SetFileActions(FileActions fileActions) override;
             unsigned int GetAllSlotSyncStatuses(DISPATCH_RECEIVER_HANDLE receiver, GameSavingResponseCallback resultCb, bool waitForAllPages, unsigned int pageSize) override;
+            unsigned int GetChangedSlotSyncStatuses(DISPATCH_RECEIVER_HANDLE receiver, GameSavingResponseCallback resultCb, bool waitForAllPages, unsigned int pageSize) override;
             unsigned int GetSlotSyncStatus(DISPATCH_RECEIVER_HANDLE receiver, GameSavingSlotActionResponseCallback resultCb, const char* slotName) override;
             unsigned int DeleteSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingSlotActionResponseCallback resultCb, const char* slotName) override;
             unsigned int SaveSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingSlotActionResponseCallback resultCb, GameSavingModel model) override;
             unsigned int LoadSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingDataResponseCallback resultCb, GameSavingModel model) override;
+            unsigned int LoadSlots(DISPATCH_RECEIVER_HANDLE receiver, GameSavingDataResponseCallback slotResultCb, GameSavingResponseCallback completionCb, const GameSavingModel* models, unsigned int modelCount, unsigned int maxConcurrentTransfers) override;
+            unsigned int SetSlotMetadataIndex(const char* indexFilePath) override;
 
             /**
-             * @brief Getter that returns the cached hash of synced slots. Should be used for testing only.
+             * @brief Getter that returns the cached hash of synced slots. Should be used for testing only, it is not safe to call while other operations are running.
              *
              * @return Hash of slot objects hashed by their slot name.
             */
@@ -185,11 +368,20 @@ namespace GameKit
             */
             void ClearSyncedSlots()
             {
-                m_syncedSlots.clear();
+                {
+                    std::lock_guard<std::mutex> slotsGuard(m_gameSavingMutex);
+                    m_syncedSlots.clear();
+                    m_changeToken.clear();
+                    ++m_syncedSlotsGeneration;
+                }
+
+                // The cached pre-signed urls belong to the previous user
+                std::lock_guard<std::mutex> guard(m_presignedUrlsMutex);
+                m_presignedUrls.clear();
             }
 
             /**
-             * @brief Sets the Http client to use for this feature. Should be used for testing only.
+             * @brief Sets the Http client to use for this feature's API calls. Should be used for testing only.
              *
              * @param httpClient Shared pointer to an http client for this feature to use.
             */
@@ -198,6 +390,16 @@ namespace GameKit
                 m_httpClient = httpClient;
             }
 
+            /**
+             * @brief Sets the Http client to use for uploading and downloading save files. Should be used for testing only.
+             *
+             * @param httpClient Shared pointer to an http client for this feature to use.
+            */
+            void SetTransferHttpClient(std::shared_ptr<Aws::Http::HttpClient> httpClient)
+            {
+                m_transferHttpClient = httpClient;
+            }
+
             /**
              * @brief Sets the CurrentTimeProvider to use for this feature. Should be used for testing only.
              *
@@ -215,6 +417,7 @@ namespace GameKit
             */
             void AddLocalSlot(const Slot& slot)
             {
+                std::lock_guard<std::mutex> guard(m_gameSavingMutex);
                 m_syncedSlots[slot.slotName] = slot;
             }
         };
@@ -4,6 +4,7 @@
 #pragma once
 
 // Standard Library
+#include <cstdint>
 #include <string>
 
 // AWS SDK
@@ -12,6 +13,7 @@
 
 // GameKit
 #include <aws/gamekit/core/internal/platform_string.h>
+#include <aws/gamekit/core/utils/gamekit_httpclient_types.h>
 #include <aws/gamekit/game-saving/gamekit_game_saving_models.h>
 
 using namespace Aws::Utils::Json;
@@ -41,6 +43,21 @@ namespace GameKit
                     && json.KeyExists("slotSyncStatus") && json.ValueExists("slotSyncStatus");
             }
 
+            // Strings in the binary form are written with a 32 bit length, so it reads the same on 32 and 64 bit platforms
+            static void writeBinaryString(std::ostream& os, const std::string& s)
+            {
+                Utils::Serialization::BinWrite(os, static_cast<uint32_t>(s.size()));
+                os.write(s.data(), (std::streamsize)s.size());
+            }
+
+            static void readBinaryString(std::istream& is, std::string& s)
+            {
+                uint32_t length = 0;
+                Utils::Serialization::BinRead(is, length);
+                s.assign(is.fail() ? 0 : length, '\0');
+                is.read(&s[0], (std::streamsize)s.size());
+            }
+
         public:
             std::string slotName;
             std::string metadataLocal;
@@ -55,6 +72,9 @@ namespace GameKit
 
             SlotSyncStatus slotSyncStatus;
 
+            // S3 ETag of the cloud save file this device last uploaded or downloaded, empty when not known
+            std::string cloudETag;
+
             CachedSlot() :
                 slotName(std::string()),
                 metadataLocal(std::string()),
@@ -109,7 +129,61 @@ namespace GameKit
                     .WithInt64("lastModifiedLocal", lastModifiedLocal.Millis())
                     .WithInt64("lastModifiedCloud", lastModifiedCloud.Millis())
                     .WithInt64("lastSync", lastSync.Millis())
-                    .WithInteger("slotSyncStatus", static_cast<int>(slotSyncStatus));
+                    .WithInteger("slotSyncStatus", static_cast<int>(slotSyncStatus))
+                    .WithString("cloudETag", ToAwsString(cloudETag));
+            }
+
+            // Compact form of the slot stored in the slot metadata index, see GameKitSetSlotMetadataIndex(). Every field has a fixed width.
+            void ToBinary(std::ostream& os) const
+            {
+                writeBinaryString(os, slotName);
+                writeBinaryString(os, metadataLocal);
+                writeBinaryString(os, metadataCloud);
+                Utils::Serialization::BinWrite(os, static_cast<int64_t>(sizeLocal));
+                Utils::Serialization::BinWrite(os, static_cast<int64_t>(sizeCloud));
+                Utils::Serialization::BinWrite(os, static_cast<int64_t>(lastModifiedLocal.Millis()));
+                Utils::Serialization::BinWrite(os, static_cast<int64_t>(lastModifiedCloud.Millis()));
+                Utils::Serialization::BinWrite(os, static_cast<int64_t>(lastSync.Millis()));
+                Utils::Serialization::BinWrite(os, static_cast<int32_t>(slotSyncStatus));
+                writeBinaryString(os, cloudETag);
+            }
+
+            // Reads a slot written by ToBinary(). The stream must hold a record whose CRC was already checked, string lengths are trusted.
+            bool FromBinary(std::istream& is)
+            {
+                int64_t lastModifiedLocalMillis = 0;
+                int64_t lastModifiedCloudMillis = 0;
+                int64_t lastSyncMillis = 0;
+                int32_t status = 0;
+
+                readBinaryString(is, slotName);
+                readBinaryString(is, metadataLocal);
+                readBinaryString(is, metadataCloud);
+                Utils::Serialization::BinRead(is, sizeLocal);
+                Utils::Serialization::BinRead(is, sizeCloud);
+                Utils::Serialization::BinRead(is, lastModifiedLocalMillis);
+                Utils::Serialization::BinRead(is, lastModifiedCloudMillis);
+                Utils::Serialization::BinRead(is, lastSyncMillis);
+                Utils::Serialization::BinRead(is, status);
+
+                // Records written before the ETag was kept end after the status
+                cloudETag.clear();
+                if (!is.fail() && is.peek() != std::char_traits<char>::eof())
+                {
+                    readBinaryString(is, cloudETag);
+                }
+
+                if (is.fail())
+                {
+                    return false;
+                }
+
+                lastModifiedLocal = lastModifiedLocalMillis;
+                lastModifiedCloud = lastModifiedCloudMillis;
+                lastSync = lastSyncMillis;
+                slotSyncStatus = static_cast<SlotSyncStatus>(status);
+
+                return true;
             }
 
             unsigned int FromJson(const JsonValue& json)
@@ -128,6 +202,9 @@ namespace GameKit
                     lastSync = view.GetInt64("lastSync");
                     slotSyncStatus = static_cast<SlotSyncStatus>(view.GetInteger("slotSyncStatus"));
 
+                    // Slot information files written before the ETag was kept don't have it
+                    cloudETag = view.KeyExists("cloudETag") ? ToStdString(view.GetString("cloudETag")) : std::string();
+
                     return GAMEKIT_SUCCESS;
                 }
                 else
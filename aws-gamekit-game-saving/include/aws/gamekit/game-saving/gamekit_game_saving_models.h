@@ -7,6 +7,8 @@
 #include <aws/gamekit/core/exports.h>
 
 #define S3_PRESIGNED_URL_DEFAULT_TIME_TO_LIVE_SECONDS 120
+#define S3_UPLOAD_DEFAULT_MAX_ATTEMPTS 3
+#define LOAD_SLOTS_DEFAULT_MAX_CONCURRENT_TRANSFERS 4
 
 extern "C"
 {
@@ -217,6 +219,8 @@ extern "C"
          *
          * Alternative to caching, you can call GameKitGetSlotSyncStatus(slotName) to get the size of the cloud file.
          * However, this has extra latency compared to caching the results of the previous Game Saving API call.
+         *
+         * The save file is received straight into this array and checked afterwards, so its contents are undefined when LoadSlot fails.
          */
         uint8_t* data = nullptr;
 
@@ -239,6 +243,34 @@ extern "C"
          * (SaveSlot & LoadSlot - Optional) Whether to use "Consistent Read" when querying from DynamoDB. Defaults to true.
          */
         bool consistentRead = true;
+
+        /**
+         * (SaveSlot - Optional) How many times to try uploading the save file to the cloud when the upload fails with a transient error, such as a dropped connection. Defaults to 3.
+         *
+         * Every attempt uses the same pre-signed S3 url, so all attempts must start within `urlTimeToLive`. A value of 0 is treated as 1.
+         * Each attempt sends the whole save file again. Multipart uploads that resume from the last uploaded part need backend support and are not implemented yet.
+         */
+        unsigned int maxUploadAttempts = S3_UPLOAD_DEFAULT_MAX_ATTEMPTS;
+
+        /**
+         * (SaveSlot - Optional) Whether to compress the save file with deflate before uploading it. Defaults to false.
+         *
+         * The save file is only uploaded compressed when that makes it smaller. Its SHA-256 and the slot sizes are still those of the uncompressed data,
+         * and LoadSlot decompresses it into `data` whatever this flag is set to. Versions of the SDK that predate this flag cannot load a compressed save file.
+         * The uncompressed size is sent with the save file as signed S3 metadata, so Slot::sizeCloud remains the buffer size LoadSlot needs.
+         */
+        bool compressData = false;
+
+        /**
+         * (SaveSlot - Optional) Whether to upload without fetching the slot's sync status first. Defaults to false.
+         *
+         * The sync status is worked out from the cached slot, and the S3 upload is made conditional on the cloud save file being the one this device last uploaded or downloaded,
+         * identified by its ETag, or on there being none when the cached slot has no cloud save file. S3 refuses the upload when the cloud slot changed since,
+         * which is reported as GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT, so a save takes two requests instead of three.
+         * A slot whose cloud save file was never uploaded or downloaded by this device has no known ETag, its first save still fetches the sync status.
+         * The upload url request also carries the cloud slot's expected last modified time. The SaveInfo.json file is written once, after the upload, instead of before and after it.
+         */
+        bool conditionalWrite = false;
     };
 
     /**
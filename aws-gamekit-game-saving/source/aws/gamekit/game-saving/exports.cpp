@@ -34,6 +34,11 @@ void GameKitSetFileActions(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstanc
     return static_cast<GameSaving*>(gameSavingInstance)->SetFileActions(fileActions);
 }
 
+unsigned int GameKitSetSlotMetadataIndex(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, const char* indexFilePath)
+{
+    return static_cast<GameSaving*>(gameSavingInstance)->SetSlotMetadataIndex(indexFilePath);
+}
+
 unsigned int GameKitGetAllSlotSyncStatuses(
     GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance,
     DISPATCH_RECEIVER_HANDLE receiver,
@@ -44,6 +49,16 @@ unsigned int GameKitGetAllSlotSyncStatuses(
     return static_cast<GameSaving*>(gameSavingInstance)->GetAllSlotSyncStatuses(receiver, resultCb, waitForAllPages, pageSize);
 }
 
+unsigned int GameKitGetChangedSlotSyncStatuses(
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance,
+    DISPATCH_RECEIVER_HANDLE receiver,
+    GameSavingResponseCallback resultCb,
+    bool waitForAllPages,
+    unsigned int pageSize)
+{
+    return static_cast<GameSaving*>(gameSavingInstance)->GetChangedSlotSyncStatuses(receiver, resultCb, waitForAllPages, pageSize);
+}
+
 unsigned int GameKitGetSlotSyncStatus(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, GameSavingSlotActionResponseCallback resultCb, const char* slotName)
 {
     return static_cast<GameSaving*>(gameSavingInstance)->GetSlotSyncStatus(receiver, resultCb, slotName);
@@ -64,6 +79,11 @@ unsigned int GameKitLoadSlot(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInsta
     return static_cast<GameSaving*>(gameSavingInstance)->LoadSlot(receiver, resultCb, model);
 }
 
+unsigned int GameKitLoadSlots(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance, DISPATCH_RECEIVER_HANDLE receiver, GameSavingDataResponseCallback slotResultCb, GameSavingResponseCallback completionCb, const GameSavingModel* models, unsigned int modelCount, unsigned int maxConcurrentTransfers)
+{
+    return static_cast<GameSaving*>(gameSavingInstance)->LoadSlots(receiver, slotResultCb, completionCb, models, modelCount, maxConcurrentTransfers);
+}
+
 void GameKitGameSavingInstanceRelease(GAMEKIT_GAME_SAVING_INSTANCE_HANDLE gameSavingInstance)
 {
     delete static_cast<GameSaving*>(gameSavingInstance);
@@ -1,12 +1,24 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <set>
+#include <sstream>
+#include <thread>
+
 // AWS SDK
 #include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpResponse.h>
 #include <aws/core/utils/StringUtils.h>
 
 // GameKit
 #include <aws/gamekit/core/internal/platform_string.h>
+#include <aws/gamekit/core/utils/buffer_stream.h>
+#include <aws/gamekit/core/utils/compression_utils.h>
 #include <aws/gamekit/game-saving/gamekit_game_saving.h>
 
 // Workaround for conflict with user.h PAGE_SIZE macro when compiling for Android
@@ -19,6 +31,56 @@ using namespace GameKit::GameSaving;
 using namespace GameKit::Logger;
 using namespace GameKit::Utils;
 
+namespace
+{
+    // A slot downloaded by LoadSlots(), owned by the worker that downloads it until the calling thread reports it
+    struct SlotLoad
+    {
+        GameSavingModel model;
+        CachedSlot slot;
+        unsigned int actualSlotSize = 0;
+        unsigned int status = GameKit::GAMEKIT_SUCCESS;
+    };
+
+    // Records of the slot metadata index are framed with a 32 bit length and CRC, so the file reads the same on 32 and 64 bit platforms
+    void writeSlotMetadataIndexRecord(std::ostream& os, const std::string& record)
+    {
+        Serialization::BinWrite(os, static_cast<uint32_t>(record.size()));
+        os.write(record.data(), (std::streamsize)record.size());
+        Serialization::BinWrite(os, static_cast<uint32_t>(Serialization::GetCRC(record)));
+    }
+
+    // Returns false if the record is incomplete or its CRC does not match, otherwise outRecord points into data and offset is moved past the record
+    bool tryReadSlotMetadataIndexRecord(const char* data, size_t size, size_t& offset, const char*& outRecord, size_t& outLength)
+    {
+        uint32_t length = 0;
+        uint32_t crc = 0;
+        if (offset > size || size - offset < sizeof(length))
+        {
+            return false;
+        }
+
+        memcpy(&length, data + offset, sizeof(length));
+        const size_t remaining = size - offset - sizeof(length);
+        if (length > remaining || remaining - length < sizeof(crc))
+        {
+            return false;
+        }
+
+        const char* record = data + offset + sizeof(length);
+        memcpy(&crc, record + length, sizeof(crc));
+        if (crc != static_cast<uint32_t>(Serialization::GetCRC(record, length)))
+        {
+            return false;
+        }
+
+        outRecord = record;
+        outLength = length;
+        offset += sizeof(length) + length + sizeof(crc);
+        return true;
+    }
+}
+
 #pragma region Constants
 const std::string GameSaving::START_KEY = "start_key";
 const std::string GameSaving::PAGING_TOKEN = "paging_token";
@@ -26,11 +88,22 @@ const std::string GameSaving::PAGE_SIZE = "page_size";
 const std::string GameSaving::METADATA = "metadata";
 const std::string GameSaving::HASH = "hash";
 const std::string GameSaving::LAST_MODIFIED_EPOCH_TIME = "last_modified_epoch_time";
+const std::string GameSaving::UNCOMPRESSED_SIZE = "uncompressed_size";
+const std::string GameSaving::EXPECTED_LAST_MODIFIED_EPOCH_TIME = "expected_last_modified_epoch_time";
 const std::string GameSaving::TIME_TO_LIVE = "time_to_live";
 const std::string GameSaving::CONSISTENT_READ = "consistent_read";
+const std::string GameSaving::CHANGE_TOKEN = "change_token";
 const Aws::String GameSaving::S3_SHA_256_METADATA_HEADER = "x-amz-meta-hash";
 const Aws::String GameSaving::S3_SLOT_METADATA_HEADER = "x-amz-meta-slot_metadata";
 const Aws::String GameSaving::S3_EPOCH_METADATA_HEADER = "x-amz-meta-epoch";
+const Aws::String GameSaving::S3_UNCOMPRESSED_SIZE_METADATA_HEADER = "x-amz-meta-uncompressed_size";
+const Aws::String GameSaving::S3_ETAG_HEADER = "etag";
+const Aws::String GameSaving::S3_IF_MATCH_HEADER = "if-match";
+const Aws::String GameSaving::S3_IF_NONE_MATCH_HEADER = "if-none-match";
+const std::string GameSaving::COMPRESSED_SLOT_MAGIC = "GKSZ";
+const std::string GameSaving::DOWNLOAD_URL_CACHE_PREFIX = "download/";
+const std::string GameSaving::UPLOAD_URL_CACHE_PREFIX = "upload/";
+const std::string GameSaving::SLOT_METADATA_INDEX_SECOND_COPY_SUFFIX = ".2";
 const long TIMEOUT = 5000; // 5 seconds
 #pragma endregion
 
@@ -58,6 +131,12 @@ GameSaving::GameSaving(Authentication::GameKitSessionManager* sessionManager, Fu
     clientConfig.requestTimeoutMs = TIMEOUT;
     m_httpClient = Aws::Http::CreateHttpClient(clientConfig);
 
+    // Save files can take longer than TIMEOUT to transfer on a slow connection. Their client has no limit on the duration of a request,
+    // requestTimeoutMs still fails a transfer that stops making progress.
+    Aws::Client::ClientConfiguration transferClientConfig = clientConfig;
+    transferClientConfig.httpRequestTimeoutMs = 0;
+    m_transferHttpClient = Aws::Http::CreateHttpClient(transferClientConfig);
+
     m_currentTimeProvider = std::make_shared<Utils::AwsCurrentTimeProvider>();
 
     m_caller.Initialize(m_sessionManager, logCb, &m_httpClient);
@@ -92,111 +171,18 @@ void GameKit::GameSaving::GameSaving::SetFileActions(FileActions fileActions)
 
 unsigned int GameSaving::GetAllSlotSyncStatuses(DISPATCH_RECEIVER_HANDLE receiver, GameSavingResponseCallback resultCb, bool waitForAllPages, unsigned int pageSize)
 {
-    if (!m_sessionManager->AreSettingsLoaded(FeatureType::GameStateCloudSaving))
-    {
-        return GAMEKIT_ERROR_SETTINGS_MISSING;
-    }
-
-    // to make this function thread safe, lock it behind a mutex
-    std::lock_guard<std::mutex> guard(m_gameSavingMutex);
-
-    if (!isPlayerLoggedIn("GetAllSlotSyncStatuses"))
-    {
-        return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_NO_ID_TOKEN);
-    }
-
-    // assume all cached slots are not on the cloud, set all of their status to SlotSyncStatus::SHOULD_UPLOAD_LOCAL
-    for (std::pair<std::string, CachedSlot> slot : m_syncedSlots)
-    {
-        m_syncedSlots.at(slot.first).slotSyncStatus = SlotSyncStatus::SHOULD_UPLOAD_LOCAL;
-    }
-
-    const std::string uri = m_sessionManager->GetClientSettings()[ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL];
-
-    // apply bounds to pageSize
-    pageSize = pageSize > MAX_PAGE_SIZE ? MAX_PAGE_SIZE : pageSize;
-
-    std::unordered_set<std::string> slotsFromCloud;
-    Aws::String startKey, pagingToken;
-    do
-    {
-        Caller::CallerParams queryString;
-
-        if (!startKey.empty())
-        {
-            queryString[START_KEY] = ToStdString(startKey);
-        }
-
-        if (!pagingToken.empty())
-        {
-            queryString[PAGING_TOKEN] = ToStdString(pagingToken);
-        }
-
-        if (pageSize > 0)
-        {
-            queryString[PAGE_SIZE] = std::to_string(pageSize);
-        }
-
-        JsonValue jsonBody;
-        unsigned int returnCode = m_caller.CallApiGateway(uri, Aws::Http::HttpMethod::HTTP_GET, "GetAllSlotSyncStatuses", jsonBody, queryString);
-        if (returnCode != GameKit::GAMEKIT_SUCCESS)
-        {
-            return invokeCallback(receiver, resultCb, returnCode);
-        }
-
-        Aws::Utils::Array<JsonView> jsonArray = jsonBody.View().GetObject("data").GetArray("slots_metadata");
-
-        std::vector<Slot> returnedSlotList;
-        for (size_t i = 0; i < jsonArray.GetLength(); ++i)
-        {
-            const std::string name = ToStdString(jsonArray.GetItem(i).GetString("slot_name"));
-
-            CachedSlot& slot = m_syncedSlots[name];
-
-            slot.slotName = name;
-
-            updateSlotFromJson(jsonArray.GetItem(i), slot);
-            updateSlotSyncStatus(slot);
-
-            returnedSlotList.push_back(slot);
-            slotsFromCloud.insert(slot.slotName);
-        }
-
-        JsonView jsonView = jsonBody.View().GetObject("paging");
-        if (jsonView.KeyExists("next_start_key"))
-        {
-            JsonView nextKey = jsonView.GetObject("next_start_key");
-            startKey = nextKey.GetString("slot_name");
-            if (!jsonView.KeyExists(ToAwsString(PAGING_TOKEN)))
-            {
-                Logging::Log(m_logCb, Level::Error, "paging_token missing from response with next_start_key");
-                pagingToken = "";
-            }
-            else
-            {
-                pagingToken = jsonView.GetString(ToAwsString(PAGING_TOKEN));
-            }
-
-            if (!waitForAllPages)
-            {
-                // pass in the list of slots that have been updated for this page
-                invokeCallback(receiver, resultCb, returnedSlotList);
-            }
-        }
-        else
-        {
-            startKey.clear();
-        }
-    } while (!startKey.empty());
+    const bool changesOnly = false;
+    return getSlotSyncStatuses(receiver, resultCb, waitForAllPages, pageSize, changesOnly);
+}
 
-    return invokeCallback(receiver, resultCb, waitForAllPages, slotsFromCloud);
+unsigned int GameSaving::GetChangedSlotSyncStatuses(DISPATCH_RECEIVER_HANDLE receiver, GameSavingResponseCallback resultCb, bool waitForAllPages, unsigned int pageSize)
+{
+    const bool changesOnly = true;
+    return getSlotSyncStatuses(receiver, resultCb, waitForAllPages, pageSize, changesOnly);
 }
 
 unsigned int GameSaving::GetSlotSyncStatus(DISPATCH_RECEIVER_HANDLE receiver, GameSavingSlotActionResponseCallback resultCb, const char* slotName)
 {
-    // to make this function thread safe, lock it behind a mutex
-    std::lock_guard<std::mutex> guard(m_gameSavingMutex);
-
     if (!isPlayerLoggedIn("GetSlotSyncStatus"))
     {
         return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_NO_ID_TOKEN);
@@ -209,20 +195,24 @@ unsigned int GameSaving::GetSlotSyncStatus(DISPATCH_RECEIVER_HANDLE receiver, Ga
         return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_GAME_SAVING_MALFORMED_SLOT_NAME);
     }
 
-    const auto foundSlot = m_syncedSlots.find(slotName);
-    if (foundSlot == m_syncedSlots.end())
+    // to make this function thread safe, lock the slot behind its mutex, other slots are not blocked
+    const std::shared_ptr<std::mutex> slotMutex = getSlotMutex(slotName);
+    std::lock_guard<std::mutex> slotGuard(*slotMutex);
+
+    CachedSlot slot;
+    if (!findCachedSlot(slotName, slot))
     {
         const std::string errorMessage = "Error: GameSaving::GetSlotSyncStatus() no cached slot found: " + std::string(slotName);
         Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
         return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND);
     }
-    CachedSlot& slot = m_syncedSlots.at(slotName);
 
     const unsigned int status = getSlotSyncStatusInternal(slot);
     if (status != GAMEKIT_SUCCESS) {
         return invokeCallback(receiver, resultCb, status);
     }
 
+    storeCachedSlot(slot);
     return invokeCallback(receiver, resultCb, GAMEKIT_SUCCESS, slot);
 }
 
@@ -233,9 +223,6 @@ unsigned int GameSaving::DeleteSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavin
         return GAMEKIT_ERROR_SETTINGS_MISSING;
     }
 
-    // to make this function thread safe, lock it behind a mutex
-    std::lock_guard<std::mutex> guard(m_gameSavingMutex);
-
     if (!isPlayerLoggedIn("DeleteSlot"))
     {
         return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_NO_ID_TOKEN);
@@ -248,8 +235,12 @@ unsigned int GameSaving::DeleteSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavin
         return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_GAME_SAVING_MALFORMED_SLOT_NAME);
     }
 
-    const auto foundSlot = m_syncedSlots.find(slotName);
-    if (foundSlot == m_syncedSlots.end())
+    // to make this function thread safe, lock the slot behind its mutex, other slots are not blocked
+    const std::shared_ptr<std::mutex> slotMutex = getSlotMutex(slotName);
+    std::lock_guard<std::mutex> slotGuard(*slotMutex);
+
+    CachedSlot deletedSlot;
+    if (!findCachedSlot(slotName, deletedSlot))
     {
         const std::string errorMessage = "Error: GameSaving::DeleteSlot() no cached slot found: " + std::string(slotName);
         Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
@@ -265,18 +256,29 @@ unsigned int GameSaving::DeleteSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavin
         return invokeCallback(receiver, resultCb, returnCode);
     }
 
-    const auto deletedSlot = m_syncedSlots.at(slotName);
+    {
+        std::lock_guard<std::mutex> guard(m_gameSavingMutex);
+        m_syncedSlots.erase(slotName);
+    }
     const auto deletedSlotCopy = Slot(deletedSlot);
-    m_syncedSlots.erase(slotName);
+    evictPresignedUrl(DOWNLOAD_URL_CACHE_PREFIX + slotName);
+    evictPresignedUrl(UPLOAD_URL_CACHE_PREFIX + slotName);
+
+    {
+        // The slot is gone from the cloud either way, a failure to update the index is only logged
+        std::lock_guard<std::mutex> guard(m_slotMetadataIndexMutex);
+        if (!m_slotMetadataIndexPath.empty())
+        {
+            const bool isDeleted = true;
+            updateSlotMetadataIndex(deletedSlot, isDeleted);
+        }
+    }
 
     return invokeCallback(receiver, resultCb, GAMEKIT_SUCCESS, deletedSlotCopy);
 }
 
 unsigned int GameSaving::SaveSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingSlotActionResponseCallback resultCb, GameSavingModel model)
 {
-    // To make this function thread safe, lock it behind a mutex
-    std::lock_guard<std::mutex> guard(m_gameSavingMutex);
-
     if (!isPlayerLoggedIn("SaveSlot"))
     {
         return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_NO_ID_TOKEN);
@@ -289,31 +291,30 @@ unsigned int GameSaving::SaveSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingS
         return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_GAME_SAVING_MALFORMED_SLOT_NAME);
     }
 
-    // Add the slot if it isn't present
-    unsigned int status = addSlot(model.slotName);
-    if (status != GAMEKIT_SUCCESS)
-    {
-        return invokeCallback(receiver, resultCb, status);
-    }
-
-    CachedSlot& slot = m_syncedSlots.at(model.slotName);
+    // To make this function thread safe, lock the slot behind its mutex, other slots are not blocked
+    const std::shared_ptr<std::mutex> slotMutex = getSlotMutex(model.slotName);
+    std::lock_guard<std::mutex> slotGuard(*slotMutex);
 
-    // Update the slot's local information, save it to a file, then get the the updated sync status from the cloud.
-    status = updateLocalSlotStatus(slot, model);
-    if (status != GAMEKIT_SUCCESS)
+    // Add the slot if it isn't present, then work on a copy so the cached slots stay available during the upload
+    CachedSlot slot;
+    unsigned int status = GAMEKIT_SUCCESS;
     {
-        return invokeCallback(receiver, resultCb, status);
+        std::lock_guard<std::mutex> guard(m_gameSavingMutex);
+        status = addSlot(model.slotName);
+        if (status == GAMEKIT_SUCCESS)
+        {
+            slot = m_syncedSlots.at(model.slotName);
+        }
     }
 
-    // Upload the save from the provided buffer, get the new sync status.
-    status = uploadLocalSlot(model, slot);
     if (status != GAMEKIT_SUCCESS)
     {
         return invokeCallback(receiver, resultCb, status);
     }
 
-    // Re-save the metadata with the new sync status and modified times
-    status = saveSlotInformation(slot, model.localSlotInformationFilePath);
+    // Upload with or without fetching the sync status first, the slot keeps its new local information even if the upload fails
+    status = model.conditionalWrite ? saveSlotConditionally(model, slot) : saveSlotAfterStatusCheck(model, slot);
+    storeCachedSlot(slot);
     if (status != GAMEKIT_SUCCESS)
     {
         return invokeCallback(receiver, resultCb, status);
@@ -324,9 +325,6 @@ unsigned int GameSaving::SaveSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingS
 
 unsigned int GameSaving::LoadSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingDataResponseCallback resultCb, GameSavingModel model)
 {
-    // To make this function thread safe, lock it behind a mutex
-    std::lock_guard<std::mutex> guard(m_gameSavingMutex);
-
     if (!isPlayerLoggedIn("LoadSlot"))
     {
         return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_NO_ID_TOKEN);
@@ -339,32 +337,29 @@ unsigned int GameSaving::LoadSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingD
         return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_GAME_SAVING_MALFORMED_SLOT_NAME);
     }
 
-    const auto foundSlot = m_syncedSlots.find(model.slotName);
-    if (foundSlot == m_syncedSlots.end())
+    // To make this function thread safe, lock the slot behind its mutex, other slots are not blocked
+    const std::shared_ptr<std::mutex> slotMutex = getSlotMutex(model.slotName);
+    std::lock_guard<std::mutex> slotGuard(*slotMutex);
+
+    CachedSlot slot;
+    if (!findCachedSlot(model.slotName, slot))
     {
         const std::string errorMessage = "Error: GameSaving::LoadSlot() no cached slot found: " + std::string(model.slotName);
         Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
         return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND);
     }
-    CachedSlot& slot = m_syncedSlots.at(model.slotName);
-
-    // Fetch the current slot sync status - important to make sure our slot information is up to date
-    const unsigned int returnCode = getSlotSyncStatusInternal(slot);
-    if (returnCode != GAMEKIT_SUCCESS)
-    {
-        return invokeCallback(receiver, resultCb, returnCode);
-    }
 
     // Download the requested slot from the cloud, update its sync information and times
     unsigned int outActualSlotSize = 0;
-    unsigned int status = downloadCloudSlot(model, slot, outActualSlotSize);
+    unsigned int status = fetchStatusAndDownloadSlot(model, slot, outActualSlotSize);
+    storeCachedSlot(slot);
     if (status != GAMEKIT_SUCCESS)
     {
         return invokeCallback(receiver, resultCb, status);
     }
 
     // save the newly updated metadata to the provided filepath
-    status = saveSlotInformation(m_syncedSlots.at(model.slotName), model.localSlotInformationFilePath);
+    status = saveSlotInformation(slot, model.localSlotInformationFilePath);
     if (status != GAMEKIT_SUCCESS)
     {
         return invokeCallback(receiver, resultCb, status);
@@ -373,89 +368,451 @@ unsigned int GameSaving::LoadSlot(DISPATCH_RECEIVER_HANDLE receiver, GameSavingD
     return invokeCallback(receiver, resultCb, GAMEKIT_SUCCESS, slot, model.data, outActualSlotSize);
 }
 
-#pragma endregion
-
-#pragma region Private Methods
-bool GameSaving::isPlayerLoggedIn(const std::string& methodName) const
+unsigned int GameSaving::LoadSlots(DISPATCH_RECEIVER_HANDLE receiver, GameSavingDataResponseCallback slotResultCb, GameSavingResponseCallback completionCb, const GameSavingModel* models, unsigned int modelCount, unsigned int maxConcurrentTransfers)
 {
-    const std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+    if (!isPlayerLoggedIn("LoadSlots"))
+    {
+        return invokeCallback(receiver, completionCb, GAMEKIT_ERROR_NO_ID_TOKEN);
+    }
 
-    if (idToken.empty())
+    std::vector<SlotLoad> loads(modelCount);
+    std::set<std::string> slotNames;
+    for (unsigned int i = 0; i < modelCount; ++i)
     {
-        const std::string message = "GameSaving::" + methodName + "() No ID token in session.";
-        Logging::Log(m_logCb, Level::Error, message.c_str());
-        return false;
+        SlotLoad& load = loads[i];
+        load.model = models[i];
+
+        if (!ValidationUtils::IsValidPrimaryIdentifier(load.model.slotName))
+        {
+            const std::string errorMessage = "Error: GameSaving::LoadSlots() malformed slot name: " + std::string(load.model.slotName) + ". Slot name" + GameKit::Utils::PRIMARY_IDENTIFIER_REQUIREMENTS_TEXT;
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            load.status = invokeCallback(receiver, slotResultCb, GAMEKIT_ERROR_GAME_SAVING_MALFORMED_SLOT_NAME);
+            continue;
+        }
+
+        slotNames.insert(load.model.slotName);
     }
 
-    return true;
-}
+    // Lock the slots for the whole batch, in name order so batches with overlapping slots cannot deadlock each other
+    std::vector<std::shared_ptr<std::mutex>> slotMutexes;
+    std::vector<std::unique_lock<std::mutex>> slotGuards;
+    for (const std::string& slotName : slotNames)
+    {
+        slotMutexes.push_back(getSlotMutex(slotName));
+        slotGuards.emplace_back(*slotMutexes.back());
+    }
 
-unsigned int GameSaving::getSlotSyncStatusInternal(CachedSlot& slot)
-{
-    if (!m_sessionManager->AreSettingsLoaded(FeatureType::GameStateCloudSaving))
+    // Each slot is downloaded into a copy of its cached slot, the copies are merged back on this thread
+    std::vector<unsigned int> pending;
+    for (unsigned int i = 0; i < modelCount; ++i)
     {
-        return GAMEKIT_ERROR_SETTINGS_MISSING;
+        SlotLoad& load = loads[i];
+        if (load.status != GAMEKIT_SUCCESS)
+        {
+            continue;
+        }
+
+        if (!findCachedSlot(load.model.slotName, load.slot))
+        {
+            const std::string errorMessage = "Error: GameSaving::LoadSlots() no cached slot found: " + std::string(load.model.slotName);
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            load.status = invokeCallback(receiver, slotResultCb, GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND);
+            continue;
+        }
+
+        pending.push_back(i);
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL] + "/" + slot.slotName;
+    std::mutex completedMutex;
+    std::condition_variable slotCompletedVar;
+    std::deque<unsigned int> completed;
+    std::atomic<size_t> nextPending(0);
 
-    JsonValue jsonBody;
-    unsigned int returnCode = m_caller.CallApiGateway(uri, Aws::Http::HttpMethod::HTTP_GET, "GetSlotSyncStatus", jsonBody);
-    if (returnCode != GAMEKIT_SUCCESS)
+    // Each worker takes the next pending slot until there are none left, so status, pre-signed url and S3 requests of different slots overlap
+    const auto worker = [&]()
     {
-        return returnCode;
+        for (size_t position = nextPending++; position < pending.size(); position = nextPending++)
+        {
+            SlotLoad& load = loads[pending[position]];
+            load.status = fetchStatusAndDownloadSlot(load.model, load.slot, load.actualSlotSize);
+
+            {
+                std::lock_guard<std::mutex> completedGuard(completedMutex);
+                completed.push_back(pending[position]);
+            }
+            slotCompletedVar.notify_one();
+        }
+    };
+
+    const size_t workerCount = std::min<size_t>(std::max(maxConcurrentTransfers, 1u), pending.size());
+    const std::string message = "GameSaving::LoadSlots() loading " + std::to_string(pending.size()) + " slots with " + std::to_string(workerCount) + " workers";
+    Logging::Log(m_logCb, Level::Verbose, message.c_str());
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back(worker);
     }
 
-    const std::string name = ToStdString(jsonBody.View().GetObject("data").GetString("slot_name"));
-    if (name == slot.slotName)
+    // Slots are reported on the calling thread as they complete, like the callbacks of every other Game Saving API
+    for (size_t reported = 0; reported < pending.size(); ++reported)
     {
-        // json entry found, update the slot cloud info
-        updateSlotFromJson(jsonBody.View().GetObject("data"), slot);
+        unsigned int index = 0;
+        {
+            std::unique_lock<std::mutex> completedLock(completedMutex);
+            slotCompletedVar.wait(completedLock, [&completed]() { return !completed.empty(); });
+            index = completed.front();
+            completed.pop_front();
+        }
+
+        // The copy holds the latest cloud information even when the download failed
+        SlotLoad& load = loads[index];
+        const CachedSlot& slot = load.slot;
+        if (!storeCachedSlot(slot))
+        {
+            // The cached slots were cleared while the slot was downloading
+            load.status = invokeCallback(receiver, slotResultCb, GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND);
+            continue;
+        }
+
+        if (load.status == GAMEKIT_SUCCESS)
+        {
+            load.status = saveSlotInformation(slot, load.model.localSlotInformationFilePath);
+        }
+
+        if (load.status == GAMEKIT_SUCCESS)
+        {
+            invokeCallback(receiver, slotResultCb, GAMEKIT_SUCCESS, slot, load.model.data, load.actualSlotSize);
+        }
+        else
+        {
+            invokeCallback(receiver, slotResultCb, load.status);
+        }
     }
-    else
+
+    for (std::thread& workerThread : workers)
     {
-        const std::string message = "Info: GameSaving::GetSlotSyncStatus() slot not found in cloud: " + slot.slotName;
-        Logging::Log(m_logCb, Level::Info, message.c_str());
+        workerThread.join();
     }
 
-    updateSlotSyncStatus(slot);
+    unsigned int batchStatus = GAMEKIT_SUCCESS;
+    for (const SlotLoad& load : loads)
+    {
+        if (load.status != GAMEKIT_SUCCESS)
+        {
+            batchStatus = load.status;
+            break;
+        }
+    }
 
-    return GAMEKIT_SUCCESS;
+    const std::vector<CachedSlot> cachedSlots = getCachedSlots();
+    std::vector<Slot> returnedSlotList(cachedSlots.begin(), cachedSlots.end());
+
+    const bool isFinalCall = true;
+    return invokeCallback(receiver, completionCb, returnedSlotList, isFinalCall, batchStatus);
 }
 
-unsigned int GameSaving::uploadLocalSlot(GameSavingModel& model, CachedSlot& slot)
+unsigned int GameSaving::SetSlotMetadataIndex(const char* indexFilePath)
 {
-    if (!m_sessionManager->AreSettingsLoaded(FeatureType::GameStateCloudSaving))
+    const std::string path = indexFilePath == nullptr ? std::string() : std::string(indexFilePath);
+
+    SlotMetadataIndexCopy index;
+    if (!path.empty())
     {
-        return GAMEKIT_ERROR_SETTINGS_MISSING;
+        const unsigned int status = readSlotMetadataIndex(path, index);
+        if (status != GAMEKIT_SUCCESS)
+        {
+            return status;
+        }
     }
-    // Validate metadata length
-    if (strlen(model.metadata) > MAX_METADATA_BYTES)
+
+    const std::vector<CachedSlot>& loadedSlots = index.slots;
+    std::lock_guard<std::mutex> indexGuard(m_slotMetadataIndexMutex);
+    m_slotMetadataIndexPath = path;
+    m_slotMetadataIndexRecords = std::move(index.records);
+    m_slotMetadataIndexSequence = index.sequence;
+
+    if (path.empty())
     {
-        std::stringstream max, found;
-        max << MAX_METADATA_BYTES;
-        found << strlen(model.metadata);
-        const std::string errorMessage = "Info: GameSaving::uploadLocalSlot() metadata is greater than max allowed size. Max Size: " + max.str() + " Bytes, Found Size: " + found.str() + " Bytes";
-        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
-        return GAMEKIT_ERROR_GAME_SAVING_EXCEEDED_MAX_SIZE;
+        Logging::Log(m_logCb, Level::Info, "GameSaving::SetSlotMetadataIndex() slot information is saved to one file per slot");
+        return GAMEKIT_SUCCESS;
     }
 
-    // convert the databuffer
-    const std::shared_ptr<Aws::IOStream> objectStream = Aws::MakeShared<Aws::StringStream>(model.slotName);
-    objectStream->write((char*)model.data, model.dataSize);
-    objectStream->flush();
-    unsigned int size = (unsigned int)objectStream->tellp();
-
-    if (!model.overrideSync)
+    // Slots that were already cached, for example from SaveInfo.json files, are moved into the index
+    std::vector<CachedSlot> slotsMissingFromIndex;
     {
-        // get the updated status for the slot and validate we should be uploading
-        std::string message;
-        switch (m_syncedSlots.at(model.slotName).slotSyncStatus)
+        std::lock_guard<std::mutex> guard(m_gameSavingMutex);
+        for (const CachedSlot& slot : loadedSlots)
         {
-        case SlotSyncStatus::SHOULD_DOWNLOAD_CLOUD:
-            message = "Info: GameSaving::uploadLocalSlot() cloud slot may be newer: " + std::string(model.slotName);
-            Logging::Log(m_logCb, Level::Info, message.c_str());
-            return GAMEKIT_ERROR_GAME_SAVING_CLOUD_SLOT_IS_NEWER;
+            m_syncedSlots[slot.slotName] = slot;
+        }
+
+        for (const auto& slotEntry : m_syncedSlots)
+        {
+            if (m_slotMetadataIndexRecords.find(slotEntry.first) == m_slotMetadataIndexRecords.end())
+            {
+                slotsMissingFromIndex.push_back(slotEntry.second);
+            }
+        }
+    }
+
+    const std::string message = "GameSaving::SetSlotMetadataIndex() loaded " + std::to_string(loadedSlots.size()) + " slots from slot metadata index " + path +
+        ", adding " + std::to_string(slotsMissingFromIndex.size()) + " cached slots to it";
+    Logging::Log(m_logCb, Level::Info, message.c_str());
+
+    if (slotsMissingFromIndex.empty())
+    {
+        return GAMEKIT_SUCCESS;
+    }
+
+    for (const CachedSlot& slot : slotsMissingFromIndex)
+    {
+        m_slotMetadataIndexRecords[slot.slotName] = encodeSlotMetadataIndexRecord(slot);
+    }
+
+    // The slots are cached either way, a failure to write them is only logged and the next update retries
+    writeSlotMetadataIndex();
+    return GAMEKIT_SUCCESS;
+}
+
+#pragma endregion
+
+#pragma region Private Methods
+unsigned int GameSaving::getSlotSyncStatuses(DISPATCH_RECEIVER_HANDLE receiver, GameSavingResponseCallback resultCb, bool waitForAllPages, unsigned int pageSize, bool changesOnly)
+{
+    if (!m_sessionManager->AreSettingsLoaded(FeatureType::GameStateCloudSaving))
+    {
+        return GAMEKIT_ERROR_SETTINGS_MISSING;
+    }
+
+    const std::string methodName = changesOnly ? "GetChangedSlotSyncStatuses" : "GetAllSlotSyncStatuses";
+    if (!isPlayerLoggedIn(methodName))
+    {
+        return invokeCallback(receiver, resultCb, GAMEKIT_ERROR_NO_ID_TOKEN);
+    }
+
+    // a listing of the changes starts from the change token of the previous complete listing, without one every cloud slot is listed
+    std::string changeToken;
+    uint64_t startGeneration;
+    {
+        std::lock_guard<std::mutex> guard(m_gameSavingMutex);
+        startGeneration = m_syncedSlotsGeneration;
+        if (changesOnly)
+        {
+            changeToken = m_changeToken;
+        }
+    }
+
+    // when listing every cloud slot, assume all cached slots are not on the cloud, set all of their status to SlotSyncStatus::SHOULD_UPLOAD_LOCAL
+    const auto markNotOnCloud = [](CachedSlot& slot) { slot.slotSyncStatus = SlotSyncStatus::SHOULD_UPLOAD_LOCAL; };
+    if (changeToken.empty())
+    {
+        for (const CachedSlot& cachedSlot : getCachedSlots())
+        {
+            updateCachedSlot(cachedSlot.slotName, false, markNotOnCloud);
+        }
+    }
+
+    const std::string uri = m_sessionManager->GetClientSettings()[ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL];
+
+    // apply bounds to pageSize
+    pageSize = pageSize > MAX_PAGE_SIZE ? MAX_PAGE_SIZE : pageSize;
+
+    std::unordered_set<std::string> slotsFromCloud;
+    std::string nextChangeToken;
+    Aws::String startKey, pagingToken;
+    do
+    {
+        Caller::CallerParams queryString;
+
+        if (!startKey.empty())
+        {
+            queryString[START_KEY] = ToStdString(startKey);
+        }
+
+        if (!pagingToken.empty())
+        {
+            queryString[PAGING_TOKEN] = ToStdString(pagingToken);
+        }
+
+        if (pageSize > 0)
+        {
+            queryString[PAGE_SIZE] = std::to_string(pageSize);
+        }
+
+        if (!changeToken.empty())
+        {
+            queryString[CHANGE_TOKEN] = changeToken;
+        }
+
+        JsonValue jsonBody;
+        unsigned int returnCode = m_caller.CallApiGateway(uri, Aws::Http::HttpMethod::HTTP_GET, methodName, jsonBody, queryString);
+        if (returnCode != GameKit::GAMEKIT_SUCCESS)
+        {
+            return invokeCallback(receiver, resultCb, returnCode);
+        }
+
+        const JsonView data = jsonBody.View().GetObject("data");
+        Aws::Utils::Array<JsonView> jsonArray = data.GetArray("slots_metadata");
+
+        if (data.KeyExists(ToAwsString(CHANGE_TOKEN)))
+        {
+            nextChangeToken = ToStdString(data.GetString(ToAwsString(CHANGE_TOKEN)));
+        }
+
+        // copies of the updated slots, the callback must not point into the cached slots once the mutex is released
+        std::vector<CachedSlot> pageOfSlots;
+        for (size_t i = 0; i < jsonArray.GetLength(); ++i)
+        {
+            const JsonView slotJson = jsonArray.GetItem(i);
+            const std::string name = ToStdString(slotJson.GetString("slot_name"));
+
+            updateCachedSlot(name, true, [this, &slotJson, &pageOfSlots](CachedSlot& slot)
+            {
+                updateSlotFromJson(slotJson, slot);
+                updateSlotSyncStatus(slot);
+                pageOfSlots.push_back(slot);
+            });
+            slotsFromCloud.insert(name);
+        }
+
+        // a listing of the changes names the cloud slots deleted since the change token, they are reported with the slots that are not on the cloud
+        if (data.KeyExists("deleted_slots"))
+        {
+            Aws::Utils::Array<JsonView> deletedSlots = data.GetArray("deleted_slots");
+            for (size_t i = 0; i < deletedSlots.GetLength(); ++i)
+            {
+                updateCachedSlot(ToStdString(deletedSlots.GetItem(i).AsString()), false, markNotOnCloud);
+            }
+        }
+        std::vector<Slot> returnedSlotList(pageOfSlots.begin(), pageOfSlots.end());
+
+        JsonView jsonView = jsonBody.View().GetObject("paging");
+        if (jsonView.KeyExists("next_start_key"))
+        {
+            JsonView nextKey = jsonView.GetObject("next_start_key");
+            startKey = nextKey.GetString("slot_name");
+            if (!jsonView.KeyExists(ToAwsString(PAGING_TOKEN)))
+            {
+                Logging::Log(m_logCb, Level::Error, "paging_token missing from response with next_start_key");
+                pagingToken = "";
+            }
+            else
+            {
+                pagingToken = jsonView.GetString(ToAwsString(PAGING_TOKEN));
+            }
+
+            if (!waitForAllPages)
+            {
+                // pass in the list of slots that have been updated for this page
+                invokeCallback(receiver, resultCb, returnedSlotList);
+            }
+        }
+        else
+        {
+            startKey.clear();
+        }
+    } while (!startKey.empty());
+
+    // a backend without change tokens ignores the one it was sent and lists every cloud slot, the cached slots it didn't list are not on the cloud
+    if (!changeToken.empty() && nextChangeToken.empty())
+    {
+        for (const CachedSlot& cachedSlot : getCachedSlots())
+        {
+            if (slotsFromCloud.find(cachedSlot.slotName) == slotsFromCloud.end())
+            {
+                updateCachedSlot(cachedSlot.slotName, false, markNotOnCloud);
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_gameSavingMutex);
+
+        // the cached slots were cleared during the listing when the generation changed, the new token would belong to the previous player
+        if (m_syncedSlotsGeneration == startGeneration)
+        {
+            m_changeToken = nextChangeToken;
+        }
+    }
+
+    return invokeCallback(receiver, resultCb, waitForAllPages, slotsFromCloud);
+}
+
+bool GameSaving::isPlayerLoggedIn(const std::string& methodName) const
+{
+    const std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+
+    if (idToken.empty())
+    {
+        const std::string message = "GameSaving::" + methodName + "() No ID token in session.";
+        Logging::Log(m_logCb, Level::Error, message.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+unsigned int GameSaving::getSlotSyncStatusInternal(CachedSlot& slot)
+{
+    if (!m_sessionManager->AreSettingsLoaded(FeatureType::GameStateCloudSaving))
+    {
+        return GAMEKIT_ERROR_SETTINGS_MISSING;
+    }
+
+    const std::string uri = m_sessionManager->GetClientSettings()[ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL] + "/" + slot.slotName;
+
+    JsonValue jsonBody;
+    unsigned int returnCode = m_caller.CallApiGateway(uri, Aws::Http::HttpMethod::HTTP_GET, "GetSlotSyncStatus", jsonBody);
+    if (returnCode != GAMEKIT_SUCCESS)
+    {
+        return returnCode;
+    }
+
+    const std::string name = ToStdString(jsonBody.View().GetObject("data").GetString("slot_name"));
+    if (name == slot.slotName)
+    {
+        // json entry found, update the slot cloud info
+        updateSlotFromJson(jsonBody.View().GetObject("data"), slot);
+    }
+    else
+    {
+        const std::string message = "Info: GameSaving::GetSlotSyncStatus() slot not found in cloud: " + slot.slotName;
+        Logging::Log(m_logCb, Level::Info, message.c_str());
+    }
+
+    updateSlotSyncStatus(slot);
+
+    return GAMEKIT_SUCCESS;
+}
+
+unsigned int GameSaving::uploadLocalSlot(GameSavingModel& model, CachedSlot& slot)
+{
+    if (!m_sessionManager->AreSettingsLoaded(FeatureType::GameStateCloudSaving))
+    {
+        return GAMEKIT_ERROR_SETTINGS_MISSING;
+    }
+    // Validate metadata length
+    if (strlen(model.metadata) > MAX_METADATA_BYTES)
+    {
+        std::stringstream max, found;
+        max << MAX_METADATA_BYTES;
+        found << strlen(model.metadata);
+        const std::string errorMessage = "Info: GameSaving::uploadLocalSlot() metadata is greater than max allowed size. Max Size: " + max.str() + " Bytes, Found Size: " + found.str() + " Bytes";
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_GAME_SAVING_EXCEEDED_MAX_SIZE;
+    }
+
+    if (!model.overrideSync)
+    {
+        // get the updated status for the slot and validate we should be uploading
+        std::string message;
+        switch (slot.slotSyncStatus)
+        {
+        case SlotSyncStatus::SHOULD_DOWNLOAD_CLOUD:
+            message = "Info: GameSaving::uploadLocalSlot() cloud slot may be newer: " + std::string(model.slotName);
+            Logging::Log(m_logCb, Level::Info, message.c_str());
+            return GAMEKIT_ERROR_GAME_SAVING_CLOUD_SLOT_IS_NEWER;
 
         case SlotSyncStatus::SYNCED:
             message = "Info: GameSaving::uploadLocalSlot() local slot is already in sync with the cloud, will upload again anyways: " + std::string(model.slotName);
@@ -482,10 +839,28 @@ unsigned int GameSaving::uploadLocalSlot(GameSavingModel& model, CachedSlot& slo
         }
     }
 
+    // The upload reads the caller's buffer in place, it is not copied into a string stream.
+    // The buffer stays valid until SaveSlot returns, which is after the request completes.
+    std::shared_ptr<Aws::IOStream> objectStream = Aws::MakeShared<BufferStream>(model.slotName, model.data, model.dataSize);
+    unsigned int size = model.dataSize;
+
     // SHA-256 of the slot is used to check validity of the file when downloading it later.
     // This value must be present in both the request to generate the presigned S3 url, as well as
     // when uploading to S3 using the presigned url.
     const std::string hash = getSha256(*objectStream);
+
+    // Compress after hashing, the SHA-256 and the slot sizes always describe the uncompressed save data
+    std::vector<uint8_t> compressedPayload;
+    const bool isCompressed = model.compressData && compressSlotData(model.data, model.dataSize, compressedPayload);
+    if (isCompressed)
+    {
+        objectStream = Aws::MakeShared<BufferStream>(model.slotName, compressedPayload.data(), compressedPayload.size());
+        size = (unsigned int)compressedPayload.size();
+
+        const std::string message = "Info: GameSaving::uploadLocalSlot() compressed " + std::to_string(model.dataSize) + " bytes to " + std::to_string(size) + " bytes for slotName: " + model.slotName;
+        Logging::Log(m_logCb, Level::Info, message.c_str());
+    }
+
     const std::string uri = m_sessionManager->GetClientSettings()[ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL] + "/" + model.slotName + "/upload_url";
 
     // Encode the metadata using base64, allowing non-ascii characters when sent to S3
@@ -505,138 +880,553 @@ unsigned int GameSaving::uploadLocalSlot(GameSavingModel& model, CachedSlot& slo
     });
     if (strlen(model.metadata) > 0)
     {
-        headerParams[METADATA] = encodedMetadata;
+        headerParams[METADATA] = encodedMetadata;
+    }
+    if (isCompressed)
+    {
+        // The object in S3 is the compressed file, the backend reports this size for the slot instead so Slot::sizeCloud stays the size LoadSlot needs
+        headerParams[UNCOMPRESSED_SIZE] = std::to_string(model.dataSize);
+    }
+    if (model.conditionalWrite && !model.overrideSync)
+    {
+        // The cloud slot this device last knew about, 0 when it does not expect one to exist
+        headerParams[EXPECTED_LAST_MODIFIED_EPOCH_TIME] = std::to_string(slot.lastModifiedCloud.Millis());
+    }
+
+    // The url is signed for the headers sent with it, a cached url is only reused for a save file with the same headers
+    const std::string urlCacheKey = UPLOAD_URL_CACHE_PREFIX + model.slotName;
+    std::string signedHeaders;
+    for (const std::string& header : { HASH, LAST_MODIFIED_EPOCH_TIME, METADATA, UNCOMPRESSED_SIZE, EXPECTED_LAST_MODIFIED_EPOCH_TIME })
+    {
+        const auto headerParam = headerParams.find(header);
+        signedHeaders += header + "=" + (headerParam != headerParams.end() ? headerParam->second : "") + "\n";
+    }
+
+    std::string cachedUrlPut;
+    if (!findPresignedUrl(urlCacheKey, signedHeaders, cachedUrlPut))
+    {
+        JsonValue jsonBody;
+        unsigned int returnCode = m_caller.CallApiGateway(uri, Aws::Http::HttpMethod::HTTP_GET, "uploadLocalSlot", jsonBody, queryString, headerParams);
+        if (returnCode != GAMEKIT_SUCCESS)
+        {
+            return returnCode;
+        }
+
+        cachedUrlPut = ToStdString(jsonBody.View().GetObject("data").GetString("url"));
+
+        if (cachedUrlPut.empty())
+        {
+            const std::string errorMessage = "Error: GameSaving::uploadLocalSlot() url response formatted incorrectly or not found";
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            return GAMEKIT_ERROR_PARSE_JSON_FAILED;
+        }
+
+        cachePresignedUrl(urlCacheKey, signedHeaders, cachedUrlPut, model.urlTimeToLive);
+    }
+
+    const Aws::String presignedUrlPut = ToAwsString(cachedUrlPut);
+    const std::shared_ptr<Aws::Http::HttpRequest> putRequest = CreateHttpRequest(presignedUrlPut, Aws::Http::HttpMethod::HTTP_PUT, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+
+    putRequest->SetHeaderValue(S3_SHA_256_METADATA_HEADER, ToAwsString(hash));
+    putRequest->SetHeaderValue(S3_SLOT_METADATA_HEADER, ToAwsString(encodedMetadata));
+    putRequest->SetHeaderValue(S3_EPOCH_METADATA_HEADER, StringUtils::to_string(model.epochTime));
+    if (isCompressed)
+    {
+        putRequest->SetHeaderValue(S3_UNCOMPRESSED_SIZE_METADATA_HEADER, StringUtils::to_string(model.dataSize));
+    }
+
+    // S3 refuses the upload if the cloud save file is no longer the one this device last uploaded or downloaded, or if one appeared while the cached slot has none.
+    // Without a known ETag for an existing cloud save file, saveSlotConditionally() fetched the sync status instead and no precondition is sent.
+    const bool isPreconditionSent = model.conditionalWrite && !model.overrideSync && (!slot.cloudETag.empty() || slot.lastModifiedCloud.Millis() == 0);
+    if (isPreconditionSent && !slot.cloudETag.empty())
+    {
+        putRequest->SetHeaderValue(S3_IF_MATCH_HEADER, ToAwsString(slot.cloudETag));
+    }
+    else if (isPreconditionSent)
+    {
+        putRequest->SetHeaderValue(S3_IF_NONE_MATCH_HEADER, "*");
+    }
+
+    putRequest->AddContentBody(objectStream);
+
+    Aws::StringStream intConverter;
+    intConverter << size;
+    putRequest->SetContentLength(intConverter.str());
+
+    // Retry transient failures with the same url, the stream is rewound so every attempt sends the whole save file
+    // TODO upload large save files in parts and resume from the last acknowledged part once the backend issues per-part presigned urls.
+    const unsigned int maxUploadAttempts = std::max(model.maxUploadAttempts, 1u);
+    std::shared_ptr<Aws::Http::HttpResponse> putResponse;
+    for (unsigned int attempt = 1; attempt <= maxUploadAttempts; ++attempt)
+    {
+        objectStream->clear();
+        objectStream->seekg(0, std::ios::beg);
+
+        putResponse = m_transferHttpClient->MakeRequest(putRequest);
+
+        const Aws::Http::HttpResponseCode responseCode = putResponse->GetResponseCode();
+        const bool isTransientFailure = responseCode == Aws::Http::HttpResponseCode::REQUEST_NOT_MADE || Aws::Http::IsRetryableHttpResponseCode(responseCode);
+        if (responseCode == Aws::Http::HttpResponseCode::OK || !isTransientFailure || attempt == maxUploadAttempts)
+        {
+            break;
+        }
+
+        const std::string message = "Warning: GameSaving::uploadLocalSlot() upload attempt " + std::to_string(attempt) + " of " + std::to_string(maxUploadAttempts) +
+            " failed with http response code " + std::to_string(static_cast<int>(responseCode)) + ", retrying: " + std::string(model.slotName);
+        Logging::Log(m_logCb, Level::Warning, message.c_str());
+    }
+
+    const Aws::Http::HttpResponseCode putResponseCode = putResponse->GetResponseCode();
+    if (isPreconditionSent && (putResponseCode == Aws::Http::HttpResponseCode::PRECONDITION_FAILED || putResponseCode == Aws::Http::HttpResponseCode::CONFLICT ||
+        (putResponseCode == Aws::Http::HttpResponseCode::NOT_FOUND && !slot.cloudETag.empty())))
+    {
+        // The cloud save file changed, was deleted, or is being written by another device
+        const std::string message = "Info: GameSaving::uploadLocalSlot() cloud slot changed since it was last synced, use overrideSync = true to force the upload: " + std::string(model.slotName);
+        Logging::Log(m_logCb, Level::Info, message.c_str());
+        return GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT;
+    }
+
+    if (putResponseCode != Aws::Http::HttpResponseCode::OK)
+    {
+        evictPresignedUrl(urlCacheKey);
+
+        const std::string errorMessage = "Error: GameSaving::uploadLocalSlot() returned with http response code: " + std::to_string(static_cast<int>(putResponse->GetResponseCode()));
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_HTTP_REQUEST_FAILED;
+    }
+
+    std::string message = std::string("Info: GameSaving::uploadLocalSlot() Slot save data upload completed for slotName: ") + model.slotName;
+    Logging::Log(m_logCb, Level::Info, message.c_str());
+
+    markSlotAsSyncedWithLocal(slot);
+    slot.cloudETag = putResponse->HasHeader(S3_ETAG_HEADER.c_str()) ? ToStdString(putResponse->GetHeader(S3_ETAG_HEADER)) : std::string();
+
+    return GAMEKIT_SUCCESS;
+}
+
+unsigned int GameSaving::fetchStatusAndDownloadSlot(GameSavingModel& model, CachedSlot& slot, unsigned int& outActualSlotSize)
+{
+    // Fetch the current slot sync status - important to make sure our slot information is up to date
+    const unsigned int returnCode = getSlotSyncStatusInternal(slot);
+    if (returnCode != GAMEKIT_SUCCESS)
+    {
+        return returnCode;
+    }
+
+    return downloadCloudSlot(model, slot, outActualSlotSize);
+}
+
+unsigned int GameSaving::downloadCloudSlot(GameSavingModel& model, CachedSlot& slot, unsigned int& outActualSlotSize)
+{
+    // Validate slot sync status
+    unsigned int returnCode = validateSlotStatusForDownload(slot, model.overrideSync);
+    if (returnCode != GAMEKIT_SUCCESS)
+    {
+        return returnCode;
+    }
+
+    // Construct a pre-signed S3 url for the slot
+    std::string slotDownloadUrl;
+    returnCode = getPresignedS3UrlForSlot(model.slotName, model.urlTimeToLive, slotDownloadUrl);
+    if (returnCode != GAMEKIT_SUCCESS)
+    {
+        return returnCode;
+    }
+
+    // Download the slot from S3
+    std::shared_ptr<Aws::Http::HttpResponse> response;
+    bool isCompressed = false;
+    OutputBufferStream* slotStream = nullptr;
+    returnCode = downloadSlotFromS3(slotDownloadUrl, model, response, isCompressed, slotStream);
+    if (returnCode != GAMEKIT_SUCCESS)
+    {
+        // The url may have been rejected, the next download asks for a new one
+        evictPresignedUrl(DOWNLOAD_URL_CACHE_PREFIX + model.slotName);
+        return returnCode;
+    }
+
+    // Stream for the slot contents, a conditional SaveSlot() uploads over this version of the save file
+    Aws::IOStream& body = response->GetResponseBody();
+    const std::string cloudETag = response->HasHeader(S3_ETAG_HEADER.c_str()) ? ToStdString(response->GetHeader(S3_ETAG_HEADER)) : std::string();
+
+    if (isCompressed)
+    {
+        // A compressed file received into the designated data buffer is copied aside first, it is decompressed into the same buffer
+        std::vector<uint8_t> payload;
+        if (slotStream != nullptr)
+        {
+            payload.assign(model.data, model.data + slotStream->Size());
+        }
+        BufferStream payloadStream(payload.data(), payload.size());
+
+        // Decompress straight into the designated data buffer
+        std::iostream& compressedBody = slotStream != nullptr ? static_cast<std::iostream&>(payloadStream) : body;
+        returnCode = readCompressedSlot(compressedBody, ToStdString(response->GetHeader(S3_SHA_256_METADATA_HEADER)), model, outActualSlotSize);
+        if (returnCode != GAMEKIT_SUCCESS)
+        {
+            return returnCode;
+        }
+
+        // The cloud size of a save file uploaded before the uncompressed size was sent with it is that of the compressed file
+        slot.sizeCloud = outActualSlotSize;
+        markSlotAsSyncedWithCloud(slot);
+        slot.cloudETag = cloudETag;
+
+        return GAMEKIT_SUCCESS;
+    }
+
+    if (slotStream != nullptr)
+    {
+        // The slot was received straight into the designated data buffer
+        outActualSlotSize = (unsigned int)slotStream->Size();
+    }
+    else
+    {
+        // Verify that the buffer size is large enough to contain the stream contents
+        const std::char_traits<char>::pos_type begin = body.tellg();
+        body.seekg(0, std::ios::end);
+        const std::char_traits<char>::pos_type end = body.tellg();
+        const unsigned int slotSize = (unsigned int)(end - begin);
+        body.seekg(0, std::ios::beg);
+
+        // If buffer size is smaller than downloaded slot size, return error
+        if (model.dataSize < slotSize)
+        {
+            const std::string errorMessage = "Error: GameSaving::downloadCloudSlot() download cloud slot failed: Buffer too small : required = " + std::to_string(slotSize) +
+                " bytes, found = " + std::to_string(model.dataSize) +" bytes";
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            return GAMEKIT_ERROR_GAME_SAVING_BUFFER_TOO_SMALL;
+        }
+
+        // Stream the slot into the designated data buffer
+        body.read(reinterpret_cast<char*>(model.data), model.dataSize);
+        outActualSlotSize = slotSize;
+    }
+
+    // Synchronize the local timestamps with the cloud timestamps
+    markSlotAsSyncedWithCloud(slot);
+    slot.cloudETag = cloudETag;
+
+    return GAMEKIT_SUCCESS;
+}
+
+unsigned int GameSaving::readCompressedSlot(std::iostream& payload, const std::string& providedSha, GameSavingModel& model, unsigned int& outActualSlotSize) const
+{
+    uint8_t header[COMPRESSED_SLOT_HEADER_SIZE] = {};
+    payload.seekg(0, std::ios::beg);
+    payload.read(reinterpret_cast<char*>(header), COMPRESSED_SLOT_HEADER_SIZE);
+
+    uint64_t slotSize = 0;
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+        slotSize |= (uint64_t)header[COMPRESSED_SLOT_HEADER_SIZE - 8 + i] << (8 * i);
+    }
+
+    // If buffer size is smaller than the decompressed slot size, return error
+    if (model.dataSize < slotSize)
+    {
+        const std::string errorMessage = "Error: GameSaving::readCompressedSlot() download cloud slot failed: Buffer too small : required = " + std::to_string(slotSize) +
+            " bytes, found = " + std::to_string(model.dataSize) + " bytes";
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_GAME_SAVING_BUFFER_TOO_SMALL;
+    }
+
+    size_t decompressedSize = 0;
+    if (!CompressionUtils::Inflate(payload, model.data, (size_t)slotSize, decompressedSize) || decompressedSize != slotSize)
+    {
+        const std::string errorMessage = "Error: GameSaving::readCompressedSlot() compressed save file is malformed for slotName: " + std::string(model.slotName);
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_GAME_SAVING_SLOT_TAMPERED;
+    }
+
+    BufferStream decompressed(model.data, decompressedSize);
+    const std::string expectedSha = getSha256(decompressed);
+    if (providedSha != expectedSha)
+    {
+        const std::string errorMessage = "Error: GameSaving::readCompressedSlot() malformed SHA-256 " + providedSha + " found, expected " + expectedSha;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_GAME_SAVING_SLOT_TAMPERED;
+    }
+
+    outActualSlotSize = (unsigned int)decompressedSize;
+    return GAMEKIT_SUCCESS;
+}
+
+unsigned int GameSaving::saveSlotAfterStatusCheck(GameSavingModel& model, CachedSlot& slot)
+{
+    // Update the slot's local information, save it to a file, then get the the updated sync status from the cloud.
+    unsigned int status = updateLocalSlotStatus(slot, model);
+    if (status != GAMEKIT_SUCCESS)
+    {
+        return status;
+    }
+
+    // Upload the save from the provided buffer, get the new sync status.
+    status = uploadLocalSlot(model, slot);
+    if (status != GAMEKIT_SUCCESS)
+    {
+        return status;
+    }
+
+    // Re-save the metadata with the new sync status and modified times
+    return saveSlotInformation(slot, model.localSlotInformationFilePath);
+}
+
+unsigned int GameSaving::saveSlotConditionally(GameSavingModel& model, CachedSlot& slot)
+{
+    updateLocalSlotInformation(slot, model);
+
+    unsigned int status = GAMEKIT_SUCCESS;
+    if (!model.overrideSync && slot.cloudETag.empty() && slot.lastModifiedCloud.Millis() != 0)
+    {
+        // The cloud save file was never uploaded or downloaded by this device, without its ETag the upload can't be made conditional on it
+        status = getSlotSyncStatusInternal(slot);
+    }
+    else
+    {
+        // The sync status is worked out from the cached slot, the upload's precondition makes S3 check the cloud save file did not change since
+        updateSlotSyncStatus(slot);
+    }
+
+    if (status == GAMEKIT_SUCCESS)
+    {
+        status = uploadLocalSlot(model, slot);
+    }
+
+    if (status == GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT)
+    {
+        // Either the sync status, S3 or the backend found that the cloud slot changed since this device last synced it
+        slot.slotSyncStatus = SlotSyncStatus::IN_CONFLICT;
     }
 
-    JsonValue jsonBody;
-    unsigned int returnCode = m_caller.CallApiGateway(uri, Aws::Http::HttpMethod::HTTP_GET, "uploadLocalSlot", jsonBody, queryString, headerParams);
-    if (returnCode != GAMEKIT_SUCCESS)
+    // The slot information is written once, whether the upload succeeded or not, so the local save is tracked even when offline
+    const unsigned int saveStatus = saveSlotInformation(slot, model.localSlotInformationFilePath);
+    if (saveStatus != GAMEKIT_SUCCESS)
     {
-        return returnCode;
+        const std::string errorMessage = "Error: GameSaving::saveSlotConditionally() unable to save slot information for slotName: " + slot.slotName;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
     }
 
-    const Aws::String presignedUrlPut = jsonBody.View().GetObject("data").GetString("url");
+    return status != GAMEKIT_SUCCESS ? status : saveStatus;
+}
+
+void GameSaving::updateLocalSlotInformation(CachedSlot& slot, const GameSavingModel& model) const
+{
+    // Update the slot's local attributes based on the GameSavingModel
+    const int64_t epochTime = model.epochTime == 0 ? m_currentTimeProvider->GetCurrentTimeMilliseconds() : model.epochTime;
+    slot.lastModifiedLocal = Aws::Utils::DateTime(epochTime);
+    slot.sizeLocal = model.dataSize;
+    slot.metadataLocal = model.metadata;
+}
+
+unsigned int GameSaving::updateLocalSlotStatus(CachedSlot& slot, const GameSavingModel& model)
+{
+    updateLocalSlotInformation(slot, model);
 
-    if (presignedUrlPut.empty())
+    // Save the new information to a file
+    const unsigned int statusCode = saveSlotInformation(slot, model.localSlotInformationFilePath);
+    if (statusCode != GAMEKIT_SUCCESS)
     {
-        const std::string errorMessage = "Error: GameSaving::uploadLocalSlot() url response formatted incorrectly or not found";
+        const std::string errorMessage = "Error: GameSaving::updateLocalSlotStatus() unable to save slot information for slotName: " + slot.slotName;
         Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
-        return GAMEKIT_ERROR_PARSE_JSON_FAILED;
+        return statusCode;
     }
 
-    const std::shared_ptr<Aws::Http::HttpRequest> putRequest = CreateHttpRequest(presignedUrlPut, Aws::Http::HttpMethod::HTTP_PUT, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    // Update the slot's sync status from the cloud
+    return getSlotSyncStatusInternal(slot);
+}
 
-    putRequest->SetHeaderValue(S3_SHA_256_METADATA_HEADER, ToAwsString(hash));
-    putRequest->SetHeaderValue(S3_SLOT_METADATA_HEADER, ToAwsString(encodedMetadata));
-    putRequest->SetHeaderValue(S3_EPOCH_METADATA_HEADER, StringUtils::to_string(model.epochTime));
+unsigned int GameSaving::saveSlotInformation(const CachedSlot& slot, const char* filePath)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_slotMetadataIndexMutex);
+        if (!m_slotMetadataIndexPath.empty())
+        {
+            const bool isDeleted = false;
+            return updateSlotMetadataIndex(slot, isDeleted);
+        }
+    }
 
-    putRequest->AddContentBody(objectStream);
+    const JsonValue json = slot;
+    const Aws::String fileContents = json.View().WriteCompact();
 
-    Aws::StringStream intConverter;
-    intConverter << size;
-    putRequest->SetContentLength(intConverter.str());
+    // Write file
+    std::vector<uint8_t> dataVector(fileContents.begin(), fileContents.end());
+    bool success = m_fileWriteCallback(m_fileWriteDispatchReceiver, filePath, dataVector.data(), (const unsigned int)dataVector.size());
+
+    return success ? GAMEKIT_SUCCESS : GAMEKIT_ERROR_FILE_WRITE_FAILED;
+}
 
-    const std::shared_ptr<Aws::Http::HttpResponse> putResponse = m_httpClient->MakeRequest(putRequest);
-    if (putResponse->GetResponseCode() != Aws::Http::HttpResponseCode::OK)
+unsigned int GameSaving::readSlotMetadataIndex(const std::string& indexFilePath, SlotMetadataIndexCopy& outIndex) const
+{
+    outIndex = SlotMetadataIndexCopy();
+
+    // The copy with the highest sequence is the newest, an intact copy is preferred over a newer one that was torn by a crash
+    SlotMetadataIndexCopy copies[2];
+    SlotMetadataIndexCopy* newestCopy = nullptr;
+    bool anyCopyExists = false;
+    for (unsigned int i = 0; i < 2; ++i)
     {
-        const std::string errorMessage = "Error: GameSaving::uploadLocalSlot() returned with http response code: " + std::to_string(static_cast<int>(putResponse->GetResponseCode()));
-        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
-        return GAMEKIT_ERROR_HTTP_REQUEST_FAILED;
+        bool exists = false;
+        const unsigned int status = readSlotMetadataIndexCopy(getSlotMetadataIndexCopyPath(indexFilePath, i + 1), copies[i], exists);
+        anyCopyExists |= exists;
+        if (status != GAMEKIT_SUCCESS || !exists)
+        {
+            continue;
+        }
+
+        if (newestCopy == nullptr || copies[i].isComplete > newestCopy->isComplete ||
+            (copies[i].isComplete == newestCopy->isComplete && copies[i].sequence > newestCopy->sequence))
+        {
+            newestCopy = &copies[i];
+        }
     }
 
-    std::string message = std::string("Info: GameSaving::uploadLocalSlot() Slot save data upload completed for slotName: ") + model.slotName;
-    Logging::Log(m_logCb, Level::Info, message.c_str());
+    if (newestCopy == nullptr)
+    {
+        if (anyCopyExists)
+        {
+            return GAMEKIT_ERROR_FILE_READ_FAILED;
+        }
 
-    markSlotAsSyncedWithLocal(slot);
+        const std::string message = "GameSaving::readSlotMetadataIndex() no slot metadata index found, a new one will be written to " + indexFilePath;
+        Logging::Log(m_logCb, Level::Info, message.c_str());
+        return GAMEKIT_SUCCESS;
+    }
 
+    outIndex = std::move(*newestCopy);
     return GAMEKIT_SUCCESS;
 }
 
-unsigned int GameSaving::downloadCloudSlot(GameSavingModel& model, CachedSlot& slot, unsigned int& outActualSlotSize)
+unsigned int GameSaving::readSlotMetadataIndexCopy(const std::string& copyPath, SlotMetadataIndexCopy& outCopy, bool& outExists) const
 {
-    // Validate slot sync status
-    unsigned int returnCode = validateSlotStatusForDownload(slot, model.overrideSync);
-    if (returnCode != GAMEKIT_SUCCESS)
+    const unsigned int size = m_fileSizeCallback(m_fileSizeDispatchReceiver, copyPath.c_str());
+    outExists = size > 0;
+    if (!outExists)
     {
-        return returnCode;
+        return GAMEKIT_SUCCESS;
     }
 
-    // Construct a pre-signed S3 url for the slot
-    std::string slotDownloadUrl;
-    returnCode = getPresignedS3UrlForSlot(model.slotName, model.urlTimeToLive, slotDownloadUrl);
-    if (returnCode != GAMEKIT_SUCCESS)
+    std::vector<char> data(size);
+    if (!m_fileReadCallback(m_fileReadDispatchReceiver, copyPath.c_str(), reinterpret_cast<uint8_t*>(data.data()), size))
     {
-        return returnCode;
+        const std::string errorMessage = "Error: GameSaving::readSlotMetadataIndexCopy() unable to read slot metadata index: " + copyPath;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_FILE_READ_FAILED;
     }
 
-    // Download the slot from S3
-    std::shared_ptr<Aws::Http::HttpResponse> response;
-    returnCode = downloadSlotFromS3(slotDownloadUrl, response);
-    if (returnCode != GAMEKIT_SUCCESS)
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint64_t sequence = 0;
+    uint32_t slotCount = 0;
+    const size_t headerSize = sizeof(magic) + sizeof(version) + sizeof(sequence) + sizeof(slotCount);
+    if (data.size() >= headerSize)
     {
-        return returnCode;
+        memcpy(&magic, data.data(), sizeof(magic));
+        memcpy(&version, data.data() + sizeof(magic), sizeof(version));
+        memcpy(&sequence, data.data() + sizeof(magic) + sizeof(version), sizeof(sequence));
+        memcpy(&slotCount, data.data() + sizeof(magic) + sizeof(version) + sizeof(sequence), sizeof(slotCount));
     }
 
-    // Stream for the slot contents
-    Aws::IOStream& body = response->GetResponseBody();
-
-    // Verify that the buffer size is large enough to contain the stream contents
-    const std::char_traits<char>::pos_type begin = body.tellg();
-    body.seekg(0, std::ios::end);
-    const std::char_traits<char>::pos_type end = body.tellg();
-    const unsigned int slotSize = (unsigned int)(end - begin);
-    body.seekg(0, std::ios::beg);
-
-    // If buffer size is smaller than downloaded slot size, return error
-    if (model.dataSize < slotSize)
+    // Version 1 indexes had platform dependent field widths and are not read
+    if (magic != SLOT_METADATA_INDEX_MAGIC || version != SLOT_METADATA_INDEX_VERSION)
     {
-        const std::string errorMessage = "Error: GameSaving::downloadCloudSlot() download cloud slot failed: Buffer too small : required = " + std::to_string(slotSize) +
-            " bytes, found = " + std::to_string(model.dataSize) +" bytes";
+        const std::string errorMessage = "Error: GameSaving::readSlotMetadataIndexCopy() file is not a supported slot metadata index: " + copyPath;
         Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
-        return GAMEKIT_ERROR_GAME_SAVING_BUFFER_TOO_SMALL;
+        return GAMEKIT_ERROR_FILE_READ_FAILED;
     }
 
-    // Stream the slot into the designated data buffer
-    body.read(reinterpret_cast<char*>(model.data), model.dataSize);
-    outActualSlotSize = slotSize;
+    outCopy.sequence = sequence;
+    size_t offset = headerSize;
+    for (uint32_t i = 0; i < slotCount; ++i)
+    {
+        // A record that is incomplete or fails its CRC check was torn by a crash, the records after it can't be trusted
+        const size_t recordOffset = offset;
+        const char* record = nullptr;
+        size_t recordLength = 0;
+        if (!tryReadSlotMetadataIndexRecord(data.data(), data.size(), offset, record, recordLength))
+        {
+            const std::string errorMessage = "Error: GameSaving::readSlotMetadataIndexCopy() dropping " + std::to_string(slotCount - i) +
+                " slots after an incomplete or corrupt record in " + copyPath;
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            outCopy.isComplete = false;
+            break;
+        }
 
-    // Synchronize the local timestamps with the cloud timestamps
-    markSlotAsSyncedWithCloud(slot);
+        std::istringstream recordStream(std::string(record, recordLength));
+        CachedSlot slot;
+        if (!slot.FromBinary(recordStream))
+        {
+            const std::string errorMessage = "Error: GameSaving::readSlotMetadataIndexCopy() unable to decode a slot record in " + copyPath;
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            continue;
+        }
+
+        // Keep the framed record as it is, it is written back unchanged until its slot is updated
+        outCopy.records[slot.slotName] = std::string(data.data() + recordOffset, offset - recordOffset);
+        outCopy.slots.push_back(slot);
+    }
 
     return GAMEKIT_SUCCESS;
 }
 
-unsigned int GameSaving::updateLocalSlotStatus(CachedSlot& slot, const GameSavingModel& model)
+std::string GameSaving::getSlotMetadataIndexCopyPath(const std::string& indexFilePath, uint64_t sequence)
 {
-    // Update the slot's local attributes based on the GameSavingModel
-    const int64_t epochTime = model.epochTime == 0 ? m_currentTimeProvider->GetCurrentTimeMilliseconds() : model.epochTime;
-    slot.lastModifiedLocal = Aws::Utils::DateTime(epochTime);
-    slot.sizeLocal = model.dataSize;
-    slot.metadataLocal = model.metadata;
+    // Writes with an odd sequence go to the index file itself, the others to its second copy
+    return sequence % 2 == 1 ? indexFilePath : indexFilePath + SLOT_METADATA_INDEX_SECOND_COPY_SUFFIX;
+}
 
-    // Save the new information to a file
-    const unsigned int statusCode = saveSlotInformation(slot, model.localSlotInformationFilePath);
-    if (statusCode != GAMEKIT_SUCCESS)
+unsigned int GameSaving::updateSlotMetadataIndex(const CachedSlot& slot, bool isDeleted)
+{
+    if (isDeleted)
     {
-        const std::string errorMessage = "Error: GameSaving::updateLocalSlotStatus() unable to save slot information for slotName: " + slot.slotName;
-        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
-        return statusCode;
+        m_slotMetadataIndexRecords.erase(slot.slotName);
+    }
+    else
+    {
+        m_slotMetadataIndexRecords[slot.slotName] = encodeSlotMetadataIndexRecord(slot);
     }
 
-    // Update the slot's sync status from the cloud
-    return getSlotSyncStatusInternal(slot);
+    return writeSlotMetadataIndex();
 }
 
-unsigned int GameSaving::saveSlotInformation(const Slot& slot, const char* filePath)
+unsigned int GameSaving::writeSlotMetadataIndex()
 {
-    const JsonValue json = CachedSlot(slot);
-    const Aws::String fileContents = json.View().WriteCompact();
+    // FileActions can only write whole files, the other records are written back as they are.
+    // The write goes over the older copy, so a crash during it leaves the newer copy intact for the next read.
+    const uint64_t sequence = m_slotMetadataIndexSequence + 1;
+    std::ostringstream index;
+    Serialization::BinWrite(index, static_cast<uint32_t>(SLOT_METADATA_INDEX_MAGIC));
+    Serialization::BinWrite(index, static_cast<uint32_t>(SLOT_METADATA_INDEX_VERSION));
+    Serialization::BinWrite(index, sequence);
+    Serialization::BinWrite(index, static_cast<uint32_t>(m_slotMetadataIndexRecords.size()));
+    for (const auto& record : m_slotMetadataIndexRecords)
+    {
+        index.write(record.second.data(), (std::streamsize)record.second.size());
+    }
 
-    // Write file
-    std::vector<uint8_t> dataVector(fileContents.begin(), fileContents.end());
-    bool success = m_fileWriteCallback(m_fileWriteDispatchReceiver, filePath, dataVector.data(), (const unsigned int)dataVector.size());
+    const std::string copyPath = getSlotMetadataIndexCopyPath(m_slotMetadataIndexPath, sequence);
+    const std::string contents = index.str();
+    const bool success = m_fileWriteCallback(m_fileWriteDispatchReceiver, copyPath.c_str(), reinterpret_cast<const uint8_t*>(contents.data()), (const unsigned int)contents.size());
+    if (!success)
+    {
+        const std::string errorMessage = "Error: GameSaving::writeSlotMetadataIndex() unable to write slot metadata index: " + copyPath;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_FILE_WRITE_FAILED;
+    }
 
-    return success ? GAMEKIT_SUCCESS : GAMEKIT_ERROR_FILE_WRITE_FAILED;
+    m_slotMetadataIndexSequence = sequence;
+    return GAMEKIT_SUCCESS;
+}
+
+std::string GameSaving::encodeSlotMetadataIndexRecord(const CachedSlot& slot)
+{
+    std::ostringstream body;
+    slot.ToBinary(body);
+
+    std::ostringstream record;
+    writeSlotMetadataIndexRecord(record, body.str());
+    return record.str();
 }
 
 void GameSaving::loadSlotInformation(const char* const* localSlotInformationFilePaths, unsigned int arraySize)
@@ -669,10 +1459,91 @@ void GameSaving::loadSlotInformation(const char* const* localSlotInformationFile
 
         const std::string msg = "GameSaving:: loadSlotInformation() successfully loaded slot from " + std::string(path) + " into local slot.";
         Logging::Log(m_logCb, Level::Info, msg.c_str());
+        std::lock_guard<std::mutex> guard(m_gameSavingMutex);
         m_syncedSlots[loadedSlot.slotName] = loadedSlot;
     }
 }
 
+std::shared_ptr<std::mutex> GameSaving::getSlotMutex(const std::string& slotName)
+{
+    std::lock_guard<std::mutex> guard(m_gameSavingMutex);
+
+    // Slot mutexes are never removed, an operation may still be waiting on one after its slot was deleted
+    std::shared_ptr<std::mutex>& slotMutex = m_slotMutexes[slotName];
+    if (slotMutex == nullptr)
+    {
+        slotMutex = std::make_shared<std::mutex>();
+    }
+
+    return slotMutex;
+}
+
+bool GameSaving::findCachedSlot(const std::string& slotName, CachedSlot& outSlot) const
+{
+    std::lock_guard<std::mutex> guard(m_gameSavingMutex);
+
+    const auto foundSlot = m_syncedSlots.find(slotName);
+    if (foundSlot == m_syncedSlots.end())
+    {
+        return false;
+    }
+
+    outSlot = foundSlot->second;
+    return true;
+}
+
+bool GameSaving::storeCachedSlot(const CachedSlot& slot)
+{
+    std::lock_guard<std::mutex> guard(m_gameSavingMutex);
+
+    // A slot cleared or deleted in the meantime is not brought back
+    const auto foundSlot = m_syncedSlots.find(slot.slotName);
+    if (foundSlot == m_syncedSlots.end())
+    {
+        return false;
+    }
+
+    foundSlot->second = slot;
+    return true;
+}
+
+std::vector<CachedSlot> GameSaving::getCachedSlots() const
+{
+    std::lock_guard<std::mutex> guard(m_gameSavingMutex);
+
+    std::vector<CachedSlot> cachedSlots;
+    cachedSlots.reserve(m_syncedSlots.size());
+    for (const auto& slotEntry : m_syncedSlots)
+    {
+        cachedSlots.push_back(slotEntry.second);
+    }
+
+    return cachedSlots;
+}
+
+bool GameSaving::updateCachedSlot(const std::string& slotName, bool addIfMissing, const std::function<void(CachedSlot&)>& update)
+{
+    // The slot mutex is locked before m_gameSavingMutex, like the slot operations do
+    const std::shared_ptr<std::mutex> slotMutex = getSlotMutex(slotName);
+    std::lock_guard<std::mutex> slotGuard(*slotMutex);
+    std::lock_guard<std::mutex> guard(m_gameSavingMutex);
+
+    auto foundSlot = m_syncedSlots.find(slotName);
+    if (foundSlot == m_syncedSlots.end())
+    {
+        if (!addIfMissing)
+        {
+            return false;
+        }
+
+        foundSlot = m_syncedSlots.emplace(slotName, CachedSlot()).first;
+        foundSlot->second.slotName = slotName;
+    }
+
+    update(foundSlot->second);
+    return true;
+}
+
 unsigned int GameSaving::validateSlotStatusForDownload(CachedSlot& slot, const bool overrideSync) const
 {
     if (overrideSync)
@@ -714,13 +1585,19 @@ unsigned int GameSaving::validateSlotStatusForDownload(CachedSlot& slot, const b
     }
 }
 
-unsigned int GameSaving::getPresignedS3UrlForSlot(const char* slotName, const unsigned int urlTtl, std::string& returnedS3Url) const
+unsigned int GameSaving::getPresignedS3UrlForSlot(const char* slotName, const unsigned int urlTtl, std::string& returnedS3Url)
 {
     if (!m_sessionManager->AreSettingsLoaded(FeatureType::GameStateCloudSaving))
     {
         return GAMEKIT_ERROR_SETTINGS_MISSING;
     }
 
+    const std::string urlCacheKey = DOWNLOAD_URL_CACHE_PREFIX + slotName;
+    if (findPresignedUrl(urlCacheKey, "", returnedS3Url))
+    {
+        return GAMEKIT_SUCCESS;
+    }
+
     std::stringstream urlTtlString;
     urlTtlString << urlTtl;
     const std::string lambdaFunctionUri = m_sessionManager->GetClientSettings()[ClientSettings::GameSaving::SETTINGS_GAME_SAVING_BASE_URL] + "/" + slotName + "/download_url?time_to_live=" + urlTtlString.str();
@@ -740,13 +1617,112 @@ unsigned int GameSaving::getPresignedS3UrlForSlot(const char* slotName, const un
         Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
         return GAMEKIT_ERROR_PARSE_JSON_FAILED;
     }
+
+    cachePresignedUrl(urlCacheKey, "", returnedS3Url, urlTtl);
     return GAMEKIT_SUCCESS;
 }
 
-unsigned int GameSaving::downloadSlotFromS3(const std::string& presignedSlotDownloadUrl, std::shared_ptr<Aws::Http::HttpResponse>& returnedResponse) const
+bool GameSaving::findPresignedUrl(const std::string& key, const std::string& signedHeaders, std::string& outUrl)
+{
+    std::lock_guard<std::mutex> guard(m_presignedUrlsMutex);
+
+    const auto cachedUrl = m_presignedUrls.find(key);
+    if (cachedUrl == m_presignedUrls.end())
+    {
+        return false;
+    }
+
+    if (cachedUrl->second.signedHeaders != signedHeaders || m_currentTimeProvider->GetCurrentTimeMilliseconds() >= cachedUrl->second.reusableUntilMs)
+    {
+        m_presignedUrls.erase(cachedUrl);
+        return false;
+    }
+
+    outUrl = cachedUrl->second.url;
+    return true;
+}
+
+void GameSaving::cachePresignedUrl(const std::string& key, const std::string& signedHeaders, const std::string& url, unsigned int urlTtl)
+{
+    // Stop reusing the url a while before it expires, so a request that starts with it still completes in time
+    if (urlTtl <= PRESIGNED_URL_SAFETY_MARGIN_SECONDS)
+    {
+        return;
+    }
+
+    const int64_t reusableUntilMs = m_currentTimeProvider->GetCurrentTimeMilliseconds() + (int64_t)(urlTtl - PRESIGNED_URL_SAFETY_MARGIN_SECONDS) * 1000;
+
+    std::lock_guard<std::mutex> guard(m_presignedUrlsMutex);
+    m_presignedUrls[key] = { url, signedHeaders, reusableUntilMs };
+}
+
+void GameSaving::evictPresignedUrl(const std::string& key)
+{
+    std::lock_guard<std::mutex> guard(m_presignedUrlsMutex);
+    m_presignedUrls.erase(key);
+}
+
+unsigned int GameSaving::downloadSlotFromS3(const std::string& presignedSlotDownloadUrl, GameSavingModel& model, std::shared_ptr<Aws::Http::HttpResponse>& returnedResponse, bool& outIsCompressed, OutputBufferStream*& outSlotStream) const
 {
-    const std::shared_ptr<Aws::Http::HttpRequest> request = CreateHttpRequest(ToAwsString(presignedSlotDownloadUrl), Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
-    const std::shared_ptr<Aws::Http::HttpResponse> response = m_httpClient->MakeRequest(request);
+    outIsCompressed = false;
+    outSlotStream = nullptr;
+
+    // The body is written straight into the designated data buffer instead of being buffered by the http client first
+    OutputBufferStream* slotStream = nullptr;
+    const Aws::IOStreamFactory slotStreamFactory = [&model, &slotStream]()
+    {
+        slotStream = Aws::New<OutputBufferStream>(model.slotName, model.data, model.dataSize);
+        return slotStream;
+    };
+    const std::shared_ptr<Aws::Http::HttpRequest> request = CreateHttpRequest(ToAwsString(presignedSlotDownloadUrl), Aws::Http::HttpMethod::HTTP_GET, slotStreamFactory);
+
+    // Only a successful response carrying a save file is received into the buffer. An error body goes to a scratch stream,
+    // so it neither overwrites the buffer nor gets reported as a buffer that is too small.
+    const auto isErrorStatus = [](Aws::Http::HttpResponseCode responseCode)
+    {
+        return responseCode != Aws::Http::HttpResponseCode::REQUEST_NOT_MADE && (static_cast<int>(responseCode) < 200 || static_cast<int>(responseCode) >= 300);
+    };
+    Aws::StringStream errorBody;
+    bool isSlotBody = true;
+
+    // Stop the transfer as soon as the headers show that the slot does not fit in the buffer, before the body arrives
+    const long long capacity = model.dataSize;
+    long long contentLength = -1;
+    request->SetHeadersReceivedEventHandler([&contentLength, &isSlotBody, &slotStream, &errorBody, &isErrorStatus](const Aws::Http::HttpRequest*, Aws::Http::HttpResponse* headersResponse)
+    {
+        isSlotBody = !isErrorStatus(headersResponse->GetResponseCode()) && headersResponse->HasHeader(S3_SHA_256_METADATA_HEADER.c_str());
+        if (!isSlotBody)
+        {
+            if (slotStream != nullptr)
+            {
+                slotStream->rdbuf(errorBody.rdbuf());
+            }
+            return;
+        }
+
+        if (headersResponse->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
+        {
+            contentLength = StringUtils::ConvertToInt64(headersResponse->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER).c_str());
+        }
+    });
+    request->SetContinueRequestHandle([&contentLength, capacity](const Aws::Http::HttpRequest*)
+    {
+        return contentLength <= capacity;
+    });
+
+    const std::shared_ptr<Aws::Http::HttpResponse> response = m_transferHttpClient->MakeRequest(request);
+
+    // A client that ignores the response stream factory keeps the body in its own stream, it is copied into the buffer later
+    const bool isBodyInBuffer = isSlotBody && slotStream != nullptr && &response->GetResponseBody() == slotStream;
+    const bool isBufferTooSmall = contentLength > capacity || (isBodyInBuffer && slotStream->HasOverflowed());
+    if (isBufferTooSmall && !isErrorStatus(response->GetResponseCode()))
+    {
+        const std::string required = contentLength > capacity ? std::to_string(contentLength) : "more than " + std::to_string(capacity);
+        const std::string errorMessage = "Error: GameSaving::downloadSlotFromS3() download cloud slot failed: Buffer too small : required = " + required +
+            " bytes, found = " + std::to_string(capacity) + " bytes";
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_GAME_SAVING_BUFFER_TOO_SMALL;
+    }
 
     if (response->GetResponseCode() != Aws::Http::HttpResponseCode::OK)
     {
@@ -764,7 +1740,11 @@ unsigned int GameSaving::downloadSlotFromS3(const std::string& presignedSlotDown
 
     const std::string providedSha = ToStdString(response->GetHeader(S3_SHA_256_METADATA_HEADER));
     const std::string expectedSha = getSha256(response->GetResponseBody());
-    if (strcmp(providedSha.c_str(), expectedSha.c_str()) != 0)
+    const bool isShaMatching = strcmp(providedSha.c_str(), expectedSha.c_str()) == 0;
+
+    // The SHA-256 of a compressed save file is that of the uncompressed data, it is checked once the file is decompressed
+    outIsCompressed = !isShaMatching && isCompressedSlotPayload(response->GetResponseBody());
+    if (!isShaMatching && !outIsCompressed)
     {
         const std::string errorMessage = "Error: GameSaving::downloadSlotFromS3() malformed SHA-256 " + providedSha + " found, expected " + expectedSha;
         Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
@@ -772,6 +1752,7 @@ unsigned int GameSaving::downloadSlotFromS3(const std::string& presignedSlotDown
     }
 
     returnedResponse = response;
+    outSlotStream = isBodyInBuffer ? slotStream : nullptr;
     return GAMEKIT_SUCCESS;
 }
 
@@ -818,15 +1799,16 @@ unsigned int GameSaving::invokeCallback(DISPATCH_RECEIVER_HANDLE receiver, GameS
 
 unsigned int GameSaving::invokeCallback(DISPATCH_RECEIVER_HANDLE receiver, GameSavingResponseCallback resultCb, bool waitForAllPages, std::unordered_set<std::string>& slotsFromCloud) const
 {
+    const std::vector<CachedSlot> cachedSlots = getCachedSlots();
     std::vector<Slot> returnedSlotList;
-    returnedSlotList.reserve(m_syncedSlots.size());
+    returnedSlotList.reserve(cachedSlots.size());
 
-    for (std::pair<const std::string, Slot> slotEntry : m_syncedSlots)
+    for (const CachedSlot& cachedSlot : cachedSlots)
     {
         // if we are returning per page, then we only want to return any remaining slots (the local only slots) here, else return all.
-        if (waitForAllPages || slotsFromCloud.find(slotEntry.first) == slotsFromCloud.end())
+        if (waitForAllPages || slotsFromCloud.find(cachedSlot.slotName) == slotsFromCloud.end())
         {
-            returnedSlotList.push_back(slotEntry.second);
+            returnedSlotList.push_back(cachedSlot);
         }
     }
 
@@ -857,11 +1839,9 @@ unsigned int GameSaving::invokeCallback(DISPATCH_RECEIVER_HANDLE receiver, GameS
 {
     if (!(receiver == nullptr) && !(resultCb == nullptr))
     {
-        std::vector<Slot> returnedSlotList;
-        for (std::pair<const std::string, Slot> slotEntry : m_syncedSlots)
-        {
-            returnedSlotList.push_back(slotEntry.second);
-        }
+        // a copy of the cached slots, the callback does not block other operations
+        const std::vector<CachedSlot> cachedSlots = getCachedSlots();
+        std::vector<Slot> returnedSlotList(cachedSlots.begin(), cachedSlots.end());
 
         resultCb(receiver, returnedSlotList.data(), (unsigned int)returnedSlotList.size(), &actedOnSlot, callStatus);
     }
@@ -887,11 +1867,9 @@ unsigned int GameSaving::invokeCallback(
 {
     if (!(receiver == nullptr) && !(resultCb == nullptr))
     {
-        std::vector<Slot> returnedSlotList;
-        for (std::pair<const std::string, Slot> slotEntry : m_syncedSlots)
-        {
-            returnedSlotList.push_back(slotEntry.second);
-        }
+        // a copy of the cached slots, the callback does not block other operations
+        const std::vector<CachedSlot> cachedSlots = getCachedSlots();
+        std::vector<Slot> returnedSlotList(cachedSlots.begin(), cachedSlots.end());
 
         resultCb(receiver, returnedSlotList.data(), (unsigned int)returnedSlotList.size(), &actedOnSlot, data, dataSize, callStatus);
     }
@@ -920,6 +1898,44 @@ std::string GameSaving::getSha256(std::iostream& buffer)
     return ToStdString(base64.Encode(hashResult.GetResult()));
 }
 
+bool GameSaving::compressSlotData(const uint8_t* data, unsigned int dataSize, std::vector<uint8_t>& outPayload)
+{
+    std::vector<uint8_t> compressed;
+    if (!CompressionUtils::Deflate(data, dataSize, compressed) || COMPRESSED_SLOT_HEADER_SIZE + compressed.size() >= dataSize)
+    {
+        // Incompressible save data is uploaded as is
+        return false;
+    }
+
+    outPayload.clear();
+    outPayload.reserve(COMPRESSED_SLOT_HEADER_SIZE + compressed.size());
+    outPayload.insert(outPayload.end(), COMPRESSED_SLOT_MAGIC.begin(), COMPRESSED_SLOT_MAGIC.end());
+    outPayload.push_back((uint8_t)COMPRESSED_SLOT_CODEC_DEFLATE);
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+        outPayload.push_back((uint8_t)(((uint64_t)dataSize >> (8 * i)) & 0xFF));
+    }
+    outPayload.insert(outPayload.end(), compressed.begin(), compressed.end());
+
+    return true;
+}
+
+bool GameSaving::isCompressedSlotPayload(std::iostream& payload)
+{
+    char prefix[5] = {};
+    payload.clear();
+    payload.seekg(0, std::ios::beg);
+    payload.read(prefix, sizeof(prefix));
+    const bool isCompressed = payload.gcount() == sizeof(prefix)
+        && COMPRESSED_SLOT_MAGIC.compare(0, COMPRESSED_SLOT_MAGIC.size(), prefix, COMPRESSED_SLOT_MAGIC.size()) == 0
+        && (uint8_t)prefix[4] == COMPRESSED_SLOT_CODEC_DEFLATE;
+
+    payload.clear();
+    payload.seekg(0, std::ios::beg);
+
+    return isCompressed;
+}
+
 void GameSaving::updateSlotFromJson(const JsonView& jsonBody, CachedSlot& returnedSlot)
 {
     const std::string encodedMetadata = ToStdString(jsonBody.GetString("metadata"));
@@ -32,8 +32,8 @@ unsigned int GameKit::GameSaving::Caller::CallApiGateway(
     const CallerParams& queryStringParams,
     const CallerParams& headerParams) const
 {
-    const std::string idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
-    if (idToken.empty())
+    const std::shared_ptr<const Authentication::SessionTokens> tokens = m_sessionManager->GetSessionTokens();
+    if (tokens->Tokens[(size_t)GameKit::TokenType::IdToken].empty())
     {
         const std::string message = "GameSaving::" + currentFunctionName + "() No ID token in session.";
         Logger::Logging::Log(m_logCb, Level::Info, message.c_str());
@@ -41,7 +41,7 @@ unsigned int GameKit::GameSaving::Caller::CallApiGateway(
     }
 
     const std::shared_ptr<Aws::Http::HttpRequest> request = CreateHttpRequest(ToAwsString(uri), method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
-    request->SetAwsAuthorization(Aws::String(idToken));
+    request->SetAwsAuthorization(tokens->IdTokenAuthorization);
 
     // add any query string params
     for (auto param : queryStringParams)
@@ -102,6 +102,15 @@ unsigned int GameKit::GameSaving::Caller::CallApiGateway(
         }
     }
 
+    // Error case for a conditional save whose expected cloud slot is out of date
+    if (response->GetResponseCode() == Aws::Http::HttpResponseCode::PRECONDITION_FAILED)
+    {
+        const std::string errorMessage = "Error: GameSaving::" + currentFunctionName + "() cloud slot changed since it was last synced, returned with http response code : " +
+            std::to_string(static_cast<int>(response->GetResponseCode()));
+        Logger::Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT;
+    }
+
     if (response->GetResponseCode() != Aws::Http::HttpResponseCode::OK)
     {
         const std::string errorMessage = "Error: GameSaving::" + currentFunctionName + "() returned with http response code : " + std::to_string(static_cast<int>(response->GetResponseCode()));
@@ -70,8 +70,8 @@ namespace GameKit
         // 1. If the background thread is not running, all calls are synchronous by default (even if the async flag is set to true)
         // 2. In Healthy mode, all calls are synchronous by default. Calls can be made async with flag and can provide success/failure callbacks.
         // 3. In Unhealthy mode, Add, Update and Delete API calls are kept in an internal queue. Get API calls are rejected.
-        // 4. In Unhealthy mode, accumulated requests are preprocessed so that when multiple Add/Update and Delete operations for a single
-        //    have been enqueued for a unique bundle-item combination, the most recent is kept and the old are discarded.
+        // 4. In Unhealthy mode, when multiple Add/Update and Delete operations for a single unique bundle-item combination are enqueued,
+        //    the most recent is kept and the old are discarded as soon as the new one is enqueued.
         // 5. Calls are retried in order from oldest to newest, user provided callbacks are invoked on success. 
         // 6. Default Unhealthy retry strategy is Exponential Backoff.
         class GAMEKIT_API GameLiftHttpClient : public BaseHttpClient
@@ -83,10 +83,18 @@ namespace GameKit
             virtual bool shouldEnqueueWithUnhealthyConnection(const std::shared_ptr<IOperation> operation) const override;
             virtual bool isOperationRetryable(const std::shared_ptr<IOperation> operation, std::shared_ptr<const Aws::Http::HttpResponse> response) const override;\
 
+            // Operations on the same bundle are kept in order, operations without bundle are ordered against every other operation.
+            virtual std::string getOrderingKey(const std::shared_ptr<IOperation> operation) const override;
+
+            // Operations with the same bundle and item supersede each other, see rule 4.
+            virtual const std::string& getSupersessionKey(const std::shared_ptr<IOperation>& operation) const override;
+            virtual bool supersedes(const std::shared_ptr<IOperation>& newer, const std::shared_ptr<IOperation>& older) const override;
+
         public:
             GameLiftHttpClient(std::shared_ptr<Aws::Http::HttpClient> client, RequestModifier authSetter,
-                unsigned int retryIntervalSeconds, std::shared_ptr<IRetryStrategy> retryStrategy, size_t maxQueueSize, FuncLogCallback logCb) : 
-                BaseHttpClient("GameLift", client, authSetter, retryIntervalSeconds, retryStrategy, maxQueueSize, logCb)
+                unsigned int retryIntervalSeconds, std::shared_ptr<IRetryStrategy> retryStrategy, size_t maxQueueSize, FuncLogCallback logCb,
+                size_t maxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS) : 
+                BaseHttpClient("GameLift", client, authSetter, retryIntervalSeconds, retryStrategy, maxQueueSize, logCb, maxConcurrentRequests)
             {}
 
             virtual ~GameLiftHttpClient() override {}
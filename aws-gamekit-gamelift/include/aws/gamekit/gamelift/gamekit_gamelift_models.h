@@ -49,7 +49,7 @@ namespace GameKit
         unsigned int MaxRetries;
 
         /**
-         * @brief Retry strategy to use. Use 0 for Exponential Backoff, 1 for Constant Interval. Default is 0.
+         * @brief Retry strategy to use. Use 0 for Exponential Backoff, 1 for Constant Interval, 2 for Decorrelated Jitter, 3 for Decorrelated Jitter with a retry budget, 4 for Decorrelated Jitter with a retry budget and a circuit breaker per host. Default is 0.
          */
         unsigned int RetryStrategy;
 
@@ -62,5 +62,15 @@ namespace GameKit
          * @brief Number of items to retrieve when executing paginated calls such as Get All Data. Default is 100. Uses default if set to 0.
          */
         unsigned int PaginationSize;
+
+        /**
+         * @brief Maximum number of requests in flight while the retry background thread flushes the request queue. Requests on the same bundle are always sent in order. Default is 1. Uses default if set to 0.
+         */
+        unsigned int MaxConcurrentRequests;
+
+        /**
+         * @brief Seconds after which a queued request fails instead of being retried, counted from when the request is made. Set to 0 to retry until MaxRetries is reached. Default is 0.
+         */
+        unsigned int OperationTimeoutSeconds;
     };
 }
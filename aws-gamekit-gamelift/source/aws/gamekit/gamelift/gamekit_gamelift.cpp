@@ -39,6 +39,8 @@ GameLift::GameLift(Authentication::GameKitSessionManager* sessionManager, FuncLo
     m_clientSettings.RetryStrategy = DEFAULT_RETRY_STRATEGY;
     m_clientSettings.MaxExponentialRetryThreshold = DEFAULT_MAX_EXPONENTIAL_BACKOFF_THRESHOLD;
     m_clientSettings.PaginationSize = DEFAULT_PAGINATION_SIZE;
+    m_clientSettings.MaxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS;
+    m_clientSettings.OperationTimeoutSeconds = 0;
 
     m_logCb = logCb;
 
@@ -127,7 +129,7 @@ void GameLift::initializeClient()
         m_clientSettings.MaxRetries = DEFAULT_MAX_RETRIES;
     }
 
-    if (m_clientSettings.RetryStrategy > 1)
+    if (m_clientSettings.RetryStrategy > (unsigned int)StrategyType::CircuitBreaker)
     {
         // invalid value, set to default
         m_clientSettings.RetryStrategy = DEFAULT_RETRY_STRATEGY;
@@ -143,6 +145,11 @@ void GameLift::initializeClient()
         m_clientSettings.PaginationSize = DEFAULT_PAGINATION_SIZE;
     }
 
+    if (m_clientSettings.MaxConcurrentRequests == 0)
+    {
+        m_clientSettings.MaxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS;
+    }
+
     // Low level client settings
     Aws::Client::ClientConfiguration clientConfig;
     GameKit::DefaultClients::SetDefaultClientConfiguration(m_sessionManager->GetClientSettings(), clientConfig);
@@ -156,6 +163,10 @@ void GameLift::initializeClient()
     // High level settings for custom client
     auto strategyBuilder = [&]()
     {
+        // Jittered delays start at the retry interval and grow up to the exponential backoff threshold in retry intervals
+        const std::chrono::milliseconds baseRetryDelay = std::chrono::seconds(m_clientSettings.RetryIntervalSeconds);
+        const std::chrono::milliseconds maxRetryDelay = baseRetryDelay * m_clientSettings.MaxExponentialRetryThreshold;
+
         StrategyType strategyType = (StrategyType)m_clientSettings.RetryStrategy;
         std::shared_ptr<IRetryStrategy> retryLogic;
         switch (strategyType)
@@ -166,6 +177,18 @@ void GameLift::initializeClient()
         case StrategyType::ConstantInterval:
             retryLogic = std::make_shared<ConstantIntervalStrategy>();
             break;
+        case StrategyType::DecorrelatedJitter:
+            retryLogic = std::make_shared<DecorrelatedJitterStrategy>(baseRetryDelay, maxRetryDelay, m_logCb);
+            break;
+        case StrategyType::RetryBudget:
+            retryLogic = std::make_shared<RetryBudgetStrategy>(std::make_shared<DecorrelatedJitterStrategy>(baseRetryDelay, maxRetryDelay, m_logCb),
+                RETRY_BUDGET_MAX_TOKENS, RETRY_BUDGET_RETRY_COST, RETRY_BUDGET_SUCCESS_REFILL, RETRY_BUDGET_REFILL_PER_SECOND, m_logCb);
+            break;
+        case StrategyType::CircuitBreaker:
+            retryLogic = std::make_shared<CircuitBreakerStrategy>(std::make_shared<RetryBudgetStrategy>(std::make_shared<DecorrelatedJitterStrategy>(baseRetryDelay, maxRetryDelay, m_logCb),
+                RETRY_BUDGET_MAX_TOKENS, RETRY_BUDGET_RETRY_COST, RETRY_BUDGET_SUCCESS_REFILL, RETRY_BUDGET_REFILL_PER_SECOND, m_logCb),
+                maxRetryDelay, CIRCUIT_BREAKER_FAILURE_THRESHOLD, m_logCb);
+            break;
         }
 
         return retryLogic;
@@ -178,13 +201,19 @@ void GameLift::initializeClient()
     // Build custom client with retry logic
     auto retryStrategy = strategyBuilder();
     m_customHttpClient = std::make_shared<GameLiftHttpClient>(
-        lowLevelHttpClient, authSetter, m_clientSettings.RetryIntervalSeconds, retryStrategy, m_clientSettings.MaxRetryQueueSize, m_logCb);
+        lowLevelHttpClient, authSetter, m_clientSettings.RetryIntervalSeconds, retryStrategy, m_clientSettings.MaxRetryQueueSize, m_logCb, m_clientSettings.MaxConcurrentRequests);
+    m_customHttpClient->SetOperationTimeout(std::chrono::seconds(m_clientSettings.OperationTimeoutSeconds));
+
+    // Retries only set the authorization header again after the session tokens changed
+    Authentication::GameKitSessionManager* sessionManager = m_sessionManager;
+    m_customHttpClient->SetAuthorizationVersionGetter([sessionManager]() { return sessionManager->GetSessionTokensVersion(); });
 }
 
 void GameLift::setAuthorizationHeader(std::shared_ptr<HttpRequest> request)
 {
-    std::string value = "Bearer " + m_sessionManager->GetToken(GameKit::TokenType::IdToken);
-    request->SetHeaderValue(HEADER_AUTHORIZATION, ToAwsString(value));
+    // The header value is formatted once per token, when the session manager publishes it
+    const std::shared_ptr<const Authentication::SessionTokens> tokens = m_sessionManager->GetSessionTokens();
+    request->SetHeaderValue(HEADER_AUTHORIZATION, tokens->BearerAuthorization);
 }
 
 void GameLift::setPaginationLimit(std::shared_ptr<HttpRequest> request, unsigned int paginationLimit)
@@ -131,63 +131,18 @@ RequestResult GameLiftHttpClient::MakeRequest(GameLiftOperationType operationTyp
 void GameLiftHttpClient::filterQueue(OperationQueue* queue, OperationQueue* filtered)
 {
     Logging::Log(m_logCb, Level::Verbose, "GameLiftHttpClient::FilterQueue");
-    std::map<std::string, std::deque<GameLiftOperation*>> temp;
     unsigned int operationsDiscarded = 0;
 
-    // Sort queue based on timestamp. Order is important for User Gameplay Data filtering
-    std::sort(queue->begin(), queue->end(), OperationTimestampCompare);
-
-    for (auto operationIt = queue->begin(); operationIt != queue->end(); ++operationIt)
-    {
-        GameLiftOperation* operation = static_cast<GameLiftOperation*>((*operationIt).get());
-
-        auto& queueWithSameKey = temp[operation->OperationUniqueKey];
-
-        if (queueWithSameKey.empty())
-        {
-            queueWithSameKey.push_back(operation);
-        }
-        else
-        {
-            auto& previousOperation = queueWithSameKey.back();
-
-            // If keys don't match, keep both.
-            // Some rare coincidence caused two operations to be mapped to the same queue
-            if (operation->Bundle != previousOperation->Bundle ||
-                operation->ItemKey != previousOperation->ItemKey)
-            {
-                Logging::Log(m_logCb, Level::Warning, "GameLiftOperation key mismatch, keeping both operations.");
-                queueWithSameKey.push_back(operation);
-            }
-
-            // If this is an item-level operation, most recent one is kept
-            // If this is a bundle-level operation, or global,
-            // and if most recent is delete, keep delete, else keep both
-
-            if (!operation->ItemKey.empty() && !previousOperation->ItemKey.empty())
-            {
-                Logging::Log(m_logCb, Level::Verbose, "Discarding previous item operation, newer operation overwrites data.");
-                previousOperation->Discard = true;
-                queueWithSameKey.pop_back();
-            }
-            else if (operation->Type == GameLiftOperationType::Delete)
-            {
-                Logging::Log(m_logCb, Level::Verbose, "Discarding previous bundle operation, newer operation overwrites data.");
-                previousOperation->Discard = true;
-                queueWithSameKey.pop_back();
-            }
-
-            queueWithSameKey.push_back(operation);
-        }
-    }
-
-    // Enqueue non discarded operations
+    // Older operations were discarded when a newer operation superseding them was enqueued, the queue is already in order
     for (auto& operation : *queue)
     {
-        if (!operation->Discard)
+        if (operation->Discard)
         {
-            filtered->push_back(operation);
+            operationsDiscarded++;
+            continue;
         }
+
+        filtered->push_back(operation);
     }
 
     std::string message = "GameLiftHttpClient::FilterQueue. Discarded " + std::to_string(operationsDiscarded) + " operations.";
@@ -217,4 +172,39 @@ bool GameLiftHttpClient::isOperationRetryable(const std::shared_ptr<IOperation>
         ugpdOperation->Type != GameLiftOperationType::Get &&
         isResponseRetryable;
 }
+
+std::string GameLiftHttpClient::getOrderingKey(const std::shared_ptr<IOperation> operation) const
+{
+    auto ugpdOperation = static_cast<const GameLiftOperation*>(operation.get());
+
+    // Bundle level operations may affect every item in the bundle, so items are ordered per bundle rather than per item
+    return ugpdOperation->Bundle;
+}
+
+const std::string& GameLiftHttpClient::getSupersessionKey(const std::shared_ptr<IOperation>& operation) const
+{
+    return static_cast<const GameLiftOperation*>(operation.get())->OperationUniqueKey;
+}
+
+bool GameLiftHttpClient::supersedes(const std::shared_ptr<IOperation>& newer, const std::shared_ptr<IOperation>& older) const
+{
+    auto newerOperation = static_cast<const GameLiftOperation*>(newer.get());
+    auto olderOperation = static_cast<const GameLiftOperation*>(older.get());
+
+    // If this is an item-level operation, most recent one is kept
+    // If this is a bundle-level operation, or global, and if most recent is delete, keep delete, else keep both
+    if (!newerOperation->ItemKey.empty() && !olderOperation->ItemKey.empty())
+    {
+        Logging::Log(m_logCb, Level::Verbose, "Discarding previous item operation, newer operation overwrites data.");
+        return true;
+    }
+
+    if (newerOperation->Type == GameLiftOperationType::Delete)
+    {
+        Logging::Log(m_logCb, Level::Verbose, "Discarding previous bundle operation, newer operation overwrites data.");
+        return true;
+    }
+
+    return false;
+}
 #pragma endregion
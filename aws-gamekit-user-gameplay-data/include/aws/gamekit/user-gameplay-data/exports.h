@@ -45,6 +45,9 @@
   * StartRetryBackgroundThread() - Starts the background thread that controls when cached calls will be retried. Should be started after loading from cache and before making any API calls.
   * StopRetryBackgroundThread() - Stops the background thread that controls when cached calls will be retried. Should be stopped before modifying the queue, like in PersistToCache().
   *
+  * To keep queued calls if the game crashes before PersistToCache() is called, OpenApiCallsJournal() can be called before starting the retry background thread.
+  * Queued calls are then appended to the journal file as they are made, and calls left in the journal by a previous session are enqueued again.
+  *
   * # Successive offline calls to the same Bundle Item
   * If there are calls that should overwrite one another such as two Update calls made to the same Bundle Item. The queue will automatically prune itself and only take the most up to date values.
   */
@@ -66,6 +69,8 @@ typedef void* GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE;
 typedef void(*FuncListGameplayDataBundlesResponseCallback)(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* responseBundleName);
 typedef void(*FuncBundleResponseCallback)(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* responseKey, const char* responseValue);
 typedef void(*FuncBundleItemResponseCallback)(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* responseValue);
+typedef void(*FuncListGameplayDataBundlesBatchResponseCallback)(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* const* responseBundleNames, unsigned int count);
+typedef void(*FuncBundleBatchResponseCallback)(DISPATCH_RECEIVER_HANDLE dispatchReceiver, const char* const* responseKeys, const char* const* responseValues, unsigned int count);
 
 extern "C"
 {
@@ -127,6 +132,18 @@ extern "C"
      */
     GAMEKIT_API unsigned int GameKitListUserGameplayDataBundles(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncListGameplayDataBundlesResponseCallback responseCallback);
 
+    /**
+     * @brief Gets the names of all bundles stored for the calling user, dispatched one page at a time.
+     *
+     * @details Same as GameKitListUserGameplayDataBundles() with a single callback per page of bundle names. The next page is requested while the current one is dispatched.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitGameplayData instance created with GameKitGameplayDataInstanceCreateWithSessionManager()
+     * @param receiver A pointer to an instance of a class where the results will be dispatched to.
+     * @param responseCallback A static dispatcher function pointer that receives an array of char* bundle names and its length. The array and the strings are only valid during the callback.
+     * @return A GameKit status code indicating the result of the API call. The possible status codes are the same as GameKitListUserGameplayDataBundles().
+     */
+    GAMEKIT_API unsigned int GameKitListUserGameplayDataBundlesBatch(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncListGameplayDataBundlesBatchResponseCallback responseCallback);
+
     /**
      * @brief Gets gameplay data stored for the calling user from a specific bundle.
      *
@@ -142,11 +159,25 @@ extern "C"
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_FAILED: The call made to the backend service has failed.
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_DROPPED: The call made to the backend service has been dropped.
      * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED: The call made to the backend service has been enqueued as connection may be unhealthy and will automatically be retried.
+     * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_CACHED_VALUE: The backend service could not be reached and the items were dispatched from the read cache, they may be outdated.
      * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The response body from the backend could not be parsed successfully
      * - GAMEKIT_ERROR_GENERAL: The request has failed unknown reason.
      */
     GAMEKIT_API unsigned int GameKitGetUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleResponseCallback responseCallback);
 
+    /**
+     * @brief Gets gameplay data stored for the calling user from a specific bundle, dispatched one page at a time.
+     *
+     * @details Same as GameKitGetUserGameplayDataBundle() with a single callback per page of items. The next page is requested while the current one is dispatched.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitGameplayData instance created with GameKitGameplayDataInstanceCreateWithSessionManager().
+     * @param bundleName The name of the bundle that should be referenced in DyanmoDB.
+     * @param receiver A pointer to an instance of a class where the results will be dispatched to.
+     * @param responseCallback A static dispatcher function pointer that receives parallel arrays of char* keys and values and their length. The arrays and the strings are only valid during the callback.
+     * @return A GameKit status code indicating the result of the API call. The possible status codes are the same as GameKitGetUserGameplayDataBundle().
+     */
+    GAMEKIT_API unsigned int GameKitGetUserGameplayDataBundleBatch(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleBatchResponseCallback responseCallback);
+
     /**
      * @brief Gets a single stored item from a specific bundle for the calling user.
      *
@@ -163,10 +194,33 @@ extern "C"
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_FAILED: The call made to the backend service has failed.
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_DROPPED: The call made to the backend service has been dropped.
      * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_API_CALL_ENQUEUED: The call made to the backend service has been enqueued as connection may be unhealthy and will automatically be retried.
+     * - GAMEKIT_WARNING_USER_GAMEPLAY_DATA_CACHED_VALUE: The backend service could not be reached and the value was dispatched from the read cache, it may be outdated.
      * - GAMEKIT_ERROR_GENERAL: The request has failed unknown reason.
      */
     GAMEKIT_API unsigned int GameKitGetUserGameplayDataBundleItem(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, GameKit::UserGameplayDataBundleItem userGameplayDataBundleItem, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleItemResponseCallback responseCallback);
 
+    /**
+     * @brief Brings the local mirror of a bundle up to date, only the items changed since the last sync of the bundle are requested.
+     * The first sync of a bundle reads every item. Use GameKitUserGameplayDataPersistBundleSyncState() and GameKitUserGameplayDataLoadBundleSyncState() to keep the mirror across sessions.
+     * The mirrors belong to the player they were synced for, they are dropped when another player syncs a bundle.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitGameplayData instance created with GameKitGameplayDataInstanceCreateWithSessionManager().
+     * @param bundleName The name of the bundle that should be synced.
+     * @param receiver A pointer to an instance of a class where the results will be dispatched to.
+     * @param changedItemsCallback A static dispatcher function pointer that receives char* key/value pairs for the items added or updated since the last sync,
+     * and the key with a nullptr value for the items deleted since the last sync.
+     * @return A GameKit status code indicating the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
+     * - GAMEKIT_SUCCESS: The API call was successful.
+     * - GAMEKIT_ERROR_SETTINGS_MISSING: One or more settings required for calling the backend are missing and the backend wasn't called. Verify the feature is deployed and the config is correct.
+     * - GAMEKIT_ERROR_MALFORMED_BUNDLE_NAME: The bundleName is malformed. If this error is received, Check the output log for more details on requirements.
+     * - GAMEKIT_ERROR_NO_ID_TOKEN: The player is not logged in. You must login the player through the Identity & Authentication feature (AwsGameKitIdentity) before calling this method.
+     * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_FAILED: The call made to the backend service has failed, the local mirror is left at its previous version.
+     * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_API_CALL_DROPPED: The call made to the backend service has been dropped.
+     * - GAMEKIT_ERROR_PARSE_JSON_FAILED: The response from the backend could not be parsed.
+     * - GAMEKIT_ERROR_GENERAL: The request has failed unknown reason.
+     */
+    GAMEKIT_API unsigned int GameKitSyncUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleResponseCallback changedItemsCallback);
+
     /**
      * @brief Updates a single item inside of a bundle for the calling user.
      *
@@ -282,6 +336,39 @@ extern "C"
      */
     GAMEKIT_API void GameKitUserGameplayDataDropAllCachedEvents(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance);
 
+    /**
+     * @brief Drop every bundle and item held by the read cache, the next reads are made against the backend.
+     * The read cache is enabled with UserGameplayDataClientSettings::ReadCacheTtlSeconds.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitGameplayData instance created with GameKitGameplayDataInstanceCreateWithSessionManager()
+     */
+    GAMEKIT_API void GameKitUserGameplayDataClearReadCache(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance);
+
+    /**
+     * @brief Write the local mirror of every bundle synced with GameKitSyncUserGameplayDataBundle() to a file.
+     * The sync state records the player it was synced for, a player loading another player's state syncs every bundle from scratch.
+     * The file is replaced in one step, a failed write keeps the previous sync state.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitGameplayData instance created with GameKitGameplayDataInstanceCreateWithSessionManager()
+     * @param syncStateFile path to the sync state file.
+     * @return A GameKit status code indicating the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
+     * - GAMEKIT_SUCCESS: The API call was successful.
+     * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_WRITE_FAILED: There was an issue writing the sync state file.
+     */
+    GAMEKIT_API unsigned int GameKitUserGameplayDataPersistBundleSyncState(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* syncStateFile);
+
+    /**
+     * @brief Replace the bundle sync state held in memory with the one written by GameKitUserGameplayDataPersistBundleSyncState().
+     * Should be called after the player logs in and before the first GameKitSyncUserGameplayDataBundle(). A missing file leaves no bundle synced.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitGameplayData instance created with GameKitGameplayDataInstanceCreateWithSessionManager()
+     * @param syncStateFile path to the sync state file.
+     * @return A GameKit status code indicating the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
+     * - GAMEKIT_SUCCESS: The API call was successful.
+     * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_READ_FAILED: There was an issue reading the sync state file.
+     */
+    GAMEKIT_API unsigned int GameKitUserGameplayDataLoadBundleSyncState(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* syncStateFile);
+
     /**
      * @brief Write the pending API calls to cache.
      * Pending API calls are requests that could not be sent due to network being offline or other failures.
@@ -307,4 +394,26 @@ extern "C"
      * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_READ_FAILED: There was an issue loading the offline cache file to the queue.
      */
     GAMEKIT_API unsigned int GameKitUserGameplayDataLoadApiCallsFromCache(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* offlineCacheFile);
+
+    /**
+     * @brief Keep a journal of the pending API calls so they survive a crash.
+     * Each queued call is appended to the journal as it is enqueued, calls that are sent or discarded are recorded as removed.
+     * Calls left in the journal by a previous session are enqueued and retried as soon as the Retry background thread is started.
+     * The Retry background thread must be stopped when calling this method.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitGameplayData instance created with GameKitGameplayDataInstanceCreateWithSessionManager()
+     * @param journalFile path to the journal file.
+     * @return A GameKit status code indicating the result of the API call. Status codes are defined in errors.h. This method's possible status codes are listed below:
+     * - GAMEKIT_SUCCESS: The API call was successful.
+     * - GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_READ_FAILED: There was an issue opening the journal file.
+     */
+    GAMEKIT_API unsigned int GameKitUserGameplayDataOpenApiCallsJournal(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* journalFile);
+
+    /**
+     * @brief Stop journaling the pending API calls. Calls still in the queue stay in the journal file.
+     * The Retry background thread must be stopped when calling this method.
+     *
+     * @param userGameplayDataInstance Pointer to GameKitGameplayData instance created with GameKitGameplayDataInstanceCreateWithSessionManager()
+     */
+    GAMEKIT_API void GameKitUserGameplayDataCloseApiCallsJournal(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance);
 }
@@ -7,15 +7,19 @@
 #include <algorithm>
 #include <chrono>
 #include <deque>
+#include <functional>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // AWS SDK
 #include <aws/cognito-idp/CognitoIdentityProviderClient.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/json/JsonSerializer.h>
 
 // GameKit
 #include <aws/gamekit/authentication/gamekit_session_manager.h>
@@ -48,8 +52,11 @@ namespace GameKit
             virtual unsigned int AddUserGameplayData(UserGameplayDataBundle userGameplayDataBundle, DISPATCH_RECEIVER_HANDLE unprocessedItemsReceiver, FuncBundleResponseCallback unprocessedItemsCallback) = 0;
 
             virtual unsigned int ListUserGameplayDataBundles(DISPATCH_RECEIVER_HANDLE receiver, FuncListGameplayDataBundlesResponseCallback responseCallback) = 0;
+            virtual unsigned int ListUserGameplayDataBundlesBatch(DISPATCH_RECEIVER_HANDLE receiver, FuncListGameplayDataBundlesBatchResponseCallback responseCallback) = 0;
             virtual unsigned int GetUserGameplayDataBundle(char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleResponseCallback responseCallback) = 0;
+            virtual unsigned int GetUserGameplayDataBundleBatch(char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleBatchResponseCallback responseCallback) = 0;
             virtual unsigned int GetUserGameplayDataBundleItem(UserGameplayDataBundleItem userGameplayDataBundleItem, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleItemResponseCallback responseCallback) = 0;
+            virtual unsigned int SyncUserGameplayDataBundle(char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleResponseCallback changedItemsCallback) = 0;
 
             virtual unsigned int UpdateUserGameplayDataBundleItem(UserGameplayDataBundleItemValue userGameplayDataBundleItemValue) = 0;
 
@@ -61,6 +68,8 @@ namespace GameKit
     namespace UserGameplayData
     {
         static const Aws::String HEADER_AUTHORIZATION = "Authorization";
+        static const Aws::String HEADER_ETAG = "etag";
+        static const Aws::String HEADER_IF_NONE_MATCH = "if-none-match";
         static const Aws::String BUNDLE_NAME = "bundle_name";
         static const Aws::String BUNDLE_NAMES = "bundle_names";
         static const Aws::String BUNDLE_ITEMS = "bundle_items";
@@ -73,6 +82,9 @@ namespace GameKit
         static const Aws::String CONSISTENT_READ_KEY = "use_consistent_read";
         static const Aws::String LIMIT_KEY = "limit";
         static const Aws::String UNPROCESSED_ITEMS = "unprocessed_items";
+        static const Aws::String SINCE_VERSION_KEY = "since_version";
+        static const Aws::String BUNDLE_VERSION = "bundle_version";
+        static const Aws::String DELETED_BUNDLE_ITEM_KEYS = "deleted_bundle_item_keys";
 
         static const std::string LIST_BUNDLES_PATH = "/bundles";
         static const std::string BUNDLES_PATH_PART = "/bundles/";
@@ -85,10 +97,104 @@ namespace GameKit
                 std::shared_ptr<UserGameplayDataHttpClient> m_customHttpClient;
                 UserGameplayDataClientSettings m_clientSettings;
 
+                // Read cache entries, an entry is fresh for ReadCacheTtlSeconds after it was last validated against the backend
+                enum class ReadCacheEntryState
+                {
+                    Missing = 0,
+                    Stale,
+                    Fresh
+                };
+
+                struct CachedBundleItem
+                {
+                    std::string Value;
+                    std::string ETag;
+                    std::chrono::steady_clock::time_point ValidatedAt;
+                };
+
+                struct CachedBundle
+                {
+                    std::map<std::string, CachedBundleItem> Items;
+
+                    // True when Items holds every item of the bundle, that is the bundle itself was read or every item was written since
+                    bool IsComplete = false;
+                    std::string ETag;
+                    std::chrono::steady_clock::time_point ValidatedAt;
+                };
+
+                std::map<std::string, CachedBundle> m_readCache;
+
+                // Id token the read cache was filled with, the cache is dropped when another token is used
+                std::string m_readCacheIdToken;
+                std::mutex m_readCacheMutex;
+
+                // Local mirror of a synced bundle, Version is the bundle version the backend returned with the last sync
+                struct SyncedBundle
+                {
+                    std::string Version;
+                    std::map<std::string, std::string> Items;
+                };
+
+                std::map<std::string, SyncedBundle> m_syncedBundles;
+
+                // Player the mirrors were synced for, the mirrors are dropped when another player syncs. Guarded by m_syncedBundlesMutex.
+                std::string m_syncedBundlesPlayerId;
+                std::mutex m_syncedBundlesMutex;
+
+                // The sync state file starts with BUNDLE_SYNC_FILE_MAGIC, BUNDLE_SYNC_FILE_VERSION and the bundle count, followed by a record holding the player id and one record per bundle, each framed with its length and CRC.
+                static const uint32_t BUNDLE_SYNC_FILE_MAGIC = 0x5347554B;
+                static const uint32_t BUNDLE_SYNC_FILE_VERSION = 2;
+
+                // Receive the items of one page, the arrays and strings are only valid until the handler returns
+                typedef std::function<void(const char* const* bundleNames, size_t count)> BundleNamesPageHandler;
+                typedef std::function<void(const char* const* itemKeys, const char* const* itemValues, size_t count)> BundlePageHandler;
+
                 void initializeClient();
+                void clampClientSetting(const char* settingName, unsigned int& value, unsigned int maxValue) const;
                 void setAuthorizationHeader(std::shared_ptr<Aws::Http::HttpRequest> request);
                 void setPaginationLimit(std::shared_ptr<Aws::Http::HttpRequest> request, unsigned int paginationLimit);
 
+                // Paginated reads, the request for the next page is in flight while the current page is dispatched to the handler
+                unsigned int listUserGameplayDataBundles(const BundleNamesPageHandler& pageHandler);
+                unsigned int getUserGameplayDataBundle(char* bundleName, const BundlePageHandler& pageHandler);
+                std::shared_ptr<Aws::Http::HttpRequest> createPageRequest(const std::string& uri, const Aws::String& startKey, const Aws::String& pagingToken);
+                void readPagingKeys(const Aws::Utils::Json::JsonView& bodyView, Aws::String& outStartKey, Aws::String& outPagingToken) const;
+                static void dispatchBundleItems(const std::map<std::string, std::string>& items, const BundlePageHandler& pageHandler);
+
+                // Bundle sync helpers, a bundle with no sync state is synced from scratch
+                void dropSyncedBundle(const std::string& bundleName);
+                void clearSyncedBundles();
+
+                // Must be called with m_syncedBundlesMutex held, drops the mirrors if they were synced for another player
+                void resetSyncedBundlesOnPlayerChange(const std::string& playerId);
+
+                // The sub claim of the id token, which stays the same when the token is refreshed. A hash of the token when it has no readable sub claim, the token itself is never persisted.
+                static std::string playerIdFromIdToken(const std::string& idToken);
+                static std::string encodeSyncedBundleRecord(const std::string& bundleName, const SyncedBundle& bundle);
+                static bool decodeSyncedBundleRecord(const char* record, size_t length, std::string& outBundleName, SyncedBundle& outBundle);
+
+                // Read cache helpers, they do nothing when ReadCacheTtlSeconds is 0. m_readCacheMutex must not be held by the caller.
+                ReadCacheEntryState getCachedBundle(const std::string& idToken, const std::string& bundleName, std::map<std::string, std::string>& outItems, std::string& outETag);
+                ReadCacheEntryState getCachedBundleItem(const std::string& idToken, const std::string& bundleName, const std::string& itemKey, std::string& outValue, std::string& outETag);
+                void storeCachedBundle(const std::string& idToken, const std::string& bundleName, const std::map<std::string, std::string>& items, const std::string& eTag);
+                void storeCachedBundleItem(const std::string& idToken, const std::string& bundleName, const std::string& itemKey, const std::string& value, const std::string& eTag);
+                void storeCachedBundleItems(const std::string& idToken, const std::string& bundleName, const std::map<std::string, std::string>& writtenItems);
+                void revalidateCachedBundle(const std::string& bundleName);
+                void revalidateCachedBundleItem(const std::string& bundleName, const std::string& itemKey);
+                void invalidateCachedBundle(const std::string& bundleName);
+                void invalidateCachedBundleItems(const std::string& bundleName, const std::vector<std::string>& itemKeys);
+                void clearReadCache();
+
+                // Must be called with m_readCacheMutex held, drops the cache if it was filled for another id token
+                void resetReadCacheOnTokenChange(const std::string& idToken);
+                bool isReadCacheEntryFresh(const std::chrono::steady_clock::time_point& validatedAt) const;
+
+                // True if the write was made or enqueued, in which case the backend will hold the written values
+                static bool isWriteAccepted(const RequestResult& result);
+
+                // True if the request did not reach a backend able to answer, cached values may then be served
+                static bool isBackendUnreachable(const RequestResult& result);
+
                 /**
                  * @brief Validates that the passed in bundle item keys are properly formatted and do not contain illegal characters
                  * @return True if the keys are valid, false otherwise
@@ -155,6 +261,16 @@ namespace GameKit
                 */
                 unsigned int ListUserGameplayDataBundles(DISPATCH_RECEIVER_HANDLE receiver, FuncListGameplayDataBundlesResponseCallback responseCallback) override;
 
+                /**
+                 * @brief Same as ListUserGameplayDataBundles(), with one callback per page of bundle names instead of one per bundle name.
+                 *
+                 * @param receiver A pointer to an instance of a class where the results will be dispatched to.
+                 * @param responseCallback A static dispatcher function pointer that receives an array of char* bundle names and its length for each page.
+                 * The array and the strings are only valid during the callback.
+                 * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+                */
+                unsigned int ListUserGameplayDataBundlesBatch(DISPATCH_RECEIVER_HANDLE receiver, FuncListGameplayDataBundlesBatchResponseCallback responseCallback) override;
+
                 /**
                  * @brief Gets all items that are associated with a certain bundle for a user.
                  * All items are returned in char* format and can be converted to fit their use case after retrieval from DynamoDB.
@@ -164,9 +280,22 @@ namespace GameKit
                  * This instance must have a method signature of void ReceiveResult(const char* responseKey, const char* responseValue)
                  * @param responseCallback A static dispatcher function pointer that receives char* key/value pairs.
                  * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+                 * GAMEKIT_WARNING_USER_GAMEPLAY_DATA_CACHED_VALUE is returned when the backend could not be reached and the read cache answered instead.
                 */
                 unsigned int GetUserGameplayDataBundle(char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleResponseCallback responseCallback) override;
 
+                /**
+                 * @brief Same as GetUserGameplayDataBundle(), with one callback per page of items instead of one per item.
+                 *
+                 * @param bundleName The name of the bundle that is being retrieved.
+                 * @param receiver A pointer to an instance of a class where the results will be dispatched to.
+                 * @param responseCallback A static dispatcher function pointer that receives parallel arrays of char* keys and values and their length for each page.
+                 * The arrays and the strings are only valid during the callback.
+                 * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+                 * GAMEKIT_WARNING_USER_GAMEPLAY_DATA_CACHED_VALUE is returned when the backend could not be reached and the read cache answered instead.
+                */
+                unsigned int GetUserGameplayDataBundleBatch(char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleBatchResponseCallback responseCallback) override;
+
                 /**
                  * @brief Gets a single item that is associated with a certain bundle for a user.
                  * All items are returned in char* format and can be converted to fit their use case after retrieval from DynamoDB.
@@ -176,9 +305,24 @@ namespace GameKit
                  * This instance must have a method signature of void ReceiveResult(const char* responseValue)
                  * @param responseCallback A static dispatcher function pointer that receives a single char* value.
                  * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+                 * GAMEKIT_WARNING_USER_GAMEPLAY_DATA_CACHED_VALUE is returned when the backend could not be reached and the read cache answered instead.
                 */
                 unsigned int GetUserGameplayDataBundleItem(UserGameplayDataBundleItem userGameplayDataBundleItem, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleItemResponseCallback responseCallback) override;
 
+                /**
+                 * @brief Brings the local mirror of a bundle up to date, only the items changed since the last sync are requested.
+                 * The first sync of a bundle reads every item. The mirror is kept in memory, use PersistBundleSyncState() and LoadBundleSyncState() to keep it across sessions.
+                 * When the read cache is enabled, the synced bundle is stored in it so GetUserGameplayDataBundle() can answer without a request.
+                 *
+                 * @param bundleName The name of the bundle that is being synced.
+                 * @param receiver A pointer to an instance of a class where the results will be dispatched to.
+                 * This instance must have a method signature of void ReceiveResult(const char* responseKey, const char* responseValue)
+                 * @param changedItemsCallback A static dispatcher function pointer that receives char* key/value pairs for each item added or updated since the last sync,
+                 * and the key with a nullptr value for each item deleted since the last sync.
+                 * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+                */
+                unsigned int SyncUserGameplayDataBundle(char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleResponseCallback changedItemsCallback) override;
+
                 /**
                  * @brief Updates the value of an existing item inside a bundle with new item data.
                  *
@@ -241,6 +385,30 @@ namespace GameKit
                 */
                 void DropAllCachedEvents();
 
+                /**
+                 * @brief Drop every bundle and item held by the read cache, the next reads are made against the backend.
+                 * The read cache is enabled with UserGameplayDataClientSettings::ReadCacheTtlSeconds.
+                */
+                void ClearReadCache();
+
+                /**
+                 * @brief Write the local mirror of every synced bundle, along with its version, to a file.
+                 * The sync state belongs to the player that is logged in, use one file per player.
+                 *
+                 * @param syncStateFile path to the sync state file.
+                 * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+                */
+                unsigned int PersistBundleSyncState(const std::string& syncStateFile);
+
+                /**
+                 * @brief Replace the sync state held in memory with the one written by PersistBundleSyncState().
+                 * Should be called after the player logs in and before the first SyncUserGameplayDataBundle(). A missing file leaves no bundle synced.
+                 *
+                 * @param syncStateFile path to the sync state file.
+                 * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+                */
+                unsigned int LoadBundleSyncState(const std::string& syncStateFile);
+
                 /**
                  * @brief Write the pending API calls to cache.
                  * Pending API calls are requests that could not be sent due to network being offline or other failures.
@@ -260,6 +428,23 @@ namespace GameKit
                  * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
                 */
                 unsigned int LoadApiCallsFromCache(const std::string& offlineCacheFile);
+
+                /**
+                 * @brief Keep a journal of the pending API calls so they survive a crash.
+                 * Each queued call is appended to the journal as it is enqueued, calls that are sent or discarded are recorded as removed.
+                 * Calls left in the journal by a previous session are enqueued the same way LoadApiCallsFromCache() does.
+                 * The Retry background thread must be stopped when calling this method.
+                 *
+                 * @param journalFile path to the journal file.
+                 * @return GameKit status code, GAMEKIT_SUCCESS on success else non-zero value. Consult errors.h file for details.
+                */
+                unsigned int OpenApiCallsJournal(const std::string& journalFile);
+
+                /**
+                 * @brief Stop journaling the pending API calls. Calls still in the queue stay in the journal file.
+                 * The Retry background thread must be stopped when calling this method.
+                */
+                void CloseApiCallsJournal();
         };
     }
 }
@@ -11,6 +11,7 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // AWS SDK
 #include <aws/cognito-idp/CognitoIdentityProviderClient.h>
@@ -31,6 +32,9 @@
 using namespace GameKit::Logger;
 using namespace GameKit::Utils::HttpClient;
 
+// Maximum number of items folded into a single bundle write when queued writes are batched
+#define MAX_BATCHED_BUNDLE_ITEMS 100
+
 namespace GameKit
 {
     namespace UserGameplayData
@@ -59,6 +63,9 @@ namespace GameKit
 
             const std::string OperationUniqueKey;
 
+            // Operations folded into this bundle write when the queue was batched, their callbacks are invoked with the response of this operation.
+            std::vector<std::shared_ptr<UserGameplayDataOperation>> BatchedOperations;
+
             static bool TrySerializeBinary(std::ostream& os, const std::shared_ptr<IOperation> operation, FuncLogCallback logCb = nullptr);
             static bool TrySerializeBinary(std::ostream& os, const std::shared_ptr<UserGameplayDataOperation> operation, FuncLogCallback logCb = nullptr);
             static bool TryDeserializeBinary(std::istream& is, std::shared_ptr<IOperation>& outOperation, FuncLogCallback logCb = nullptr);
@@ -70,23 +77,35 @@ namespace GameKit
         // 1. If the background thread is not running, all calls are synchronous by default (even if the async flag is set to true)
         // 2. In Healthy mode, all calls are synchronous by default. Calls can be made async with flag and can provide success/failure callbacks.
         // 3. In Unhealthy mode, Add, Update and Delete API calls are kept in an internal queue. Get API calls are rejected.
-        // 4. In Unhealthy mode, accumulated requests are preprocessed so that when multiple Add/Update and Delete operations for a single
-        //    have been enqueued for a unique bundle-item combination, the most recent is kept and the old are discarded.
+        // 4. In Unhealthy mode, when multiple Add/Update and Delete operations for a single unique bundle-item combination are enqueued,
+        //    the most recent is kept and the old are discarded as soon as the new one is enqueued.
         // 5. Calls are retried in order from oldest to newest, user provided callbacks are invoked on success. 
         // 6. Default Unhealthy retry strategy is Exponential Backoff.
+        // 7. After filtering, consecutive Add/Update operations on the same bundle are folded into a single bundle write. Each folded operation
+        //    gets its own success or failure callback, items reported as unprocessed by the backend fail their operation.
         class GAMEKIT_API UserGameplayDataHttpClient : public BaseHttpClient
         {
         private:
+            // Fold consecutive Write operations on the same bundle in the filtered queue into a single bundle write. Returns the number of operations folded.
+            size_t batchBundleWrites(OperationQueue* filtered) const;
 
         protected:
             virtual void filterQueue(OperationQueue* queue, OperationQueue* filtered) override;
             virtual bool shouldEnqueueWithUnhealthyConnection(const std::shared_ptr<IOperation> operation) const override;
             virtual bool isOperationRetryable(const std::shared_ptr<IOperation> operation, std::shared_ptr<const Aws::Http::HttpResponse> response) const override;\
 
+            // Operations on the same bundle are kept in order, operations without bundle are ordered against every other operation.
+            virtual std::string getOrderingKey(const std::shared_ptr<IOperation> operation) const override;
+
+            // Operations with the same bundle and item supersede each other, see rule 4.
+            virtual const std::string& getSupersessionKey(const std::shared_ptr<IOperation>& operation) const override;
+            virtual bool supersedes(const std::shared_ptr<IOperation>& newer, const std::shared_ptr<IOperation>& older) const override;
+
         public:
             UserGameplayDataHttpClient(std::shared_ptr<Aws::Http::HttpClient> client, RequestModifier authSetter,
-                unsigned int retryIntervalSeconds, std::shared_ptr<IRetryStrategy> retryStrategy, size_t maxQueueSize, FuncLogCallback logCb) : 
-                BaseHttpClient("UserGameplayData", client, authSetter, retryIntervalSeconds, retryStrategy, maxQueueSize, logCb)
+                unsigned int retryIntervalSeconds, std::shared_ptr<IRetryStrategy> retryStrategy, size_t maxQueueSize, FuncLogCallback logCb,
+                size_t maxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS) : 
+                BaseHttpClient("UserGameplayData", client, authSetter, retryIntervalSeconds, retryStrategy, maxQueueSize, logCb, maxConcurrentRequests)
             {}
 
             virtual ~UserGameplayDataHttpClient() override {}
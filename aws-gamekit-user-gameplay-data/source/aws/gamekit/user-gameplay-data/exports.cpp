@@ -36,16 +36,31 @@ unsigned int GameKitListUserGameplayDataBundles(GAMEKIT_USER_GAMEPLAY_DATA_INSTA
     return ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->ListUserGameplayDataBundles(receiver, responseCallback);
 }
 
+unsigned int GameKitListUserGameplayDataBundlesBatch(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, DISPATCH_RECEIVER_HANDLE receiver, FuncListGameplayDataBundlesBatchResponseCallback responseCallback)
+{
+    return ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->ListUserGameplayDataBundlesBatch(receiver, responseCallback);
+}
+
 unsigned int GameKitGetUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleResponseCallback responseCallback)
 {
     return ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->GetUserGameplayDataBundle(bundleName, receiver, responseCallback);
 }
 
+unsigned int GameKitGetUserGameplayDataBundleBatch(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleBatchResponseCallback responseCallback)
+{
+    return ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->GetUserGameplayDataBundleBatch(bundleName, receiver, responseCallback);
+}
+
 unsigned int GameKitGetUserGameplayDataBundleItem(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, GameKit::UserGameplayDataBundleItem userGameplayDataBundleItem, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleItemResponseCallback responseCallback)
 {
     return ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->GetUserGameplayDataBundleItem(userGameplayDataBundleItem, receiver, responseCallback);
 }
 
+unsigned int GameKitSyncUserGameplayDataBundle(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleResponseCallback changedItemsCallback)
+{
+    return ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->SyncUserGameplayDataBundle(bundleName, receiver, changedItemsCallback);
+}
+
 //Update
 unsigned int GameKitUpdateUserGameplayDataBundleItem(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, GameKit::UserGameplayDataBundleItemValue userGameplayDataBundleItemValue)
 {
@@ -98,6 +113,21 @@ void GameKitUserGameplayDataDropAllCachedEvents(GAMEKIT_USER_GAMEPLAY_DATA_INSTA
     ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->DropAllCachedEvents();
 }
 
+void GameKitUserGameplayDataClearReadCache(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
+{
+    ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->ClearReadCache();
+}
+
+unsigned int GameKitUserGameplayDataPersistBundleSyncState(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* syncStateFile)
+{
+    return ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->PersistBundleSyncState(syncStateFile);
+}
+
+unsigned int GameKitUserGameplayDataLoadBundleSyncState(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* syncStateFile)
+{
+    return ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->LoadBundleSyncState(syncStateFile);
+}
+
 unsigned int GameKitUserGameplayDataPersistApiCallsToCache(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* offlineCacheFile)
 {
     return ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->PersistApiCallsToCache(offlineCacheFile);
@@ -107,3 +137,13 @@ unsigned int GameKitUserGameplayDataLoadApiCallsFromCache(GAMEKIT_USER_GAMEPLAY_
 {
     return ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->LoadApiCallsFromCache(offlineCacheFile);
 }
+
+unsigned int GameKitUserGameplayDataOpenApiCallsJournal(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance, const char* journalFile)
+{
+    return ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->OpenApiCallsJournal(journalFile);
+}
+
+void GameKitUserGameplayDataCloseApiCallsJournal(GAMEKIT_USER_GAMEPLAY_DATA_INSTANCE_HANDLE userGameplayDataInstance)
+{
+    ((UserGameplayData*)((GameKit::GameKitFeature*)userGameplayDataInstance))->CloseApiCallsJournal();
+}
@@ -1,12 +1,25 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <set>
+
 // AWS SDK
 #include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/StringUtils.h>
 
 // GameKit
 #include <aws/gamekit/core/internal/platform_string.h>
+#include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
+#include <aws/gamekit/core/utils/encoding_utils.h>
+#include <aws/gamekit/core/utils/file_utils.h>
 #include <aws/gamekit/core/utils/validation_utils.h>
 #include <aws/gamekit/user-gameplay-data/gamekit_user_gameplay_data.h>
 
@@ -24,6 +37,9 @@ using namespace GameKit::Utils::HttpClient;
 #define DEFAULT_RETRY_STRATEGY  0
 #define DEFAULT_MAX_EXPONENTIAL_BACKOFF_THRESHOLD   32
 #define DEFAULT_PAGINATION_SIZE 100
+#define MAX_CONCURRENT_REQUESTS 16
+#define MAX_OPERATION_TIMEOUT_SECONDS   86400
+#define MAX_READ_CACHE_TTL_SECONDS  86400
 
 #pragma region Constructors/Deconstructor
 UserGameplayData::UserGameplayData(Authentication::GameKitSessionManager* sessionManager, FuncLogCallback logCb)
@@ -39,6 +55,9 @@ UserGameplayData::UserGameplayData(Authentication::GameKitSessionManager* sessio
     m_clientSettings.RetryStrategy = DEFAULT_RETRY_STRATEGY;
     m_clientSettings.MaxExponentialRetryThreshold = DEFAULT_MAX_EXPONENTIAL_BACKOFF_THRESHOLD;
     m_clientSettings.PaginationSize = DEFAULT_PAGINATION_SIZE;
+    m_clientSettings.MaxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS;
+    m_clientSettings.OperationTimeoutSeconds = 0;
+    m_clientSettings.ReadCacheTtlSeconds = 0;
 
     m_logCb = logCb;
 
@@ -51,6 +70,7 @@ void UserGameplayData::SetClientSettings(const UserGameplayDataClientSettings& s
 {
     m_clientSettings = settings;
     this->initializeClient();
+    this->clearReadCache();
 
     Logging::Log(m_logCb, Level::Info, "User Gameplay Data Client settings updated.");
 }
@@ -113,10 +133,26 @@ unsigned int UserGameplayData::AddUserGameplayData(UserGameplayDataBundle userGa
 
     RequestResult result = m_customHttpClient->MakeRequest(UserGameplayDataOperationType::Write, false, userGameplayDataBundle.bundleName, "", request, HttpResponseCode::CREATED, m_clientSettings.MaxRetries);
 
+    std::map<std::string, std::string> writtenItems;
+    for (size_t i = 0; i < userGameplayDataBundle.numKeys; ++i)
+    {
+        writtenItems[userGameplayDataBundle.bundleItemKeys[i]] = userGameplayDataBundle.bundleItemValues[i];
+    }
+
     if (result.ResultType != RequestResultType::RequestMadeSuccess)
     {
         const std::string errorMessage = "Error: UserGameplayData::AddUserGameplayData() returned with " + result.ToString();
         Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+
+        if (isWriteAccepted(result))
+        {
+            storeCachedBundleItems(idToken, userGameplayDataBundle.bundleName, writtenItems);
+        }
+        else
+        {
+            invalidateCachedBundle(userGameplayDataBundle.bundleName);
+        }
+
         return result.ToErrorCode();
     }
 
@@ -128,6 +164,7 @@ unsigned int UserGameplayData::AddUserGameplayData(UserGameplayDataBundle userGa
     {
         const Aws::String errorMessage = "Error: UserGameplayData::AddUserGameplayData() error response formatted incorrectly : " + bodyJson.GetErrorMessage();
         Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        invalidateCachedBundle(userGameplayDataBundle.bundleName);
         return GAMEKIT_ERROR_PARSE_JSON_FAILED;
     }
 
@@ -145,107 +182,163 @@ unsigned int UserGameplayData::AddUserGameplayData(UserGameplayDataBundle userGa
             Aws::String bundleItemValue = item.GetString(BUNDLE_ITEM_VALUE);
 
             unprocessedItemsCallback(unprocessedItemsReceiver, bundleItemKey.c_str(), bundleItemValue.c_str());
+            writtenItems.erase(ToStdString(bundleItemKey));
         }
 
+        storeCachedBundleItems(idToken, userGameplayDataBundle.bundleName, writtenItems);
         return GAMEKIT_ERROR_USER_GAMEPLAY_DATA_UNPROCESSED_ITEMS;
     }
 
+    storeCachedBundleItems(idToken, userGameplayDataBundle.bundleName, writtenItems);
     return result.ToErrorCode();
 }
 
 unsigned int UserGameplayData::ListUserGameplayDataBundles(DISPATCH_RECEIVER_HANDLE receiver, FuncListGameplayDataBundlesResponseCallback responseCallback)
+{
+    return listUserGameplayDataBundles([&](const char* const* bundleNames, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            responseCallback(receiver, bundleNames[i]);
+        }
+    });
+}
+
+unsigned int UserGameplayData::ListUserGameplayDataBundlesBatch(DISPATCH_RECEIVER_HANDLE receiver, FuncListGameplayDataBundlesBatchResponseCallback responseCallback)
+{
+    return listUserGameplayDataBundles([&](const char* const* bundleNames, size_t count)
+    {
+        responseCallback(receiver, bundleNames, (unsigned int)count);
+    });
+}
+
+unsigned int UserGameplayData::GetUserGameplayDataBundle(char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleResponseCallback responseCallback)
+{
+    return getUserGameplayDataBundle(bundleName, [&](const char* const* itemKeys, const char* const* itemValues, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            responseCallback(receiver, itemKeys[i], itemValues[i]);
+        }
+    });
+}
+
+unsigned int UserGameplayData::GetUserGameplayDataBundleBatch(char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleBatchResponseCallback responseCallback)
+{
+    return getUserGameplayDataBundle(bundleName, [&](const char* const* itemKeys, const char* const* itemValues, size_t count)
+    {
+        responseCallback(receiver, itemKeys, itemValues, (unsigned int)count);
+    });
+}
+
+unsigned int UserGameplayData::GetUserGameplayDataBundleItem(UserGameplayDataBundleItem userGameplayDataBundleItem, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleItemResponseCallback responseCallback)
 {
     if (!m_sessionManager->AreSettingsLoaded(FeatureType::UserGameplayData))
     {
         return GAMEKIT_ERROR_SETTINGS_MISSING;
     }
 
-    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] + LIST_BUNDLES_PATH;
+    if (!Utils::ValidationUtils::IsValidPrimaryIdentifier(userGameplayDataBundleItem.bundleName))
+    {
+        const std::string errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundleItem() malformed bundle name: " + std::string(userGameplayDataBundleItem.bundleName) + ". Bundle name" + GameKit::Utils::PRIMARY_IDENTIFIER_REQUIREMENTS_TEXT;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_MALFORMED_BUNDLE_NAME;
+    }
+
+    if (!Utils::ValidationUtils::IsValidPrimaryIdentifier(userGameplayDataBundleItem.bundleItemKey))
+    {
+        const std::string errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundleItem() malformed item key: " + std::string(userGameplayDataBundleItem.bundleItemKey) + ". Item key" + GameKit::Utils::PRIMARY_IDENTIFIER_REQUIREMENTS_TEXT;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_MALFORMED_BUNDLE_ITEM_KEY;
+    }
+
+    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] +
+        BUNDLES_PATH_PART + userGameplayDataBundleItem.bundleName +
+        BUNDLE_ITEMS_PATH_PART + userGameplayDataBundleItem.bundleItemKey;
+
     const std::string& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
 
     if (idToken.empty())
     {
-        Logging::Log(m_logCb, Level::Info, "UserGameplayData::ListUserGameplayDataBundles() No user is currently logged in.");
+        Logging::Log(m_logCb, Level::Info, "UserGameplayData::GetUserGameplayDataBundleItem() No user is currently logged in.");
         return GAMEKIT_ERROR_NO_ID_TOKEN;
     }
 
-    Aws::String startKey = "";
-    Aws::String pagingToken = "";
+    std::string cachedValue;
+    std::string cachedETag;
+    const ReadCacheEntryState cacheState = getCachedBundleItem(idToken, userGameplayDataBundleItem.bundleName, userGameplayDataBundleItem.bundleItemKey, cachedValue, cachedETag);
 
-    do
+    if (cacheState == ReadCacheEntryState::Fresh)
     {
-        auto request = CreateHttpRequest(ToAwsString(uri), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        responseCallback(receiver, cachedValue.c_str());
+        return GAMEKIT_SUCCESS;
+    }
 
-        setAuthorizationHeader(request);
-        setPaginationLimit(request, m_clientSettings.PaginationSize);
+    auto const request = CreateHttpRequest(ToAwsString(uri), Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
 
-        if (startKey.length() > 0)
-        {
-            std::string message = "UserGameplayData::ListUserGameplayDataBundles() Sending request with pagination keys: (" + ToStdString(startKey) + ")";
-            Logging::Log(m_logCb, Level::Verbose, message.c_str());
+    setAuthorizationHeader(request);
 
-            request->AddQueryStringParameter(BUNDLE_PAGINATION_KEY.c_str(), startKey);
-            startKey = "";
+    if (cacheState == ReadCacheEntryState::Stale && !cachedETag.empty())
+    {
+        request->SetHeaderValue(HEADER_IF_NONE_MATCH, ToAwsString(cachedETag));
+    }
 
-            request->AddQueryStringParameter(BUNDLE_PAGINATION_TOKEN.c_str(), pagingToken);
-            pagingToken = "";
-        }
+    RequestResult const result = m_customHttpClient->MakeRequest(UserGameplayDataOperationType::Get, false, userGameplayDataBundleItem.bundleName, userGameplayDataBundleItem.bundleItemKey, request, HttpResponseCode::OK, m_clientSettings.MaxRetries);
 
-        RequestResult result = m_customHttpClient->MakeRequest(UserGameplayDataOperationType::Get, false, "", "", request, HttpResponseCode::OK, m_clientSettings.MaxRetries);
+    if (result.ResultType != RequestResultType::RequestMadeSuccess)
+    {
+        const bool isNotModified = result.Response != nullptr && result.Response->GetResponseCode() == HttpResponseCode::NOT_MODIFIED;
 
-        if (result.ResultType != RequestResultType::RequestMadeSuccess)
+        if (cacheState == ReadCacheEntryState::Stale && (isNotModified || isBackendUnreachable(result)))
         {
-            const std::string errorMessage = "Error: UserGameplayData::ListUserGameplayDataBundles() returned with " + result.ToString();
-            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
-            return result.ToErrorCode();
-        }
+            if (isNotModified)
+            {
+                revalidateCachedBundleItem(userGameplayDataBundleItem.bundleName, userGameplayDataBundleItem.bundleItemKey);
+            }
+            else
+            {
+                const std::string message = "UserGameplayData::GetUserGameplayDataBundleItem() backend unreachable, serving cached item: " + result.ToString();
+                Logging::Log(m_logCb, Level::Warning, message.c_str());
+            }
 
-        // Parse through JSON and call callback function and then set start keys
-        Aws::IOStream& bodyStream = result.Response->GetResponseBody();
-        const JsonValue bodyJson(bodyStream);
+            responseCallback(receiver, cachedValue.c_str());
+            return isNotModified ? GAMEKIT_SUCCESS : GAMEKIT_WARNING_USER_GAMEPLAY_DATA_CACHED_VALUE;
+        }
 
-        if (!bodyJson.WasParseSuccessful())
+        if (result.Response != nullptr && result.Response->GetResponseCode() == HttpResponseCode::NOT_FOUND)
         {
-            const Aws::String errorMessage = "Error: UserGameplayData::ListUserGameplayDataBundles() response formatted incorrectly : " + bodyJson.GetErrorMessage();
-            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
-            return GAMEKIT_ERROR_PARSE_JSON_FAILED;
+            invalidateCachedBundleItems(userGameplayDataBundleItem.bundleName, { userGameplayDataBundleItem.bundleItemKey });
         }
 
-        const JsonView bodyView = bodyJson.View();
-        const JsonView data = bodyView.GetObject(ENVELOPE_KEY_DATA);
-        auto allBundles = data.GetArray(BUNDLE_NAMES);
+        const std::string errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundleItem() returned with " + result.ToString();
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return result.ToErrorCode();
+    }
 
-        std::string message = "UserGameplayData::ListUserGameplayDataBundles() received " + std::to_string(allBundles.GetLength()) + " bundles.";
-        Logging::Log(m_logCb, Level::Verbose, message.c_str());
+    // Parse through JSON and call callback function
+    Aws::IOStream& bodyStream = result.Response->GetResponseBody();
+    const JsonValue bodyJson(bodyStream);
 
-        for (size_t i = 0; i < allBundles.GetLength(); ++i)
-        {
-            JsonView& item = allBundles[i];
-            Aws::String bundleName = item.GetString(BUNDLE_NAME);
+    if (!bodyJson.WasParseSuccessful())
+    {
+        const Aws::String errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundleItem() response formatted incorrectly: " + bodyJson.GetErrorMessage();
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_PARSE_JSON_FAILED;
+    }
 
-            responseCallback(receiver, bundleName.c_str());
-        }
+    const JsonView bodyView = bodyJson.View();
+    const JsonView data = bodyView.GetObject(ENVELOPE_KEY_DATA);
 
-        if (bodyView.KeyExists(ENVELOPE_KEY_PAGING))
-        {
-            const JsonView paging = bodyView.GetObject(ENVELOPE_KEY_PAGING);
-            startKey = paging.KeyExists(BUNDLE_PAGINATION_KEY) ? paging.GetString(BUNDLE_PAGINATION_KEY) : "";
-            if (!paging.KeyExists(BUNDLE_PAGINATION_TOKEN))
-            {
-                Logging::Log(m_logCb, Level::Error, "paging_token missing from response with next_start_key");
-                pagingToken = "";
-            }
-            else
-            {
-                pagingToken = paging.GetString(BUNDLE_PAGINATION_TOKEN);
-            }
-        }
-    } while (startKey.length() > 0);
+    Aws::String bundleItemValue = data.GetString(BUNDLE_ITEM_VALUE);
+    responseCallback(receiver, bundleItemValue.c_str());
+
+    const std::string eTag = result.Response->HasHeader(HEADER_ETAG.c_str()) ? ToStdString(result.Response->GetHeader(HEADER_ETAG)) : "";
+    storeCachedBundleItem(idToken, userGameplayDataBundleItem.bundleName, userGameplayDataBundleItem.bundleItemKey, ToStdString(bundleItemValue), eTag);
 
     return GAMEKIT_SUCCESS;
 }
 
-unsigned int UserGameplayData::GetUserGameplayDataBundle(char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleResponseCallback responseCallback)
+unsigned int UserGameplayData::SyncUserGameplayDataBundle(char* bundleName, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleResponseCallback changedItemsCallback)
 {
     if (!m_sessionManager->AreSettingsLoaded(FeatureType::UserGameplayData))
     {
@@ -254,7 +347,7 @@ unsigned int UserGameplayData::GetUserGameplayDataBundle(char* bundleName, DISPA
 
     if (!Utils::ValidationUtils::IsValidPrimaryIdentifier(bundleName))
     {
-        const std::string errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundle() malformed bundle name: " + std::string(bundleName) + ". Bundle name" + GameKit::Utils::PRIMARY_IDENTIFIER_REQUIREMENTS_TEXT;
+        const std::string errorMessage = "Error: UserGameplayData::SyncUserGameplayDataBundle() malformed bundle name: " + std::string(bundleName) + ". Bundle name" + GameKit::Utils::PRIMARY_IDENTIFIER_REQUIREMENTS_TEXT;
         Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
         return GAMEKIT_ERROR_MALFORMED_BUNDLE_NAME;
     }
@@ -266,143 +359,158 @@ unsigned int UserGameplayData::GetUserGameplayDataBundle(char* bundleName, DISPA
 
     if (idToken.empty())
     {
-        Logging::Log(m_logCb, Level::Info, "UserGameplayData::GetUserGameplayDataBundle() No user is currently logged in.");
+        Logging::Log(m_logCb, Level::Info, "UserGameplayData::SyncUserGameplayDataBundle() No user is currently logged in.");
         return GAMEKIT_ERROR_NO_ID_TOKEN;
     }
 
-    Aws::String startKey = "";
-    Aws::String pagingToken = "";
-
-    do
+    // Changes are applied to a copy, the mirror only moves to the new version once every page was received
+    const std::string playerId = playerIdFromIdToken(idToken);
+    SyncedBundle bundle;
     {
-        auto request = CreateHttpRequest(ToAwsString(uri), Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        std::lock_guard<std::mutex> lock(m_syncedBundlesMutex);
+        resetSyncedBundlesOnPlayerChange(playerId);
+        const auto synced = m_syncedBundles.find(bundleName);
+        if (synced != m_syncedBundles.end())
+        {
+            bundle = synced->second;
+        }
+    }
 
-        setAuthorizationHeader(request);
-        setPaginationLimit(request, m_clientSettings.PaginationSize);
+    const std::string sinceVersion = bundle.Version;
 
-        if (startKey.length() > 0)
+    auto sendPage = [this, &uri, bundleName, &sinceVersion](const Aws::String& startKey, const Aws::String& pagingToken)
+    {
+        auto request = createPageRequest(uri, startKey, pagingToken);
+        if (!sinceVersion.empty())
         {
-            request->AddQueryStringParameter(BUNDLE_PAGINATION_KEY.c_str(), startKey);
-            startKey = "";
-            request->AddQueryStringParameter(BUNDLE_PAGINATION_TOKEN.c_str(), pagingToken);
-            pagingToken = "";
+            request->AddQueryStringParameter(SINCE_VERSION_KEY.c_str(), ToAwsString(sinceVersion));
         }
 
-        auto result = m_customHttpClient->MakeRequest(UserGameplayDataOperationType::Get, false, bundleName, "", request, HttpResponseCode::OK, m_clientSettings.MaxRetries);
+        return m_customHttpClient->MakeRequest(UserGameplayDataOperationType::Get, false, bundleName, "", request, HttpResponseCode::OK, m_clientSettings.MaxRetries);
+    };
+
+    RequestResult result = sendPage("", "");
 
+    std::string version;
+    std::set<std::string> listedKeys;
+    size_t changedItemCount = 0;
+    size_t deletedItemCount = 0;
+
+    while (true)
+    {
         if (result.ResultType != RequestResultType::RequestMadeSuccess)
         {
-            const std::string errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundle() returned with " + result.ToString();
+            if (result.Response != nullptr && result.Response->GetResponseCode() == HttpResponseCode::NOT_FOUND)
+            {
+                dropSyncedBundle(bundleName);
+                invalidateCachedBundle(bundleName);
+            }
+
+            const std::string errorMessage = "Error: UserGameplayData::SyncUserGameplayDataBundle() returned with " + result.ToString();
             Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
             return result.ToErrorCode();
         }
 
-        // Parse through JSON and call callback function and then set startKey
         Aws::IOStream& bodyStream = result.Response->GetResponseBody();
         const JsonValue bodyJson(bodyStream);
 
         if (!bodyJson.WasParseSuccessful())
         {
-            const Aws::String errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundle() response formatted incorrectly : " + bodyJson.GetErrorMessage();
+            const Aws::String errorMessage = "Error: UserGameplayData::SyncUserGameplayDataBundle() response formatted incorrectly : " + bodyJson.GetErrorMessage();
             Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
             return GAMEKIT_ERROR_PARSE_JSON_FAILED;
         }
 
         const JsonView bodyView = bodyJson.View();
         const JsonView data = bodyView.GetObject(ENVELOPE_KEY_DATA);
-        auto items = data.GetArray(BUNDLE_ITEMS);
+        if (data.KeyExists(BUNDLE_VERSION))
+        {
+            version = ToStdString(data.GetString(BUNDLE_VERSION));
+        }
+
+        // The next page is requested while this one is applied
+        Aws::String startKey;
+        Aws::String pagingToken;
+        readPagingKeys(bodyView, startKey, pagingToken);
+
+        std::future<RequestResult> nextPage;
+        if (startKey.length() > 0)
+        {
+            nextPage = std::async(std::launch::async, sendPage, startKey, pagingToken);
+        }
 
+        auto items = data.GetArray(BUNDLE_ITEMS);
         for (size_t i = 0; i < items.GetLength(); ++i)
         {
             auto& item = items[i];
-            Aws::String itemKey = item.GetString(BUNDLE_ITEM_KEY);
-            Aws::String itemValue = item.GetString(BUNDLE_ITEM_VALUE);
+            const std::string key = ToStdString(item.GetString(BUNDLE_ITEM_KEY));
+            const std::string value = ToStdString(item.GetString(BUNDLE_ITEM_VALUE));
 
-            responseCallback(receiver, itemKey.c_str(), itemValue.c_str());
-        }
+            listedKeys.insert(key);
 
-        if (bodyView.KeyExists(ENVELOPE_KEY_PAGING))
-        {
-            const JsonView paging = bodyView.GetObject(ENVELOPE_KEY_PAGING);
-            startKey = paging.KeyExists(BUNDLE_PAGINATION_KEY) ? paging.GetString(BUNDLE_PAGINATION_KEY) : "";
-            if (!paging.KeyExists(BUNDLE_PAGINATION_TOKEN))
+            auto mirrored = bundle.Items.find(key);
+            if (mirrored == bundle.Items.end() || mirrored->second != value)
             {
-                Logging::Log(m_logCb, Level::Error, "paging_token missing from response with next_start_key");
-                pagingToken = "";
+                bundle.Items[key] = value;
+                changedItemsCallback(receiver, key.c_str(), value.c_str());
+                changedItemCount++;
             }
-            else
+        }
+
+        if (data.KeyExists(DELETED_BUNDLE_ITEM_KEYS))
+        {
+            auto deletedKeys = data.GetArray(DELETED_BUNDLE_ITEM_KEYS);
+            for (size_t i = 0; i < deletedKeys.GetLength(); ++i)
             {
-                pagingToken = paging.GetString(BUNDLE_PAGINATION_TOKEN);
+                const std::string key = ToStdString(deletedKeys[i].AsString());
+                if (bundle.Items.erase(key) > 0)
+                {
+                    changedItemsCallback(receiver, key.c_str(), nullptr);
+                    deletedItemCount++;
+                }
             }
         }
-    } while (startKey.length() > 0);
-
-    return GAMEKIT_SUCCESS;
-}
 
-unsigned int UserGameplayData::GetUserGameplayDataBundleItem(UserGameplayDataBundleItem userGameplayDataBundleItem, DISPATCH_RECEIVER_HANDLE receiver, FuncBundleItemResponseCallback responseCallback)
-{
-    if (!m_sessionManager->AreSettingsLoaded(FeatureType::UserGameplayData))
-    {
-        return GAMEKIT_ERROR_SETTINGS_MISSING;
-    }
+        if (!nextPage.valid())
+        {
+            break;
+        }
 
-    if (!Utils::ValidationUtils::IsValidPrimaryIdentifier(userGameplayDataBundleItem.bundleName))
-    {
-        const std::string errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundleItem() malformed bundle name: " + std::string(userGameplayDataBundleItem.bundleName) + ". Bundle name" + GameKit::Utils::PRIMARY_IDENTIFIER_REQUIREMENTS_TEXT;
-        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
-        return GAMEKIT_ERROR_MALFORMED_BUNDLE_NAME;
+        result = nextPage.get();
     }
 
-    if (!Utils::ValidationUtils::IsValidPrimaryIdentifier(userGameplayDataBundleItem.bundleItemKey))
+    // Without a version the backend listed the whole bundle, mirrored items it did not list were deleted
+    if (version.empty())
     {
-        const std::string errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundleItem() malformed item key: " + std::string(userGameplayDataBundleItem.bundleItemKey) + ". Item key" + GameKit::Utils::PRIMARY_IDENTIFIER_REQUIREMENTS_TEXT;
-        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
-        return GAMEKIT_ERROR_MALFORMED_BUNDLE_ITEM_KEY;
-    }
-
-    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] +
-        BUNDLES_PATH_PART + userGameplayDataBundleItem.bundleName +
-        BUNDLE_ITEMS_PATH_PART + userGameplayDataBundleItem.bundleItemKey;
-
-    const std::string& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+        for (auto mirrored = bundle.Items.begin(); mirrored != bundle.Items.end();)
+        {
+            if (listedKeys.find(mirrored->first) != listedKeys.end())
+            {
+                ++mirrored;
+                continue;
+            }
 
-    if (idToken.empty())
-    {
-        Logging::Log(m_logCb, Level::Info, "UserGameplayData::GetUserGameplayDataBundleItem() No user is currently logged in.");
-        return GAMEKIT_ERROR_NO_ID_TOKEN;
+            changedItemsCallback(receiver, mirrored->first.c_str(), nullptr);
+            deletedItemCount++;
+            mirrored = bundle.Items.erase(mirrored);
+        }
     }
 
-    auto const request = CreateHttpRequest(ToAwsString(uri), Aws::Http::HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
-
-    setAuthorizationHeader(request);
-
-    RequestResult const result = m_customHttpClient->MakeRequest(UserGameplayDataOperationType::Get, false, userGameplayDataBundleItem.bundleName, userGameplayDataBundleItem.bundleItemKey, request, HttpResponseCode::OK, m_clientSettings.MaxRetries);
+    bundle.Version = version;
 
-    if (result.ResultType != RequestResultType::RequestMadeSuccess)
-    {
-        const std::string errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundleItem() returned with " + result.ToString();
-        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
-        return result.ToErrorCode();
-    }
+    const std::string message = "UserGameplayData::SyncUserGameplayDataBundle() " + std::string(bundleName) + (sinceVersion.empty() ? " fully synced" : " synced since version " + sinceVersion) +
+        ": " + std::to_string(changedItemCount) + " items changed, " + std::to_string(deletedItemCount) + " items deleted.";
+    Logging::Log(m_logCb, Level::Verbose, message.c_str());
 
-    // Parse through JSON and call callback function
-    Aws::IOStream& bodyStream = result.Response->GetResponseBody();
-    const JsonValue bodyJson(bodyStream);
+    storeCachedBundle(idToken, bundleName, bundle.Items, "");
 
-    if (!bodyJson.WasParseSuccessful())
+    // Another player synced in the meantime, the bundle must not be mirrored for them
+    std::lock_guard<std::mutex> lock(m_syncedBundlesMutex);
+    if (m_syncedBundlesPlayerId == playerId)
     {
-        const Aws::String errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundleItem() response formatted incorrectly: " + bodyJson.GetErrorMessage();
-        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
-        return GAMEKIT_ERROR_PARSE_JSON_FAILED;
+        m_syncedBundles[bundleName] = std::move(bundle);
     }
 
-    const JsonView bodyView = bodyJson.View();
-    const JsonView data = bodyView.GetObject(ENVELOPE_KEY_DATA);
-
-    Aws::String bundleItemValue = data.GetString(BUNDLE_ITEM_VALUE);
-    responseCallback(receiver, bundleItemValue.c_str());
-
     return GAMEKIT_SUCCESS;
 }
 
@@ -461,6 +569,15 @@ unsigned int UserGameplayData::UpdateUserGameplayDataBundleItem(UserGameplayData
         Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
     }
 
+    if (isWriteAccepted(result))
+    {
+        storeCachedBundleItems(idToken, userGameplayDataBundleItemValue.bundleName, { { userGameplayDataBundleItemValue.bundleItemKey, userGameplayDataBundleItemValue.bundleItemValue } });
+    }
+    else
+    {
+        invalidateCachedBundleItems(userGameplayDataBundleItemValue.bundleName, { userGameplayDataBundleItemValue.bundleItemKey });
+    }
+
     return result.ToErrorCode();
 }
 
@@ -486,6 +603,10 @@ unsigned int UserGameplayData::DeleteAllUserGameplayData()
 
     const RequestResult result = m_customHttpClient->MakeRequest(UserGameplayDataOperationType::Delete, false, "", "", request, HttpResponseCode::NO_CONTENT, m_clientSettings.MaxRetries);
 
+    // Whether the delete went through or not, the backend is the only source to trust afterwards
+    clearReadCache();
+    clearSyncedBundles();
+
     if (result.ResultType != RequestResultType::RequestMadeSuccess)
     {
         const std::string errorMessage = "Error: UserGameplayData::DeleteAllUserGameplayData() returned with " + result.ToString();
@@ -525,6 +646,9 @@ unsigned int UserGameplayData::DeleteUserGameplayDataBundle(char* bundleName)
 
     const RequestResult result = m_customHttpClient->MakeRequest(UserGameplayDataOperationType::Delete, false, bundleName, "", request, HttpResponseCode::NO_CONTENT, m_clientSettings.MaxRetries);
 
+    invalidateCachedBundle(bundleName);
+    dropSyncedBundle(bundleName);
+
     if (result.ResultType != RequestResultType::RequestMadeSuccess)
     {
         const std::string errorMessage = "Error: UserGameplayData::DeleteUserGameplayDataBundle() returned with " + result.ToString();
@@ -590,6 +714,16 @@ unsigned int UserGameplayData::DeleteUserGameplayDataBundleItems(UserGameplayDat
     // The filtering logic does not handle operations on multiple items in the same request.
     RequestResult result = m_customHttpClient->MakeRequest(UserGameplayDataOperationType::Delete, false, deleteItemsRequest.bundleName, "", request, HttpResponseCode::NO_CONTENT, m_clientSettings.MaxRetries);
 
+    // Deleted items are gone from a complete cached bundle, a failed delete leaves the bundle content unknown
+    if (isWriteAccepted(result))
+    {
+        invalidateCachedBundleItems(deleteItemsRequest.bundleName, std::vector<std::string>(deleteItemsRequest.bundleItemKeys, deleteItemsRequest.bundleItemKeys + deleteItemsRequest.numKeys));
+    }
+    else
+    {
+        invalidateCachedBundle(deleteItemsRequest.bundleName);
+    }
+
     if (result.ResultType != RequestResultType::RequestMadeSuccess)
     {
         const std::string errorMessage = "Error: UserGameplayData::DeleteUserGameplayDataBundleItem() returned with " + result.ToString();
@@ -624,51 +758,656 @@ void UserGameplayData::DropAllCachedEvents()
     m_customHttpClient->DropAllCachedEvents();
 }
 
-unsigned int UserGameplayData::PersistApiCallsToCache(const std::string& offlineCacheFile)
-{
-    const auto serializer = static_cast<bool(*)(std::ostream& os, const std::shared_ptr<IOperation>, FuncLogCallback)>(&UserGameplayDataOperation::TrySerializeBinary);
-    return m_customHttpClient->PersistQueue(offlineCacheFile, serializer, true) ?
-        GAMEKIT_SUCCESS : GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_WRITE_FAILED;
-}
-
-unsigned int UserGameplayData::LoadApiCallsFromCache(const std::string& offlineCacheFile)
+void UserGameplayData::ClearReadCache()
 {
-    const auto deserializer = static_cast<bool(*)(std::istream& is, std::shared_ptr<IOperation>&, FuncLogCallback)>(&UserGameplayDataOperation::TryDeserializeBinary);
-    return m_customHttpClient->LoadQueue(offlineCacheFile, deserializer, true) ?
-        GAMEKIT_SUCCESS : GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_READ_FAILED;
+    clearReadCache();
 }
-#pragma endregion
 
-#pragma region Private Methods
-void UserGameplayData::initializeClient()
+unsigned int UserGameplayData::PersistBundleSyncState(const std::string& syncStateFile)
 {
-    if (m_clientSettings.ClientTimeoutSeconds == 0)
+    std::ostringstream contents;
+    size_t bundleCount = 0;
     {
-        m_clientSettings.ClientTimeoutSeconds = DEFAULT_CLIENT_TIMEOUT_SECONDS;
+        std::lock_guard<std::mutex> lock(m_syncedBundlesMutex);
+        bundleCount = m_syncedBundles.size();
+
+        Utils::Serialization::BinWrite(contents, static_cast<uint32_t>(BUNDLE_SYNC_FILE_MAGIC));
+        Utils::Serialization::BinWrite(contents, static_cast<uint32_t>(BUNDLE_SYNC_FILE_VERSION));
+        Utils::Serialization::BinWrite(contents, bundleCount);
+        Utils::Serialization::BinWriteRecord(contents, m_syncedBundlesPlayerId);
+        for (const auto& bundle : m_syncedBundles)
+        {
+            const std::string record = encodeSyncedBundleRecord(bundle.first, bundle.second);
+            contents.write(record.data(), (std::streamsize)record.size());
+        }
     }
 
-    if (m_clientSettings.RetryIntervalSeconds == 0)
+    // Write the state next to the current file and swap it in, so a crash during the write keeps the previous state
+    const std::string tempFile = syncStateFile + ".tmp";
+    const Utils::FileUtils::PlatformPathString nativePath = Utils::FileUtils::PathFromUtf8(syncStateFile);
+    const Utils::FileUtils::PlatformPathString nativeTempPath = Utils::FileUtils::PathFromUtf8(tempFile);
+
+    std::ofstream outputFile(nativeTempPath, std::ios::binary | std::ios::trunc);
+    if (outputFile.fail())
     {
-        m_clientSettings.RetryIntervalSeconds = DEFAULT_RETRY_INTERVAL_SECONDS;
+        const std::string errorMessage = "Error: UserGameplayData::PersistBundleSyncState() unable to open bundle sync state file for write: " + tempFile;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_WRITE_FAILED;
     }
 
-    if (m_clientSettings.MaxRetryQueueSize == 0)
+    const std::string data = contents.str();
+    outputFile.write(data.data(), (std::streamsize)data.size());
+    outputFile.close();
+    if (outputFile.fail())
     {
-        m_clientSettings.MaxRetryQueueSize = DEFAULT_MAX_QUEUE_SIZE;
+        const std::string errorMessage = "Error: UserGameplayData::PersistBundleSyncState() unable to write bundle sync state file: " + tempFile;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_WRITE_FAILED;
     }
 
-    if (m_clientSettings.MaxRetries == 0)
+#if __ANDROID__
+    // Workaround for Android's "Not implemented" error when calling boost::filesystem functions
+    const int renameResult = rename(nativeTempPath.c_str(), nativePath.c_str());
+    if (renameResult != 0)
     {
-        m_clientSettings.MaxRetries = DEFAULT_MAX_RETRIES;
+        const std::string errorMessage = "Error: UserGameplayData::PersistBundleSyncState() unable to replace bundle sync state file: " + syncStateFile +
+            ", result: " + std::to_string(renameResult) + ", errno: " + std::to_string(errno);
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_WRITE_FAILED;
     }
-
-    if (m_clientSettings.RetryStrategy > 1)
+#else
+    boost::system::error_code renameError;
+    boost::filesystem::rename(nativeTempPath, nativePath, renameError);
+    if (renameError)
     {
-        // invalid value, set to default
-        m_clientSettings.RetryStrategy = DEFAULT_RETRY_STRATEGY;
+        const std::string errorMessage = "Error: UserGameplayData::PersistBundleSyncState() unable to replace bundle sync state file: " + syncStateFile + ", error: " + renameError.message();
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_WRITE_FAILED;
     }
+#endif
 
-    if (m_clientSettings.MaxExponentialRetryThreshold == 0)
+    const std::string message = "UserGameplayData::PersistBundleSyncState() wrote " + std::to_string(bundleCount) + " synced bundles to: " + syncStateFile;
+    Logging::Log(m_logCb, Level::Info, message.c_str());
+
+    return GAMEKIT_SUCCESS;
+}
+
+unsigned int UserGameplayData::LoadBundleSyncState(const std::string& syncStateFile)
+{
+    std::map<std::string, SyncedBundle> loadedBundles;
+    std::string loadedPlayerId;
+
+    boost::system::error_code error;
+    if (!boost::filesystem::exists(syncStateFile, error))
+    {
+        const std::string message = "UserGameplayData::LoadBundleSyncState() no bundle sync state found, bundles will be synced from scratch: " + syncStateFile;
+        Logging::Log(m_logCb, Level::Info, message.c_str());
+
+        std::lock_guard<std::mutex> lock(m_syncedBundlesMutex);
+        m_syncedBundles.clear();
+        m_syncedBundlesPlayerId.clear();
+        return GAMEKIT_SUCCESS;
+    }
+
+    std::ifstream inputFile(Utils::FileUtils::PathFromUtf8(syncStateFile), std::ios::binary);
+    if (inputFile.fail())
+    {
+        const std::string errorMessage = "Error: UserGameplayData::LoadBundleSyncState() unable to open bundle sync state file for read: " + syncStateFile;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_READ_FAILED;
+    }
+
+    // Records are checked against their CRC, a file that was only partly read is handled like a torn one
+    const std::vector<char> data((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    size_t bundleCount = 0;
+    const size_t headerSize = sizeof(magic) + sizeof(version) + sizeof(bundleCount);
+    if (data.size() >= headerSize)
+    {
+        memcpy(&magic, data.data(), sizeof(magic));
+        memcpy(&version, data.data() + sizeof(magic), sizeof(version));
+        memcpy(&bundleCount, data.data() + sizeof(magic) + sizeof(version), sizeof(bundleCount));
+    }
+
+    if (magic != BUNDLE_SYNC_FILE_MAGIC || version > BUNDLE_SYNC_FILE_VERSION)
+    {
+        const std::string errorMessage = "Error: UserGameplayData::LoadBundleSyncState() file is not a supported bundle sync state file: " + syncStateFile;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_READ_FAILED;
+    }
+
+    // Files of the first version don't name the player their bundles were synced for, they can't be trusted for the current one
+    if (version < BUNDLE_SYNC_FILE_VERSION)
+    {
+        const std::string message = "UserGameplayData::LoadBundleSyncState() bundle sync state doesn't name its player, bundles will be synced from scratch: " + syncStateFile;
+        Logging::Log(m_logCb, Level::Info, message.c_str());
+
+        std::lock_guard<std::mutex> lock(m_syncedBundlesMutex);
+        m_syncedBundles.clear();
+        m_syncedBundlesPlayerId.clear();
+        return GAMEKIT_SUCCESS;
+    }
+
+    size_t offset = headerSize;
+    const char* playerRecord = nullptr;
+    size_t playerRecordLength = 0;
+    if (!Utils::Serialization::TryReadRecord(data.data(), data.size(), offset, playerRecord, playerRecordLength))
+    {
+        const std::string errorMessage = "Error: UserGameplayData::LoadBundleSyncState() dropping " + std::to_string(bundleCount) +
+            " bundles after an incomplete or corrupt player record in " + syncStateFile;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        bundleCount = 0;
+    }
+    else
+    {
+        loadedPlayerId.assign(playerRecord, playerRecordLength);
+    }
+
+    for (size_t i = 0; i < bundleCount; ++i)
+    {
+        // A bundle that is dropped is synced from scratch, the records after a torn one can't be trusted
+        const char* record = nullptr;
+        size_t recordLength = 0;
+        if (!Utils::Serialization::TryReadRecord(data.data(), data.size(), offset, record, recordLength))
+        {
+            const std::string errorMessage = "Error: UserGameplayData::LoadBundleSyncState() dropping " + std::to_string(bundleCount - i) +
+                " bundles after an incomplete or corrupt record in " + syncStateFile;
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            break;
+        }
+
+        std::string bundleName;
+        SyncedBundle bundle;
+        if (!decodeSyncedBundleRecord(record, recordLength, bundleName, bundle))
+        {
+            const std::string errorMessage = "Error: UserGameplayData::LoadBundleSyncState() unable to decode a bundle record in " + syncStateFile;
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            continue;
+        }
+
+        loadedBundles[bundleName] = std::move(bundle);
+    }
+
+    const std::string message = "UserGameplayData::LoadBundleSyncState() loaded " + std::to_string(loadedBundles.size()) + " synced bundles from: " + syncStateFile;
+    Logging::Log(m_logCb, Level::Info, message.c_str());
+
+    std::lock_guard<std::mutex> lock(m_syncedBundlesMutex);
+    m_syncedBundles = std::move(loadedBundles);
+    m_syncedBundlesPlayerId = std::move(loadedPlayerId);
+
+    return GAMEKIT_SUCCESS;
+}
+
+unsigned int UserGameplayData::PersistApiCallsToCache(const std::string& offlineCacheFile)
+{
+    const auto serializer = static_cast<bool(*)(std::ostream& os, const std::shared_ptr<IOperation>, FuncLogCallback)>(&UserGameplayDataOperation::TrySerializeBinary);
+    return m_customHttpClient->PersistQueue(offlineCacheFile, serializer, true) ?
+        GAMEKIT_SUCCESS : GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_WRITE_FAILED;
+}
+
+unsigned int UserGameplayData::LoadApiCallsFromCache(const std::string& offlineCacheFile)
+{
+    const auto deserializer = static_cast<bool(*)(std::istream& is, std::shared_ptr<IOperation>&, FuncLogCallback)>(&UserGameplayDataOperation::TryDeserializeBinary);
+    return m_customHttpClient->LoadQueue(offlineCacheFile, deserializer, true) ?
+        GAMEKIT_SUCCESS : GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_READ_FAILED;
+}
+
+unsigned int UserGameplayData::OpenApiCallsJournal(const std::string& journalFile)
+{
+    const auto serializer = static_cast<bool(*)(std::ostream& os, const std::shared_ptr<IOperation>, FuncLogCallback)>(&UserGameplayDataOperation::TrySerializeBinary);
+    const auto deserializer = static_cast<bool(*)(std::istream& is, std::shared_ptr<IOperation>&, FuncLogCallback)>(&UserGameplayDataOperation::TryDeserializeBinary);
+    return m_customHttpClient->OpenJournal(journalFile, serializer, deserializer) ?
+        GAMEKIT_SUCCESS : GAMEKIT_ERROR_USER_GAMEPLAY_DATA_CACHE_READ_FAILED;
+}
+
+void UserGameplayData::CloseApiCallsJournal()
+{
+    m_customHttpClient->CloseJournal();
+}
+#pragma endregion
+
+#pragma region Private Methods
+unsigned int UserGameplayData::listUserGameplayDataBundles(const BundleNamesPageHandler& pageHandler)
+{
+    if (!m_sessionManager->AreSettingsLoaded(FeatureType::UserGameplayData))
+    {
+        return GAMEKIT_ERROR_SETTINGS_MISSING;
+    }
+
+    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] + LIST_BUNDLES_PATH;
+    const std::string& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+
+    if (idToken.empty())
+    {
+        Logging::Log(m_logCb, Level::Info, "UserGameplayData::ListUserGameplayDataBundles() No user is currently logged in.");
+        return GAMEKIT_ERROR_NO_ID_TOKEN;
+    }
+
+    auto sendPage = [this, &uri](const Aws::String& startKey, const Aws::String& pagingToken)
+    {
+        if (startKey.length() > 0)
+        {
+            std::string message = "UserGameplayData::ListUserGameplayDataBundles() Sending request with pagination keys: (" + ToStdString(startKey) + ")";
+            Logging::Log(m_logCb, Level::Verbose, message.c_str());
+        }
+
+        return m_customHttpClient->MakeRequest(UserGameplayDataOperationType::Get, false, "", "", createPageRequest(uri, startKey, pagingToken), HttpResponseCode::OK, m_clientSettings.MaxRetries);
+    };
+
+    RequestResult result = sendPage("", "");
+
+    std::vector<Aws::String> pageBundleNames;
+    std::vector<const char*> pageBundleNamePointers;
+
+    while (true)
+    {
+        if (result.ResultType != RequestResultType::RequestMadeSuccess)
+        {
+            const std::string errorMessage = "Error: UserGameplayData::ListUserGameplayDataBundles() returned with " + result.ToString();
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            return result.ToErrorCode();
+        }
+
+        // Parse through JSON and call callback function and then set start keys
+        Aws::IOStream& bodyStream = result.Response->GetResponseBody();
+        const JsonValue bodyJson(bodyStream);
+
+        if (!bodyJson.WasParseSuccessful())
+        {
+            const Aws::String errorMessage = "Error: UserGameplayData::ListUserGameplayDataBundles() response formatted incorrectly : " + bodyJson.GetErrorMessage();
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            return GAMEKIT_ERROR_PARSE_JSON_FAILED;
+        }
+
+        const JsonView bodyView = bodyJson.View();
+        const JsonView data = bodyView.GetObject(ENVELOPE_KEY_DATA);
+        auto allBundles = data.GetArray(BUNDLE_NAMES);
+
+        std::string message = "UserGameplayData::ListUserGameplayDataBundles() received " + std::to_string(allBundles.GetLength()) + " bundles.";
+        Logging::Log(m_logCb, Level::Verbose, message.c_str());
+
+        // The next page is requested while this one is dispatched
+        Aws::String startKey;
+        Aws::String pagingToken;
+        readPagingKeys(bodyView, startKey, pagingToken);
+
+        std::future<RequestResult> nextPage;
+        if (startKey.length() > 0)
+        {
+            nextPage = std::async(std::launch::async, sendPage, startKey, pagingToken);
+        }
+
+        pageBundleNames.clear();
+        for (size_t i = 0; i < allBundles.GetLength(); ++i)
+        {
+            pageBundleNames.push_back(allBundles[i].GetString(BUNDLE_NAME));
+        }
+
+        // Pointers are taken once the page is complete, growing the vector may move the strings
+        pageBundleNamePointers.clear();
+        for (const Aws::String& bundleName : pageBundleNames)
+        {
+            pageBundleNamePointers.push_back(bundleName.c_str());
+        }
+
+        pageHandler(pageBundleNamePointers.data(), pageBundleNamePointers.size());
+
+        if (!nextPage.valid())
+        {
+            break;
+        }
+
+        result = nextPage.get();
+    }
+
+    return GAMEKIT_SUCCESS;
+}
+
+unsigned int UserGameplayData::getUserGameplayDataBundle(char* bundleName, const BundlePageHandler& pageHandler)
+{
+    if (!m_sessionManager->AreSettingsLoaded(FeatureType::UserGameplayData))
+    {
+        return GAMEKIT_ERROR_SETTINGS_MISSING;
+    }
+
+    if (!Utils::ValidationUtils::IsValidPrimaryIdentifier(bundleName))
+    {
+        const std::string errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundle() malformed bundle name: " + std::string(bundleName) + ". Bundle name" + GameKit::Utils::PRIMARY_IDENTIFIER_REQUIREMENTS_TEXT;
+        Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+        return GAMEKIT_ERROR_MALFORMED_BUNDLE_NAME;
+    }
+
+    const std::string uri = m_sessionManager->GetClientSettings()[SETTINGS_USER_GAMEPLAY_DATA_API_GATEWAY_BASE_URL] +
+        BUNDLES_PATH_PART + bundleName;
+
+    const std::string& idToken = m_sessionManager->GetToken(GameKit::TokenType::IdToken);
+
+    if (idToken.empty())
+    {
+        Logging::Log(m_logCb, Level::Info, "UserGameplayData::GetUserGameplayDataBundle() No user is currently logged in.");
+        return GAMEKIT_ERROR_NO_ID_TOKEN;
+    }
+
+    std::map<std::string, std::string> cachedItems;
+    std::string cachedETag;
+    const ReadCacheEntryState cacheState = getCachedBundle(idToken, bundleName, cachedItems, cachedETag);
+
+    if (cacheState == ReadCacheEntryState::Fresh)
+    {
+        dispatchBundleItems(cachedItems, pageHandler);
+        return GAMEKIT_SUCCESS;
+    }
+
+    const bool isReadCacheEnabled = m_clientSettings.ReadCacheTtlSeconds > 0;
+    std::map<std::string, std::string> fetchedItems;
+    std::string fetchedETag;
+
+    auto sendPage = [this, &uri, bundleName](const Aws::String& startKey, const Aws::String& pagingToken, const std::string& eTag)
+    {
+        auto request = createPageRequest(uri, startKey, pagingToken);
+        if (!eTag.empty())
+        {
+            request->SetHeaderValue(HEADER_IF_NONE_MATCH, ToAwsString(eTag));
+        }
+
+        return m_customHttpClient->MakeRequest(UserGameplayDataOperationType::Get, false, bundleName, "", request, HttpResponseCode::OK, m_clientSettings.MaxRetries);
+    };
+
+    RequestResult result = sendPage("", "", cacheState == ReadCacheEntryState::Stale ? cachedETag : "");
+    bool isFirstPage = true;
+
+    std::vector<Aws::String> pageKeys;
+    std::vector<Aws::String> pageValues;
+    std::vector<const char*> pageKeyPointers;
+    std::vector<const char*> pageValuePointers;
+
+    while (true)
+    {
+        if (result.ResultType != RequestResultType::RequestMadeSuccess)
+        {
+            const bool isNotModified = result.Response != nullptr && result.Response->GetResponseCode() == HttpResponseCode::NOT_MODIFIED;
+
+            // Cached items stand in for the whole bundle, never for the pages left after some were already dispatched
+            if (isFirstPage && cacheState == ReadCacheEntryState::Stale && (isNotModified || isBackendUnreachable(result)))
+            {
+                if (isNotModified)
+                {
+                    revalidateCachedBundle(bundleName);
+                }
+                else
+                {
+                    const std::string message = "UserGameplayData::GetUserGameplayDataBundle() backend unreachable, serving cached bundle: " + result.ToString();
+                    Logging::Log(m_logCb, Level::Warning, message.c_str());
+                }
+
+                dispatchBundleItems(cachedItems, pageHandler);
+                return isNotModified ? GAMEKIT_SUCCESS : GAMEKIT_WARNING_USER_GAMEPLAY_DATA_CACHED_VALUE;
+            }
+
+            if (result.Response != nullptr && result.Response->GetResponseCode() == HttpResponseCode::NOT_FOUND)
+            {
+                invalidateCachedBundle(bundleName);
+            }
+
+            const std::string errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundle() returned with " + result.ToString();
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            return result.ToErrorCode();
+        }
+
+        if (isFirstPage && result.Response->HasHeader(HEADER_ETAG.c_str()))
+        {
+            fetchedETag = ToStdString(result.Response->GetHeader(HEADER_ETAG));
+        }
+        isFirstPage = false;
+
+        // Parse through JSON and call callback function and then set startKey
+        Aws::IOStream& bodyStream = result.Response->GetResponseBody();
+        const JsonValue bodyJson(bodyStream);
+
+        if (!bodyJson.WasParseSuccessful())
+        {
+            const Aws::String errorMessage = "Error: UserGameplayData::GetUserGameplayDataBundle() response formatted incorrectly : " + bodyJson.GetErrorMessage();
+            Logging::Log(m_logCb, Level::Error, errorMessage.c_str());
+            return GAMEKIT_ERROR_PARSE_JSON_FAILED;
+        }
+
+        const JsonView bodyView = bodyJson.View();
+        const JsonView data = bodyView.GetObject(ENVELOPE_KEY_DATA);
+        auto items = data.GetArray(BUNDLE_ITEMS);
+
+        // The next page is requested while this one is dispatched
+        Aws::String startKey;
+        Aws::String pagingToken;
+        readPagingKeys(bodyView, startKey, pagingToken);
+
+        std::future<RequestResult> nextPage;
+        if (startKey.length() > 0)
+        {
+            nextPage = std::async(std::launch::async, sendPage, startKey, pagingToken, std::string());
+
+            // The ETag of the first page only covers the whole bundle when there are no other pages
+            fetchedETag.clear();
+        }
+
+        pageKeys.clear();
+        pageValues.clear();
+        for (size_t i = 0; i < items.GetLength(); ++i)
+        {
+            auto& item = items[i];
+            pageKeys.push_back(item.GetString(BUNDLE_ITEM_KEY));
+            pageValues.push_back(item.GetString(BUNDLE_ITEM_VALUE));
+        }
+
+        // Pointers are taken once the page is complete, growing the vectors may move the strings
+        pageKeyPointers.clear();
+        pageValuePointers.clear();
+        for (size_t i = 0; i < pageKeys.size(); ++i)
+        {
+            pageKeyPointers.push_back(pageKeys[i].c_str());
+            pageValuePointers.push_back(pageValues[i].c_str());
+        }
+
+        pageHandler(pageKeyPointers.data(), pageValuePointers.data(), pageKeys.size());
+
+        if (isReadCacheEnabled)
+        {
+            for (size_t i = 0; i < pageKeys.size(); ++i)
+            {
+                fetchedItems[ToStdString(pageKeys[i])] = ToStdString(pageValues[i]);
+            }
+        }
+
+        if (!nextPage.valid())
+        {
+            break;
+        }
+
+        result = nextPage.get();
+    }
+
+    storeCachedBundle(idToken, bundleName, fetchedItems, fetchedETag);
+
+    return GAMEKIT_SUCCESS;
+}
+
+std::shared_ptr<HttpRequest> UserGameplayData::createPageRequest(const std::string& uri, const Aws::String& startKey, const Aws::String& pagingToken)
+{
+    auto request = CreateHttpRequest(ToAwsString(uri), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+
+    setAuthorizationHeader(request);
+    setPaginationLimit(request, m_clientSettings.PaginationSize);
+
+    if (startKey.length() > 0)
+    {
+        request->AddQueryStringParameter(BUNDLE_PAGINATION_KEY.c_str(), startKey);
+        request->AddQueryStringParameter(BUNDLE_PAGINATION_TOKEN.c_str(), pagingToken);
+    }
+
+    return request;
+}
+
+void UserGameplayData::readPagingKeys(const JsonView& bodyView, Aws::String& outStartKey, Aws::String& outPagingToken) const
+{
+    outStartKey = "";
+    outPagingToken = "";
+
+    if (!bodyView.KeyExists(ENVELOPE_KEY_PAGING))
+    {
+        return;
+    }
+
+    const JsonView paging = bodyView.GetObject(ENVELOPE_KEY_PAGING);
+    outStartKey = paging.KeyExists(BUNDLE_PAGINATION_KEY) ? paging.GetString(BUNDLE_PAGINATION_KEY) : "";
+    if (!paging.KeyExists(BUNDLE_PAGINATION_TOKEN))
+    {
+        Logging::Log(m_logCb, Level::Error, "paging_token missing from response with next_start_key");
+    }
+    else
+    {
+        outPagingToken = paging.GetString(BUNDLE_PAGINATION_TOKEN);
+    }
+}
+
+void UserGameplayData::dispatchBundleItems(const std::map<std::string, std::string>& items, const BundlePageHandler& pageHandler)
+{
+    std::vector<const char*> keys;
+    std::vector<const char*> values;
+    keys.reserve(items.size());
+    values.reserve(items.size());
+
+    for (const auto& item : items)
+    {
+        keys.push_back(item.first.c_str());
+        values.push_back(item.second.c_str());
+    }
+
+    pageHandler(keys.data(), values.data(), items.size());
+}
+
+void UserGameplayData::dropSyncedBundle(const std::string& bundleName)
+{
+    std::lock_guard<std::mutex> lock(m_syncedBundlesMutex);
+    m_syncedBundles.erase(bundleName);
+}
+
+void UserGameplayData::clearSyncedBundles()
+{
+    std::lock_guard<std::mutex> lock(m_syncedBundlesMutex);
+    m_syncedBundles.clear();
+}
+
+void UserGameplayData::resetSyncedBundlesOnPlayerChange(const std::string& playerId)
+{
+    if (m_syncedBundlesPlayerId != playerId)
+    {
+        m_syncedBundles.clear();
+        m_syncedBundlesPlayerId = playerId;
+    }
+}
+
+std::string UserGameplayData::playerIdFromIdToken(const std::string& idToken)
+{
+    // The payload is the second dot separated part of the token, base64url encoded without padding
+    const size_t payloadStart = idToken.find('.');
+    const size_t payloadEnd = payloadStart == std::string::npos ? std::string::npos : idToken.find('.', payloadStart + 1);
+    if (payloadEnd != std::string::npos)
+    {
+        std::string payload = idToken.substr(payloadStart + 1, payloadEnd - payloadStart - 1);
+        std::replace(payload.begin(), payload.end(), '-', '+');
+        std::replace(payload.begin(), payload.end(), '_', '/');
+        payload.append((4 - payload.size() % 4) % 4, '=');
+
+        const JsonValue claims(ToAwsString(Utils::EncodingUtils::DecodeBase64(payload)));
+        if (claims.WasParseSuccessful() && claims.View().KeyExists("sub"))
+        {
+            return ToStdString(claims.View().GetString("sub"));
+        }
+    }
+
+    return ToStdString(HashingUtils::HexEncode(HashingUtils::CalculateSHA256(ToAwsString(idToken))));
+}
+
+std::string UserGameplayData::encodeSyncedBundleRecord(const std::string& bundleName, const SyncedBundle& bundle)
+{
+    std::ostringstream body;
+    Utils::Serialization::BinWrite(body, bundleName);
+    Utils::Serialization::BinWrite(body, bundle.Version);
+    Utils::Serialization::BinWrite(body, bundle.Items.size());
+    for (const auto& item : bundle.Items)
+    {
+        Utils::Serialization::BinWrite(body, item.first);
+        Utils::Serialization::BinWrite(body, item.second);
+    }
+
+    std::ostringstream record;
+    Utils::Serialization::BinWriteRecord(record, body.str());
+    return record.str();
+}
+
+bool UserGameplayData::decodeSyncedBundleRecord(const char* record, size_t length, std::string& outBundleName, SyncedBundle& outBundle)
+{
+    std::istringstream body(std::string(record, length));
+
+    size_t itemCount = 0;
+    Utils::Serialization::BinRead(body, outBundleName);
+    Utils::Serialization::BinRead(body, outBundle.Version);
+    Utils::Serialization::BinRead(body, itemCount);
+
+    for (size_t i = 0; i < itemCount && body.good(); ++i)
+    {
+        std::string key;
+        std::string value;
+        Utils::Serialization::BinRead(body, key);
+        Utils::Serialization::BinRead(body, value);
+        outBundle.Items[key] = value;
+    }
+
+    return !body.fail();
+}
+
+void UserGameplayData::clampClientSetting(const char* settingName, unsigned int& value, unsigned int maxValue) const
+{
+    if (value <= maxValue)
+    {
+        return;
+    }
+
+    const std::string message = "UserGameplayData::initializeClient() " + std::string(settingName) + " of " + std::to_string(value) + " is out of range, using " + std::to_string(maxValue);
+    Logging::Log(m_logCb, Level::Warning, message.c_str());
+    value = maxValue;
+}
+
+void UserGameplayData::initializeClient()
+{
+    if (m_clientSettings.ClientTimeoutSeconds == 0)
+    {
+        m_clientSettings.ClientTimeoutSeconds = DEFAULT_CLIENT_TIMEOUT_SECONDS;
+    }
+
+    if (m_clientSettings.RetryIntervalSeconds == 0)
+    {
+        m_clientSettings.RetryIntervalSeconds = DEFAULT_RETRY_INTERVAL_SECONDS;
+    }
+
+    if (m_clientSettings.MaxRetryQueueSize == 0)
+    {
+        m_clientSettings.MaxRetryQueueSize = DEFAULT_MAX_QUEUE_SIZE;
+    }
+
+    if (m_clientSettings.MaxRetries == 0)
+    {
+        m_clientSettings.MaxRetries = DEFAULT_MAX_RETRIES;
+    }
+
+    if (m_clientSettings.RetryStrategy > (unsigned int)StrategyType::CircuitBreaker)
+    {
+        // invalid value, set to default
+        m_clientSettings.RetryStrategy = DEFAULT_RETRY_STRATEGY;
+    }
+
+    if (m_clientSettings.MaxExponentialRetryThreshold == 0)
     {
         m_clientSettings.MaxExponentialRetryThreshold = DEFAULT_MAX_EXPONENTIAL_BACKOFF_THRESHOLD;
     }
@@ -678,6 +1417,16 @@ void UserGameplayData::initializeClient()
         m_clientSettings.PaginationSize = DEFAULT_PAGINATION_SIZE;
     }
 
+    if (m_clientSettings.MaxConcurrentRequests == 0)
+    {
+        m_clientSettings.MaxConcurrentRequests = DEFAULT_MAX_CONCURRENT_REQUESTS;
+    }
+
+    // Each concurrent request holds a worker thread, and the timeout and TTL become chrono durations, keep them in range
+    clampClientSetting("MaxConcurrentRequests", m_clientSettings.MaxConcurrentRequests, MAX_CONCURRENT_REQUESTS);
+    clampClientSetting("OperationTimeoutSeconds", m_clientSettings.OperationTimeoutSeconds, MAX_OPERATION_TIMEOUT_SECONDS);
+    clampClientSetting("ReadCacheTtlSeconds", m_clientSettings.ReadCacheTtlSeconds, MAX_READ_CACHE_TTL_SECONDS);
+
     // Low level client settings
     Aws::Client::ClientConfiguration clientConfig;
     GameKit::DefaultClients::SetDefaultClientConfiguration(m_sessionManager->GetClientSettings(), clientConfig);
@@ -691,6 +1440,10 @@ void UserGameplayData::initializeClient()
     // High level settings for custom client
     auto strategyBuilder = [&]()
     {
+        // Jittered delays start at the retry interval and grow up to the exponential backoff threshold in retry intervals
+        const std::chrono::milliseconds baseRetryDelay = std::chrono::seconds(m_clientSettings.RetryIntervalSeconds);
+        const std::chrono::milliseconds maxRetryDelay = baseRetryDelay * m_clientSettings.MaxExponentialRetryThreshold;
+
         StrategyType strategyType = (StrategyType)m_clientSettings.RetryStrategy;
         std::shared_ptr<IRetryStrategy> retryLogic;
         switch (strategyType)
@@ -701,6 +1454,18 @@ void UserGameplayData::initializeClient()
         case StrategyType::ConstantInterval:
             retryLogic = std::make_shared<ConstantIntervalStrategy>();
             break;
+        case StrategyType::DecorrelatedJitter:
+            retryLogic = std::make_shared<DecorrelatedJitterStrategy>(baseRetryDelay, maxRetryDelay, m_logCb);
+            break;
+        case StrategyType::RetryBudget:
+            retryLogic = std::make_shared<RetryBudgetStrategy>(std::make_shared<DecorrelatedJitterStrategy>(baseRetryDelay, maxRetryDelay, m_logCb),
+                RETRY_BUDGET_MAX_TOKENS, RETRY_BUDGET_RETRY_COST, RETRY_BUDGET_SUCCESS_REFILL, RETRY_BUDGET_REFILL_PER_SECOND, m_logCb);
+            break;
+        case StrategyType::CircuitBreaker:
+            retryLogic = std::make_shared<CircuitBreakerStrategy>(std::make_shared<RetryBudgetStrategy>(std::make_shared<DecorrelatedJitterStrategy>(baseRetryDelay, maxRetryDelay, m_logCb),
+                RETRY_BUDGET_MAX_TOKENS, RETRY_BUDGET_RETRY_COST, RETRY_BUDGET_SUCCESS_REFILL, RETRY_BUDGET_REFILL_PER_SECOND, m_logCb),
+                maxRetryDelay, CIRCUIT_BREAKER_FAILURE_THRESHOLD, m_logCb);
+            break;
         }
 
         return retryLogic;
@@ -713,13 +1478,19 @@ void UserGameplayData::initializeClient()
     // Build custom client with retry logic
     auto retryStrategy = strategyBuilder();
     m_customHttpClient = std::make_shared<UserGameplayDataHttpClient>(
-        lowLevelHttpClient, authSetter, m_clientSettings.RetryIntervalSeconds, retryStrategy, m_clientSettings.MaxRetryQueueSize, m_logCb);
+        lowLevelHttpClient, authSetter, m_clientSettings.RetryIntervalSeconds, retryStrategy, m_clientSettings.MaxRetryQueueSize, m_logCb, m_clientSettings.MaxConcurrentRequests);
+    m_customHttpClient->SetOperationTimeout(std::chrono::seconds(m_clientSettings.OperationTimeoutSeconds));
+
+    // Retries only set the authorization header again after the session tokens changed
+    Authentication::GameKitSessionManager* sessionManager = m_sessionManager;
+    m_customHttpClient->SetAuthorizationVersionGetter([sessionManager]() { return sessionManager->GetSessionTokensVersion(); });
 }
 
 void UserGameplayData::setAuthorizationHeader(std::shared_ptr<HttpRequest> request)
 {
-    std::string value = "Bearer " + m_sessionManager->GetToken(GameKit::TokenType::IdToken);
-    request->SetHeaderValue(HEADER_AUTHORIZATION, ToAwsString(value));
+    // The header value is formatted once per token, when the session manager publishes it
+    const std::shared_ptr<const Authentication::SessionTokens> tokens = m_sessionManager->GetSessionTokens();
+    request->SetHeaderValue(HEADER_AUTHORIZATION, tokens->BearerAuthorization);
 }
 
 void UserGameplayData::setPaginationLimit(std::shared_ptr<HttpRequest> request, unsigned int paginationLimit)
@@ -754,4 +1525,224 @@ void UserGameplayData::setHttpClient(std::shared_ptr<Aws::Http::HttpClient> http
 {
     m_customHttpClient->SetLowLevelHttpClient(httpClient);
 }
+
+UserGameplayData::ReadCacheEntryState UserGameplayData::getCachedBundle(const std::string& idToken, const std::string& bundleName, std::map<std::string, std::string>& outItems, std::string& outETag)
+{
+    if (m_clientSettings.ReadCacheTtlSeconds == 0)
+    {
+        return ReadCacheEntryState::Missing;
+    }
+
+    std::lock_guard<std::mutex> lock(m_readCacheMutex);
+    resetReadCacheOnTokenChange(idToken);
+
+    const auto bundle = m_readCache.find(bundleName);
+    if (bundle == m_readCache.end() || !bundle->second.IsComplete)
+    {
+        return ReadCacheEntryState::Missing;
+    }
+
+    for (const auto& item : bundle->second.Items)
+    {
+        outItems[item.first] = item.second.Value;
+    }
+    outETag = bundle->second.ETag;
+
+    return isReadCacheEntryFresh(bundle->second.ValidatedAt) ? ReadCacheEntryState::Fresh : ReadCacheEntryState::Stale;
+}
+
+UserGameplayData::ReadCacheEntryState UserGameplayData::getCachedBundleItem(const std::string& idToken, const std::string& bundleName, const std::string& itemKey, std::string& outValue, std::string& outETag)
+{
+    if (m_clientSettings.ReadCacheTtlSeconds == 0)
+    {
+        return ReadCacheEntryState::Missing;
+    }
+
+    std::lock_guard<std::mutex> lock(m_readCacheMutex);
+    resetReadCacheOnTokenChange(idToken);
+
+    const auto bundle = m_readCache.find(bundleName);
+    if (bundle == m_readCache.end())
+    {
+        return ReadCacheEntryState::Missing;
+    }
+
+    const auto item = bundle->second.Items.find(itemKey);
+    if (item == bundle->second.Items.end())
+    {
+        return ReadCacheEntryState::Missing;
+    }
+
+    outValue = item->second.Value;
+    outETag = item->second.ETag;
+
+    return isReadCacheEntryFresh(item->second.ValidatedAt) ? ReadCacheEntryState::Fresh : ReadCacheEntryState::Stale;
+}
+
+void UserGameplayData::storeCachedBundle(const std::string& idToken, const std::string& bundleName, const std::map<std::string, std::string>& items, const std::string& eTag)
+{
+    if (m_clientSettings.ReadCacheTtlSeconds == 0)
+    {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_readCacheMutex);
+    resetReadCacheOnTokenChange(idToken);
+
+    CachedBundle& bundle = m_readCache[bundleName];
+    bundle.Items.clear();
+    for (const auto& item : items)
+    {
+        bundle.Items[item.first] = { item.second, "", now };
+    }
+
+    bundle.IsComplete = true;
+    bundle.ETag = eTag;
+    bundle.ValidatedAt = now;
+}
+
+void UserGameplayData::storeCachedBundleItem(const std::string& idToken, const std::string& bundleName, const std::string& itemKey, const std::string& value, const std::string& eTag)
+{
+    if (m_clientSettings.ReadCacheTtlSeconds == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_readCacheMutex);
+    resetReadCacheOnTokenChange(idToken);
+
+    CachedBundle& bundle = m_readCache[bundleName];
+    bundle.Items[itemKey] = { value, eTag, std::chrono::steady_clock::now() };
+
+    // The bundle ETag no longer matches the cached items if the item changed since the bundle was read
+    bundle.ETag.clear();
+}
+
+void UserGameplayData::storeCachedBundleItems(const std::string& idToken, const std::string& bundleName, const std::map<std::string, std::string>& writtenItems)
+{
+    if (m_clientSettings.ReadCacheTtlSeconds == 0 || writtenItems.empty())
+    {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_readCacheMutex);
+    resetReadCacheOnTokenChange(idToken);
+
+    // Written values are what the backend holds, they are fresh but their new ETags are unknown
+    CachedBundle& bundle = m_readCache[bundleName];
+    for (const auto& item : writtenItems)
+    {
+        bundle.Items[item.first] = { item.second, "", now };
+    }
+
+    bundle.ETag.clear();
+}
+
+void UserGameplayData::revalidateCachedBundle(const std::string& bundleName)
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_readCacheMutex);
+    const auto bundle = m_readCache.find(bundleName);
+    if (bundle == m_readCache.end())
+    {
+        return;
+    }
+
+    bundle->second.ValidatedAt = now;
+    for (auto& item : bundle->second.Items)
+    {
+        item.second.ValidatedAt = now;
+    }
+}
+
+void UserGameplayData::revalidateCachedBundleItem(const std::string& bundleName, const std::string& itemKey)
+{
+    std::lock_guard<std::mutex> lock(m_readCacheMutex);
+    const auto bundle = m_readCache.find(bundleName);
+    if (bundle == m_readCache.end())
+    {
+        return;
+    }
+
+    const auto item = bundle->second.Items.find(itemKey);
+    if (item != bundle->second.Items.end())
+    {
+        item->second.ValidatedAt = std::chrono::steady_clock::now();
+    }
+}
+
+void UserGameplayData::invalidateCachedBundle(const std::string& bundleName)
+{
+    std::lock_guard<std::mutex> lock(m_readCacheMutex);
+    m_readCache.erase(bundleName);
+}
+
+void UserGameplayData::invalidateCachedBundleItems(const std::string& bundleName, const std::vector<std::string>& itemKeys)
+{
+    std::lock_guard<std::mutex> lock(m_readCacheMutex);
+    const auto bundle = m_readCache.find(bundleName);
+    if (bundle == m_readCache.end())
+    {
+        return;
+    }
+
+    for (const std::string& itemKey : itemKeys)
+    {
+        bundle->second.Items.erase(itemKey);
+    }
+
+    bundle->second.ETag.clear();
+}
+
+void UserGameplayData::clearReadCache()
+{
+    std::lock_guard<std::mutex> lock(m_readCacheMutex);
+    m_readCache.clear();
+    m_readCacheIdToken.clear();
+}
+
+void UserGameplayData::resetReadCacheOnTokenChange(const std::string& idToken)
+{
+    // Tokens are refreshed periodically, dropping the cache then is cheaper than keeping another player's data
+    if (m_readCacheIdToken != idToken)
+    {
+        m_readCache.clear();
+        m_readCacheIdToken = idToken;
+    }
+}
+
+bool UserGameplayData::isReadCacheEntryFresh(const std::chrono::steady_clock::time_point& validatedAt) const
+{
+    return std::chrono::steady_clock::now() - validatedAt < std::chrono::seconds(m_clientSettings.ReadCacheTtlSeconds);
+}
+
+bool UserGameplayData::isWriteAccepted(const RequestResult& result)
+{
+    return result.ResultType == RequestResultType::RequestMadeSuccess ||
+        result.ResultType == RequestResultType::RequestEnqueued ||
+        result.ResultType == RequestResultType::RequestAttemptedAndEnqueued;
+}
+
+bool UserGameplayData::isBackendUnreachable(const RequestResult& result)
+{
+    if (result.ResultType == RequestResultType::RequestDropped ||
+        result.ResultType == RequestResultType::RequestEnqueued ||
+        result.ResultType == RequestResultType::RequestAttemptedAndEnqueued)
+    {
+        return true;
+    }
+
+    if (result.Response == nullptr)
+    {
+        return false;
+    }
+
+    const HttpResponseCode responseCode = result.Response->GetResponseCode();
+    return responseCode == HttpResponseCode::REQUEST_NOT_MADE || static_cast<int>(responseCode) >= 500;
+}
 #pragma endregion
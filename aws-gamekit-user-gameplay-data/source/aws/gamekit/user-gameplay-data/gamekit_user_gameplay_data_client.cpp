@@ -1,12 +1,210 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <iterator>
+#include <set>
+
+// AWS SDK
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+
+// GameKit
+#include <aws/gamekit/user-gameplay-data/gamekit_user_gameplay_data.h>
 #include <aws/gamekit/user-gameplay-data/gamekit_user_gameplay_data_client.h>
 
+using namespace Aws::Utils::Json;
 using namespace GameKit::Utils::HttpClient;
 using namespace GameKit::Utils::Serialization;
 using namespace GameKit::UserGameplayData;
 
+namespace
+{
+    // Write operations on a bundle that are sent as a single bundle write
+    struct BundleWriteBatch
+    {
+        Aws::Http::URI Uri;
+        Aws::Map<Aws::String, Aws::String> Items;
+        std::vector<std::shared_ptr<UserGameplayDataOperation>> Operations;
+    };
+
+    void rewindStream(Aws::IOStream& stream)
+    {
+        stream.clear();
+        stream.seekg(0);
+    }
+
+    // Get the bundle URI and the items written by an Add or Update operation. Returns false if the operation can't be batched.
+    bool tryGetBundleWrite(const UserGameplayDataOperation* operation, Aws::Http::URI& outUri, Aws::Map<Aws::String, Aws::String>& outItems)
+    {
+        const std::shared_ptr<Aws::Http::HttpRequest>& request = operation->Request;
+        if (operation->Type != UserGameplayDataOperationType::Write || request == nullptr || request->GetContentBody() == nullptr)
+        {
+            return false;
+        }
+
+        // The body is rewound so the request can still be sent on its own
+        const JsonValue body(*request->GetContentBody());
+        rewindStream(*request->GetContentBody());
+
+        if (!body.WasParseSuccessful() || !body.View().IsObject())
+        {
+            return false;
+        }
+
+        const JsonView view = body.View();
+        outUri = request->GetUri();
+
+        if (operation->ItemKey.empty() && request->GetMethod() == Aws::Http::HttpMethod::HTTP_POST)
+        {
+            // Add, the body maps item keys to values
+            for (const auto& item : view.GetAllObjects())
+            {
+                if (!item.second.IsString())
+                {
+                    return false;
+                }
+
+                outItems[item.first] = item.second.AsString();
+            }
+
+            return !outItems.empty();
+        }
+
+        if (!operation->ItemKey.empty() && request->GetMethod() == Aws::Http::HttpMethod::HTTP_PUT)
+        {
+            // Update, the item is written to its bundle once the item part of the path is removed
+            const Aws::String path = outUri.GetPath();
+            const Aws::String itemPathPart = (BUNDLE_ITEMS_PATH_PART + operation->ItemKey).c_str();
+            if (!view.KeyExists(BUNDLE_ITEM_VALUE) || !view.GetObject(BUNDLE_ITEM_VALUE).IsString() ||
+                path.size() <= itemPathPart.size() || path.compare(path.size() - itemPathPart.size(), itemPathPart.size(), itemPathPart) != 0)
+            {
+                return false;
+            }
+
+            outUri.SetPath(path.substr(0, path.size() - itemPathPart.size()));
+            outItems[operation->ItemKey.c_str()] = view.GetString(BUNDLE_ITEM_VALUE);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // Invoke the callbacks of the operations folded into a bundle write. Operations with an item reported as unprocessed fail.
+    void notifyBatchedOperations(const UserGameplayDataOperation* batched, std::shared_ptr<Aws::Http::HttpResponse> response, bool succeeded)
+    {
+        std::set<Aws::String> unprocessedKeys;
+        if (succeeded && response != nullptr)
+        {
+            const JsonValue bodyJson(response->GetResponseBody());
+            if (bodyJson.WasParseSuccessful() && bodyJson.View().KeyExists(ENVELOPE_KEY_DATA))
+            {
+                const JsonView data = bodyJson.View().GetObject(ENVELOPE_KEY_DATA);
+                if (data.KeyExists(UNPROCESSED_ITEMS))
+                {
+                    auto unprocessedItems = data.GetArray(UNPROCESSED_ITEMS);
+                    for (size_t i = 0; i < unprocessedItems.GetLength(); ++i)
+                    {
+                        unprocessedKeys.insert(unprocessedItems[i].GetString(BUNDLE_ITEM_KEY));
+                    }
+                }
+            }
+        }
+
+        for (const auto& operation : batched->BatchedOperations)
+        {
+            bool operationSucceeded = succeeded;
+            if (operationSucceeded && !unprocessedKeys.empty())
+            {
+                Aws::Http::URI uri;
+                Aws::Map<Aws::String, Aws::String> items;
+                tryGetBundleWrite(operation.get(), uri, items);
+
+                operationSucceeded = std::none_of(items.begin(), items.end(),
+                    [&](const std::pair<const Aws::String, Aws::String>& item) { return unprocessedKeys.count(item.first) != 0; });
+            }
+
+            const ResponseCallback& callback = operationSucceeded ? operation->SuccessCallback : operation->FailureCallback;
+            if (callback)
+            {
+                // Every callback reads the response from the start
+                if (response != nullptr)
+                {
+                    rewindStream(response->GetResponseBody());
+                }
+
+                callback(operation->CallbackContext, response);
+            }
+        }
+    }
+
+    std::shared_ptr<UserGameplayDataOperation> makeBatchedOperation(const BundleWriteBatch& batch)
+    {
+        const std::shared_ptr<UserGameplayDataOperation>& newest = batch.Operations.back();
+
+        JsonValue payload;
+        for (const auto& item : batch.Items)
+        {
+            payload.WithString(item.first, item.second);
+        }
+
+        std::shared_ptr<Aws::IOStream> payloadStream = Aws::MakeShared<Aws::StringStream>("BatchedUserGameplayDataBody");
+        const Aws::String serialized = payload.View().WriteCompact();
+        *payloadStream << serialized;
+
+        auto request = Aws::Http::CreateHttpRequest(batch.Uri, Aws::Http::HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        if (newest->Request->HasHeader(HEADER_AUTHORIZATION.c_str()))
+        {
+            request->SetHeaderValue(HEADER_AUTHORIZATION, newest->Request->GetHeaderValue(HEADER_AUTHORIZATION.c_str()));
+        }
+
+        request->AddContentBody(payloadStream);
+        request->SetContentType("application/json");
+        request->SetContentLength(Aws::Utils::StringUtils::to_string(serialized.size()));
+
+        auto batched = std::make_shared<UserGameplayDataOperation>(UserGameplayDataOperationType::Write, newest->Bundle, "", request,
+            Aws::Http::HttpResponseCode::CREATED, newest->MaxAttempts, newest->Timestamp);
+
+        for (const auto& operation : batch.Operations)
+        {
+            batched->Attempts = std::max(batched->Attempts, operation->Attempts);
+
+            // The batch is due when its last operation is and expires with its first one
+            batched->NextAttemptTime = std::max(batched->NextAttemptTime, operation->NextAttemptTime);
+            batched->RetryDelay = std::max(batched->RetryDelay, operation->RetryDelay);
+            if (operation->Deadline.count() != 0 && (batched->Deadline.count() == 0 || operation->Deadline < batched->Deadline))
+            {
+                batched->Deadline = operation->Deadline;
+            }
+
+            // A bundle write that is batched again hands over the operations it was made of
+            if (operation->BatchedOperations.empty())
+            {
+                batched->BatchedOperations.push_back(operation);
+            }
+            else
+            {
+                std::copy(operation->BatchedOperations.begin(), operation->BatchedOperations.end(), std::back_inserter(batched->BatchedOperations));
+            }
+        }
+
+        // The callbacks are only invoked while the batched operation is being sent, so it is still alive
+        const UserGameplayDataOperation* batchedOperation = batched.get();
+        batched->SuccessCallback = [batchedOperation](CallbackContext, std::shared_ptr<Aws::Http::HttpResponse> response)
+        {
+            notifyBatchedOperations(batchedOperation, response, true);
+        };
+        batched->FailureCallback = [batchedOperation](CallbackContext, std::shared_ptr<Aws::Http::HttpResponse> response)
+        {
+            notifyBatchedOperations(batchedOperation, response, false);
+        };
+
+        return batched;
+    }
+}
+
 #pragma region UserGameplayData Public Methods
 bool GameKit::UserGameplayData::OperationTimestampCompare(const std::shared_ptr<IOperation> lhs, const std::shared_ptr<IOperation> rhs)
 {
@@ -131,67 +329,99 @@ RequestResult UserGameplayDataHttpClient::MakeRequest(UserGameplayDataOperationT
 void UserGameplayDataHttpClient::filterQueue(OperationQueue* queue, OperationQueue* filtered)
 {
     Logging::Log(m_logCb, Level::Verbose, "UserGameplayDataHttpClient::FilterQueue");
-    std::map<std::string, std::deque<UserGameplayDataOperation*>> temp;
     unsigned int operationsDiscarded = 0;
 
-    // Sort queue based on timestamp. Order is important for User Gameplay Data filtering
-    std::sort(queue->begin(), queue->end(), OperationTimestampCompare);
-
-    for (auto operationIt = queue->begin(); operationIt != queue->end(); ++operationIt)
+    // Older operations were discarded when a newer operation superseding them was enqueued, the queue is already in order
+    for (auto& operation : *queue)
     {
-        UserGameplayDataOperation* operation = static_cast<UserGameplayDataOperation*>((*operationIt).get());
-
-        auto& queueWithSameKey = temp[operation->OperationUniqueKey];
-
-        if (queueWithSameKey.empty())
+        if (operation->Discard)
         {
-            queueWithSameKey.push_back(operation);
+            operationsDiscarded++;
+            continue;
         }
-        else
-        {
-            auto& previousOperation = queueWithSameKey.back();
 
-            // If keys don't match, keep both.
-            // Some rare coincidence caused two operations to be mapped to the same queue
-            if (operation->Bundle != previousOperation->Bundle ||
-                operation->ItemKey != previousOperation->ItemKey)
-            {
-                Logging::Log(m_logCb, Level::Warning, "UserGameplayDataOperation key mismatch, keeping both operations.");
-                queueWithSameKey.push_back(operation);
-            }
+        filtered->push_back(operation);
+    }
 
-            // If this is an item-level operation, most recent one is kept
-            // If this is a bundle-level operation, or global,
-            // and if most recent is delete, keep delete, else keep both
+    size_t operationsBatched = batchBundleWrites(filtered);
 
-            if (!operation->ItemKey.empty() && !previousOperation->ItemKey.empty())
-            {
-                Logging::Log(m_logCb, Level::Verbose, "Discarding previous item operation, newer operation overwrites data.");
-                previousOperation->Discard = true;
-                queueWithSameKey.pop_back();
-            }
-            else if (operation->Type == UserGameplayDataOperationType::Delete)
+    std::string message = "UserGameplayDataHttpClient::FilterQueue. Discarded " + std::to_string(operationsDiscarded) + " operations, batched " +
+        std::to_string(operationsBatched) + " operations.";
+    Logging::Log(m_logCb, Level::Info, message.c_str());
+}
+
+size_t UserGameplayDataHttpClient::batchBundleWrites(OperationQueue* filtered) const
+{
+    std::vector<BundleWriteBatch> batches;
+    std::map<std::string, size_t> openBatches; // bundle name to the batch that can still take writes
+
+    for (auto& queuedOperation : *filtered)
+    {
+        auto operation = std::static_pointer_cast<UserGameplayDataOperation>(queuedOperation);
+        Aws::Http::URI uri;
+        Aws::Map<Aws::String, Aws::String> items;
+
+        if (operation->Bundle.empty())
+        {
+            // Operations without bundle are ordered against every write
+            openBatches.clear();
+        }
+        else if (!operation->FromCache && tryGetBundleWrite(operation.get(), uri, items))
+        {
+            // Cached operations are not batched so each one is still counted when the cache is processed
+            auto openBatch = openBatches.find(operation->Bundle);
+            if (openBatch != openBatches.end())
             {
-                Logging::Log(m_logCb, Level::Verbose, "Discarding previous bundle operation, newer operation overwrites data.");
-                previousOperation->Discard = true;
-                queueWithSameKey.pop_back();
+                BundleWriteBatch& batch = batches[openBatch->second];
+                if (batch.Items.size() + items.size() <= MAX_BATCHED_BUNDLE_ITEMS && batch.Operations.front()->MaxAttempts == operation->MaxAttempts)
+                {
+                    // Newer writes overwrite older writes to the same item
+                    for (auto& item : items)
+                    {
+                        batch.Items[item.first] = item.second;
+                    }
+
+                    batch.Operations.push_back(operation);
+                    continue;
+                }
             }
 
-            queueWithSameKey.push_back(operation);
+            openBatches[operation->Bundle] = batches.size();
+            batches.push_back(BundleWriteBatch{ uri, items, { operation } });
+            continue;
         }
+        else
+        {
+            // Deletes and writes that can't be batched keep their place between the writes on their bundle
+            openBatches.erase(operation->Bundle);
+        }
+
+        batches.push_back(BundleWriteBatch{ Aws::Http::URI(), Aws::Map<Aws::String, Aws::String>(), { operation } });
     }
 
-    // Enqueue non discarded operations
-    for (auto& operation : *queue)
+    size_t operationsBatched = 0;
+    filtered->clear();
+
+    for (auto& batch : batches)
     {
-        if (!operation->Discard)
+        if (batch.Operations.size() == 1)
         {
-            filtered->push_back(operation);
+            filtered->push_back(batch.Operations.front());
+            continue;
         }
+
+        // The batch takes the place of its oldest write, no other operation on its bundle is queued in between
+        filtered->push_back(makeBatchedOperation(batch));
+
+        for (auto& operation : batch.Operations)
+        {
+            operation->Discard = true;
+        }
+
+        operationsBatched += batch.Operations.size();
     }
 
-    std::string message = "UserGameplayDataHttpClient::FilterQueue. Discarded " + std::to_string(operationsDiscarded) + " operations.";
-    Logging::Log(m_logCb, Level::Info, message.c_str());
+    return operationsBatched;
 }
 
 bool UserGameplayDataHttpClient::shouldEnqueueWithUnhealthyConnection(const std::shared_ptr<IOperation> operation) const
@@ -217,4 +447,39 @@ bool UserGameplayDataHttpClient::isOperationRetryable(const std::shared_ptr<IOpe
         ugpdOperation->Type != UserGameplayDataOperationType::Get &&
         isResponseRetryable;
 }
+
+std::string UserGameplayDataHttpClient::getOrderingKey(const std::shared_ptr<IOperation> operation) const
+{
+    auto ugpdOperation = static_cast<const UserGameplayDataOperation*>(operation.get());
+
+    // Bundle level operations may affect every item in the bundle, so items are ordered per bundle rather than per item
+    return ugpdOperation->Bundle;
+}
+
+const std::string& UserGameplayDataHttpClient::getSupersessionKey(const std::shared_ptr<IOperation>& operation) const
+{
+    return static_cast<const UserGameplayDataOperation*>(operation.get())->OperationUniqueKey;
+}
+
+bool UserGameplayDataHttpClient::supersedes(const std::shared_ptr<IOperation>& newer, const std::shared_ptr<IOperation>& older) const
+{
+    auto newerOperation = static_cast<const UserGameplayDataOperation*>(newer.get());
+    auto olderOperation = static_cast<const UserGameplayDataOperation*>(older.get());
+
+    // If this is an item-level operation, most recent one is kept
+    // If this is a bundle-level operation, or global, and if most recent is delete, keep delete, else keep both
+    if (!newerOperation->ItemKey.empty() && !olderOperation->ItemKey.empty())
+    {
+        Logging::Log(m_logCb, Level::Verbose, "Discarding previous item operation, newer operation overwrites data.");
+        return true;
+    }
+
+    if (newerOperation->Type == UserGameplayDataOperationType::Delete)
+    {
+        Logging::Log(m_logCb, Level::Verbose, "Discarding previous bundle operation, newer operation overwrites data.");
+        return true;
+    }
+
+    return false;
+}
 #pragma endregion
@@ -62,6 +62,37 @@ TEST_F(GameKitSessionManagerTestFixture, KeyExists_TestAddKey_Success)
     ASSERT_EQ("xyz", token);
 }
 
+TEST_F(GameKitSessionManagerTestFixture, SnapshotHeld_TestSetToken_SnapshotUnchangedAndNewVersionPublished)
+{
+    // arrange
+    gamekitSessionManagerInstance->SetToken(GameKit::TokenType::IdToken, "abc");
+    const auto heldTokens = gamekitSessionManagerInstance->GetSessionTokens();
+
+    // act
+    gamekitSessionManagerInstance->SetToken(GameKit::TokenType::IdToken, "xyz");
+    const auto currentTokens = gamekitSessionManagerInstance->GetSessionTokens();
+
+    // assert
+    ASSERT_EQ("abc", heldTokens->Tokens[(size_t)GameKit::TokenType::IdToken]);
+    ASSERT_EQ("xyz", currentTokens->Tokens[(size_t)GameKit::TokenType::IdToken]);
+    ASSERT_GT(currentTokens->Version, heldTokens->Version);
+}
+
+TEST_F(GameKitSessionManagerTestFixture, IdTokenSet_TestGetSessionTokens_AuthorizationFormattedAndVersionChanged)
+{
+    // arrange
+    const uint64_t initialVersion = gamekitSessionManagerInstance->GetSessionTokensVersion();
+
+    // act
+    gamekitSessionManagerInstance->SetToken(GameKit::TokenType::IdToken, "abc");
+    const auto tokens = gamekitSessionManagerInstance->GetSessionTokens();
+
+    // assert
+    ASSERT_STREQ("abc", tokens->IdTokenAuthorization.c_str());
+    ASSERT_STREQ("Bearer abc", tokens->BearerAuthorization.c_str());
+    ASSERT_NE(initialVersion, gamekitSessionManagerInstance->GetSessionTokensVersion());
+}
+
 TEST_F(GameKitSessionManagerTestFixture, No_RefreshToken_Abort_Success)
 {
     // arrange
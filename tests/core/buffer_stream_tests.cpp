@@ -0,0 +1,119 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <iterator>
+#include <string>
+
+// GameKit
+#include "buffer_stream_tests.h"
+
+using namespace GameKit::Tests::Utils;
+using GameKit::Utils::BufferStream;
+using GameKit::Utils::OutputBufferStream;
+
+TEST_F(GameKitUtilsBufferStreamTestFixture, Read_WholeBuffer_ReturnsBufferContent)
+{
+    // arrange
+    const std::string data("slot data\0with a null byte", 26);
+    BufferStream stream(data.data(), data.size());
+
+    // act
+    std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+    // assert
+    ASSERT_EQ(data, content);
+}
+
+TEST_F(GameKitUtilsBufferStreamTestFixture, Seek_AfterRead_ReadsAgainFromPosition)
+{
+    // arrange
+    const std::string data = "0123456789";
+    BufferStream stream(data.data(), data.size());
+    char buffer[4] = {};
+
+    // act
+    stream.seekg(0, std::ios::end);
+    std::streampos size = stream.tellg();
+    stream.seekg(0, std::ios::beg);
+    stream.read(buffer, 3);
+    stream.seekg(-2, std::ios::cur);
+    std::string afterRelativeSeek(1, (char)stream.get());
+    stream.seekg(7);
+    std::string rest((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+    // assert
+    ASSERT_EQ(10, size);
+    ASSERT_STREQ("012", buffer);
+    ASSERT_EQ("1", afterRelativeSeek);
+    ASSERT_EQ("789", rest);
+}
+
+TEST_F(GameKitUtilsBufferStreamTestFixture, Seek_OutOfRange_Fails)
+{
+    // arrange
+    const std::string data = "0123456789";
+    BufferStream stream(data.data(), data.size());
+
+    // act
+    stream.seekg(11);
+
+    // assert
+    ASSERT_TRUE(stream.fail());
+}
+
+TEST_F(GameKitUtilsBufferStreamTestFixture, Write_ReadOnlyBuffer_Fails)
+{
+    // arrange
+    const std::string data = "0123456789";
+    BufferStream stream(data.data(), data.size());
+
+    // act
+    stream << "abc";
+    stream.flush();
+
+    // assert
+    ASSERT_TRUE(stream.fail() || stream.bad());
+    ASSERT_EQ("0123456789", data);
+}
+
+TEST_F(GameKitUtilsBufferStreamTestFixture, OutputStream_WriteThenRead_WritesIntoBufferAndReadsBack)
+{
+    // arrange
+    char buffer[16] = {};
+    OutputBufferStream stream(buffer, sizeof(buffer));
+
+    // act
+    stream.write("slot", 4);
+    stream.write("\0data", 5);
+    stream.seekg(0, std::ios::end);
+    std::streampos size = stream.tellg();
+    stream.seekg(0, std::ios::beg);
+    std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+    // assert
+    ASSERT_TRUE(stream.good() || stream.eof());
+    ASSERT_FALSE(stream.HasOverflowed());
+    ASSERT_EQ(9, stream.Size());
+    ASSERT_EQ(9, size);
+    ASSERT_EQ(std::string("slot\0data", 9), content);
+    ASSERT_EQ(std::string("slot\0data", 9), std::string(buffer, 9));
+}
+
+TEST_F(GameKitUtilsBufferStreamTestFixture, OutputStream_WritePastCapacity_FailsAndKeepsBufferBounds)
+{
+    // arrange
+    char buffer[8] = {};
+    buffer[7] = 'x';
+    OutputBufferStream stream(buffer, 4);
+
+    // act
+    stream.write("0123456", 7);
+
+    // assert
+    ASSERT_TRUE(stream.bad());
+    ASSERT_TRUE(stream.HasOverflowed());
+    ASSERT_EQ(4, stream.Size());
+    ASSERT_EQ("0123", std::string(buffer, 4));
+    ASSERT_EQ('x', buffer[7]);
+}
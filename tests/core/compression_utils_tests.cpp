@@ -0,0 +1,108 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <sstream>
+#include <string>
+#include <vector>
+
+// GameKit
+#include "compression_utils_tests.h"
+
+using namespace GameKit::Tests::Utils;
+using GameKit::Utils::CompressionUtils;
+
+namespace
+{
+    std::string repetitiveData(size_t size)
+    {
+        std::string data;
+        for (int i = 0; data.size() < size; ++i)
+        {
+            data += "player position " + std::to_string(i % 97) + ";";
+        }
+
+        data.resize(size);
+        return data;
+    }
+}
+
+TEST_F(GameKitUtilsCompressionUtilsTestFixture, DeflateThenInflate_LargerThanStreamBuffer_RoundTrips)
+{
+    // arrange
+    const std::string data = repetitiveData(10 * COMPRESSION_STREAM_BUFFER_SIZE);
+    std::vector<uint8_t> compressed;
+    std::vector<char> decompressed(data.size());
+    size_t decompressedSize = 0;
+
+    // act
+    const bool deflated = CompressionUtils::Deflate(data.data(), data.size(), compressed);
+    std::istringstream compressedStream(std::string(compressed.begin(), compressed.end()));
+    const bool inflated = CompressionUtils::Inflate(compressedStream, decompressed.data(), decompressed.size(), decompressedSize);
+
+    // assert
+    ASSERT_TRUE(deflated);
+    ASSERT_LT(compressed.size(), data.size());
+    ASSERT_TRUE(inflated);
+    ASSERT_EQ(data.size(), decompressedSize);
+    ASSERT_EQ(data, std::string(decompressed.begin(), decompressed.end()));
+}
+
+TEST_F(GameKitUtilsCompressionUtilsTestFixture, Inflate_BufferTooSmall_Fails)
+{
+    // arrange
+    const std::string data = repetitiveData(4096);
+    std::vector<uint8_t> compressed;
+    CompressionUtils::Deflate(data.data(), data.size(), compressed);
+    std::vector<char> decompressed(data.size() - 1);
+    size_t decompressedSize = 0;
+
+    // act
+    std::istringstream compressedStream(std::string(compressed.begin(), compressed.end()));
+    const bool inflated = CompressionUtils::Inflate(compressedStream, decompressed.data(), decompressed.size(), decompressedSize);
+
+    // assert
+    ASSERT_FALSE(inflated);
+    ASSERT_EQ(0, decompressedSize);
+}
+
+TEST_F(GameKitUtilsCompressionUtilsTestFixture, Inflate_TruncatedOrCorruptData_Fails)
+{
+    // arrange
+    const std::string data = repetitiveData(4096);
+    std::vector<uint8_t> compressed;
+    CompressionUtils::Deflate(data.data(), data.size(), compressed);
+    std::vector<char> decompressed(data.size());
+    size_t decompressedSize = 0;
+
+    std::string corrupt(compressed.begin(), compressed.end());
+    corrupt[corrupt.size() / 2] ^= 0x5A;
+
+    // act
+    std::istringstream truncatedStream(std::string(compressed.begin(), compressed.begin() + compressed.size() / 2));
+    const bool truncatedInflated = CompressionUtils::Inflate(truncatedStream, decompressed.data(), decompressed.size(), decompressedSize);
+    std::istringstream corruptStream(corrupt);
+    const bool corruptInflated = CompressionUtils::Inflate(corruptStream, decompressed.data(), decompressed.size(), decompressedSize);
+
+    // assert
+    ASSERT_FALSE(truncatedInflated);
+    ASSERT_FALSE(corruptInflated);
+}
+
+TEST_F(GameKitUtilsCompressionUtilsTestFixture, DeflateThenInflate_EmptyBuffer_RoundTrips)
+{
+    // arrange
+    std::vector<uint8_t> compressed;
+    char decompressed[1];
+    size_t decompressedSize = 1;
+
+    // act
+    const bool deflated = CompressionUtils::Deflate(nullptr, 0, compressed);
+    std::istringstream compressedStream(std::string(compressed.begin(), compressed.end()));
+    const bool inflated = CompressionUtils::Inflate(compressedStream, decompressed, 0, decompressedSize);
+
+    // assert
+    ASSERT_TRUE(deflated);
+    ASSERT_TRUE(inflated);
+    ASSERT_EQ(0, decompressedSize);
+}
@@ -27,4 +27,9 @@ TEST_F(GameKitUtilsCountTickerTestFixture, SharedTicker_ThreadStopsAfterTickerDe
 TEST_F(GameKitUtilsCountTickerTestFixture, Ticker_StartCalledTwice_NewThreadNotStarted)
 {
     Test_Ticker_StartCalledTwice_NewThreadNotStarted();
+}
+
+TEST_F(GameKitUtilsCountTickerTestFixture, Ticker_Stop_ReturnsBeforeIntervalEnds)
+{
+    Test_Ticker_Stop_ReturnsBeforeIntervalEnds();
 }
\ No newline at end of file
@@ -0,0 +1,159 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// GameKit
+#include "custom_test_flags.h"
+#include "http_client_queue_file_test.h"
+#include "timestamp_operation_serializer.h"
+
+using namespace GameKit::Tests::Utils;
+using namespace GameKit::Utils::HttpClient;
+using namespace GameKit::Utils::Serialization;
+
+#define QUEUE_BIN_FILE "./http_client_queue_file_test.dat"
+#define QUEUE_COPY_BIN_FILE "./http_client_queue_file_test_copy.dat"
+
+namespace
+{
+    // Only the queue persistence of the base client is exercised, the background thread is never started
+    class QueueFileHttpClient : public BaseHttpClient
+    {
+    protected:
+        bool isOperationRetryable(const std::shared_ptr<IOperation> operation, std::shared_ptr<const Aws::Http::HttpResponse> response) const override
+        {
+            return true;
+        }
+
+        bool shouldEnqueueWithUnhealthyConnection(const std::shared_ptr<IOperation> operation) const override
+        {
+            return true;
+        }
+
+        void filterQueue(OperationQueue* queue, OperationQueue* filtered) override
+        {
+            filtered->insert(filtered->end(), queue->begin(), queue->end());
+        }
+
+    public:
+        QueueFileHttpClient(std::shared_ptr<Aws::Http::HttpClient> client, FuncLogCallback logCb) :
+            BaseHttpClient("QueueFileHttpClient", client, [](std::shared_ptr<Aws::Http::HttpRequest>) {}, 1, std::make_shared<ConstantIntervalStrategy>(), 10, logCb)
+        {}
+    };
+
+    void writeVersionedFile(const std::string& file, uint32_t version, const std::vector<long long>& timestamps)
+    {
+        std::ofstream os(file, std::ios::binary);
+        BinWrite(os, static_cast<uint32_t>(QUEUE_FILE_MAGIC));
+        BinWrite(os, version);
+        BinWrite(os, timestamps.size());
+        for (long long timestamp : timestamps)
+        {
+            std::stringstream record;
+            BinWrite(record, timestamp);
+            BinWriteRecord(os, record.str());
+        }
+    }
+
+    // Files written before the format was versioned hold the operation count followed by the unframed operations
+    void writeLegacyFile(const std::string& file, const std::vector<long long>& timestamps)
+    {
+        std::ofstream os(file, std::ios::binary);
+        BinWrite(os, timestamps.size());
+        for (long long timestamp : timestamps)
+        {
+            BinWrite(os, timestamp);
+        }
+    }
+
+    std::string readFile(const std::string& file)
+    {
+        std::ifstream is(file, std::ios::binary);
+        std::stringstream contents;
+        contents << is.rdbuf();
+
+        return contents.str();
+    }
+}
+
+GameKitHttpClientQueueFileTestFixture::GameKitHttpClientQueueFileTestFixture()
+{}
+
+GameKitHttpClientQueueFileTestFixture::~GameKitHttpClientQueueFileTestFixture()
+{}
+
+void GameKitHttpClientQueueFileTestFixture::SetUp()
+{
+    testStack.Initialize();
+    remove(QUEUE_BIN_FILE);
+    remove(QUEUE_COPY_BIN_FILE);
+}
+
+void GameKitHttpClientQueueFileTestFixture::TearDown()
+{
+    remove(QUEUE_BIN_FILE);
+    remove(QUEUE_COPY_BIN_FILE);
+
+    testStack.CleanupAndLog<TestLogger>();
+    TestExecutionUtils::AbortOnFailureIfEnabled();
+}
+
+TEST_F(GameKitHttpClientQueueFileTestFixture, LoadQueueThenPersistQueue_VersionedFile_RoundTripsUnchanged)
+{
+    // Arrange
+    writeVersionedFile(QUEUE_BIN_FILE, QUEUE_FILE_VERSION, { 1, 2, 3 });
+    const std::string written = readFile(QUEUE_BIN_FILE);
+    auto mockHttpClient = std::make_shared<MockHttpClient>();
+    QueueFileHttpClient client(mockHttpClient, TestLogger::Log);
+
+    // Act
+    bool loadResult = client.LoadQueue(QUEUE_BIN_FILE, DeserializeTimestamp, false);
+    bool persistResult = client.PersistQueue(QUEUE_COPY_BIN_FILE, SerializeTimestamp);
+
+    // Assert
+    ASSERT_TRUE(loadResult);
+    ASSERT_TRUE(persistResult);
+    ASSERT_EQ(written, readFile(QUEUE_COPY_BIN_FILE));
+}
+
+TEST_F(GameKitHttpClientQueueFileTestFixture, LoadQueue_LegacyFile_OperationsLoadedInOrderAndPersistedVersioned)
+{
+    // Arrange
+    writeLegacyFile(QUEUE_BIN_FILE, { 1, 2, 3 });
+    auto mockHttpClient = std::make_shared<MockHttpClient>();
+    QueueFileHttpClient client(mockHttpClient, TestLogger::Log);
+
+    // Act
+    bool loadResult = client.LoadQueue(QUEUE_BIN_FILE, DeserializeTimestamp);
+    bool legacyFileExists = std::ifstream(QUEUE_BIN_FILE).good();
+    bool persistResult = client.PersistQueue(QUEUE_COPY_BIN_FILE, SerializeTimestamp);
+
+    // Assert
+    ASSERT_TRUE(loadResult);
+    ASSERT_FALSE(legacyFileExists);
+    ASSERT_TRUE(persistResult);
+
+    writeVersionedFile(QUEUE_BIN_FILE, QUEUE_FILE_VERSION, { 1, 2, 3 });
+    ASSERT_EQ(readFile(QUEUE_BIN_FILE), readFile(QUEUE_COPY_BIN_FILE));
+}
+
+TEST_F(GameKitHttpClientQueueFileTestFixture, LoadQueue_NewerVersion_Fails)
+{
+    // Arrange
+    writeVersionedFile(QUEUE_BIN_FILE, QUEUE_FILE_VERSION + 1, { 1 });
+    auto mockHttpClient = std::make_shared<MockHttpClient>();
+    QueueFileHttpClient client(mockHttpClient, TestLogger::Log);
+
+    // Act
+    bool loadResult = client.LoadQueue(QUEUE_BIN_FILE, DeserializeTimestamp, false);
+    bool persistResult = client.PersistQueue(QUEUE_COPY_BIN_FILE, SerializeTimestamp);
+
+    // Assert
+    ASSERT_FALSE(loadResult);
+    ASSERT_TRUE(persistResult); // nothing was loaded, so there is nothing to persist
+    ASSERT_FALSE(std::ifstream(QUEUE_COPY_BIN_FILE).good());
+}
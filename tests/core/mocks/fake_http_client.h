@@ -129,7 +129,13 @@ public:
     {
         this->responseBody = responseBody;
         std::stringstream ss(responseBody);
-        bodyStream = std::make_shared<Aws::StringStream>(responseBody.c_str());
+        bodyStream = std::make_shared<Aws::StringStream>(Aws::String(responseBody.begin(), responseBody.end()));
+    }
+
+    // Use a stream created by the request's response stream factory as the body, the way the SDK http clients do
+    void SetResponseBodyStream(Aws::IOStream* stream)
+    {
+        bodyStream = std::shared_ptr<Aws::IOStream>(stream, [](Aws::IOStream* s) { Aws::Delete(s); });
     }
 
     virtual Aws::IOStream& GetResponseBody() const override
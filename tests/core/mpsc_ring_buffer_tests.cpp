@@ -0,0 +1,109 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <memory>
+#include <thread>
+#include <vector>
+
+// GameKit
+#include "mpsc_ring_buffer_tests.h"
+
+using namespace GameKit::Tests::Utils;
+using GameKit::Utils::MpscRingBuffer;
+
+TEST_F(GameKitUtilsMpscRingBufferTestFixture, TryPop_AfterPushes_ReturnsValuesInOrder)
+{
+    // arrange
+    MpscRingBuffer<std::shared_ptr<int>> buffer(3);
+    std::shared_ptr<int> value;
+
+    // act
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(buffer.TryPush(std::make_shared<int>(i)));
+    }
+
+    // assert
+    ASSERT_EQ(3, buffer.Size());
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(buffer.TryPop(value));
+        ASSERT_EQ(i, *value);
+    }
+    ASSERT_FALSE(buffer.TryPop(value));
+    ASSERT_EQ(0, buffer.Size());
+}
+
+TEST_F(GameKitUtilsMpscRingBufferTestFixture, TryPush_BufferFull_ReturnsFalse)
+{
+    // arrange
+    MpscRingBuffer<int> buffer(3);
+    int value = 0;
+    buffer.TryPush(1);
+    buffer.TryPush(2);
+    buffer.TryPush(3);
+
+    // act
+    bool pushedWhenFull = buffer.TryPush(4);
+    buffer.TryPop(value);
+    bool pushedAfterPop = buffer.TryPush(5);
+
+    // assert
+    ASSERT_FALSE(pushedWhenFull);
+    ASSERT_TRUE(pushedAfterPop);
+    ASSERT_EQ(3, buffer.Capacity());
+    ASSERT_EQ(3, buffer.Size());
+}
+
+TEST_F(GameKitUtilsMpscRingBufferTestFixture, TryPush_ManyProducers_ConsumerReceivesEveryValueInProducerOrder)
+{
+    // arrange
+    const int producerCount = 4;
+    const int valuesPerProducer = 10000;
+    MpscRingBuffer<int> buffer(16);
+    std::vector<std::thread> producers;
+    std::vector<int> lastSeen(producerCount, -1);
+    int received = 0;
+    bool inOrder = true;
+
+    // act
+    for (int producer = 0; producer < producerCount; producer++)
+    {
+        producers.emplace_back([&buffer, producer, valuesPerProducer]()
+        {
+            for (int i = 0; i < valuesPerProducer; i++)
+            {
+                while (!buffer.TryPush(producer * valuesPerProducer + i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    while (received < producerCount * valuesPerProducer)
+    {
+        int value = 0;
+        if (!buffer.TryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const int producer = value / valuesPerProducer;
+        const int sequence = value % valuesPerProducer;
+        inOrder = inOrder && sequence == lastSeen[producer] + 1;
+        lastSeen[producer] = sequence;
+        received++;
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    // assert
+    ASSERT_TRUE(inOrder);
+    ASSERT_EQ(0, buffer.Size());
+}
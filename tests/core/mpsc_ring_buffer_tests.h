@@ -0,0 +1,45 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GameKit
+#include "custom_test_flags.h"
+#include "test_log.h"
+#include "aws/gamekit/core/utils/mpsc_ring_buffer.h"
+
+// GTest
+#include <gtest/gtest.h>
+
+namespace GameKit
+{
+    namespace Tests
+    {
+        namespace Utils
+        {
+            class GameKitUtilsMpscRingBufferTestFixture : public ::testing::Test
+            {
+            protected:
+                typedef TestLog<GameKitUtilsMpscRingBufferTestFixture> TestLogger;
+
+            public:
+                GameKitUtilsMpscRingBufferTestFixture()
+                {}
+
+                ~GameKitUtilsMpscRingBufferTestFixture() override
+                {}
+
+                void SetUp() override
+                {
+                }
+
+                void TearDown() override
+                {
+                    TestLogger::DumpToConsoleIfTestFailed();
+                    TestLogger::Clear();
+                    TestExecutionUtils::AbortOnFailureIfEnabled();
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,265 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <cstdio>
+#include <fstream>
+
+// AWS SDK
+#include <aws/core/http/HttpResponse.h>
+
+// GameKit
+#include "custom_test_flags.h"
+#include "operation_journal_test.h"
+#include "timestamp_operation_serializer.h"
+
+using namespace GameKit::Tests::Utils;
+using namespace GameKit::Utils::HttpClient;
+using namespace GameKit::Utils::Serialization;
+
+#define JOURNAL_BIN_FILE "./operation_journal_test.dat"
+
+namespace
+{
+    std::shared_ptr<IOperation> makeOperation(long long timestamp)
+    {
+        return std::make_shared<IOperation>(OPERATION_ATTEMPTS_NO_LIMIT, false, nullptr, Aws::Http::HttpResponseCode::OK, std::chrono::milliseconds(timestamp));
+    }
+
+    std::vector<std::shared_ptr<IOperation>> reopen(FuncLogCallback logCb)
+    {
+        std::vector<std::shared_ptr<IOperation>> recovered;
+        OperationJournal journal(JOURNAL_BIN_FILE, SerializeTimestamp, DeserializeTimestamp, logCb);
+        journal.Open(recovered);
+
+        return recovered;
+    }
+}
+
+GameKitOperationJournalTestFixture::GameKitOperationJournalTestFixture()
+{}
+
+GameKitOperationJournalTestFixture::~GameKitOperationJournalTestFixture()
+{}
+
+void GameKitOperationJournalTestFixture::SetUp()
+{
+    remove(JOURNAL_BIN_FILE);
+}
+
+void GameKitOperationJournalTestFixture::TearDown()
+{
+    remove(JOURNAL_BIN_FILE);
+
+    TestLogger::DumpToConsoleIfTestFailed();
+    TestLogger::Clear();
+    TestExecutionUtils::AbortOnFailureIfEnabled();
+}
+
+TEST_F(GameKitOperationJournalTestFixture, OperationJournal_AppendAndReopen_OperationsRecoveredInOrder)
+{
+    // Arrange
+    std::vector<std::shared_ptr<IOperation>> recovered;
+    {
+        OperationJournal journal(JOURNAL_BIN_FILE, SerializeTimestamp, DeserializeTimestamp, TestLogger::Log);
+        ASSERT_TRUE(journal.Open(recovered));
+
+        // Act
+        ASSERT_TRUE(journal.Append(makeOperation(1)));
+        ASSERT_TRUE(journal.Append(makeOperation(2)));
+        ASSERT_TRUE(journal.Append(makeOperation(3)));
+    }
+
+    recovered = reopen(TestLogger::Log);
+
+    // Assert
+    ASSERT_EQ(3, recovered.size());
+    ASSERT_EQ(1, recovered[0]->Timestamp.count());
+    ASSERT_EQ(2, recovered[1]->Timestamp.count());
+    ASSERT_EQ(3, recovered[2]->Timestamp.count());
+    ASSERT_NE(0, recovered[0]->JournalSequence);
+}
+
+TEST_F(GameKitOperationJournalTestFixture, OperationJournal_AppendBatchAndReopen_OperationsRecoveredInOrderOnce)
+{
+    // Arrange
+    std::vector<std::shared_ptr<IOperation>> recovered;
+    {
+        OperationJournal journal(JOURNAL_BIN_FILE, SerializeTimestamp, DeserializeTimestamp, TestLogger::Log);
+        ASSERT_TRUE(journal.Open(recovered));
+
+        auto alreadyJournaled = makeOperation(1);
+        ASSERT_TRUE(journal.Append(alreadyJournaled));
+
+        // Act
+        ASSERT_TRUE(journal.Append(std::vector<std::shared_ptr<IOperation>>{ alreadyJournaled, makeOperation(2), makeOperation(3) }));
+    }
+
+    recovered = reopen(TestLogger::Log);
+
+    // Assert
+    ASSERT_EQ(3, recovered.size());
+    ASSERT_EQ(1, recovered[0]->Timestamp.count());
+    ASSERT_EQ(2, recovered[1]->Timestamp.count());
+    ASSERT_EQ(3, recovered[2]->Timestamp.count());
+}
+
+TEST_F(GameKitOperationJournalTestFixture, OperationJournal_RemoveAndReopen_RemovedOperationsNotRecovered)
+{
+    // Arrange
+    std::vector<std::shared_ptr<IOperation>> recovered;
+    {
+        OperationJournal journal(JOURNAL_BIN_FILE, SerializeTimestamp, DeserializeTimestamp, TestLogger::Log);
+        ASSERT_TRUE(journal.Open(recovered));
+
+        auto first = makeOperation(1);
+        auto second = makeOperation(2);
+        journal.Append(first);
+        journal.Append(second);
+
+        // Act
+        journal.Remove(first);
+    }
+
+    recovered = reopen(TestLogger::Log);
+
+    // Assert
+    ASSERT_EQ(1, recovered.size());
+    ASSERT_EQ(2, recovered[0]->Timestamp.count());
+}
+
+TEST_F(GameKitOperationJournalTestFixture, OperationJournal_Truncate_NothingRecovered)
+{
+    // Arrange
+    std::vector<std::shared_ptr<IOperation>> recovered;
+    {
+        OperationJournal journal(JOURNAL_BIN_FILE, SerializeTimestamp, DeserializeTimestamp, TestLogger::Log);
+        ASSERT_TRUE(journal.Open(recovered));
+        journal.Append(makeOperation(1));
+
+        // Act
+        journal.Truncate();
+    }
+
+    recovered = reopen(TestLogger::Log);
+
+    // Assert
+    ASSERT_EQ(0, recovered.size());
+}
+
+TEST_F(GameKitOperationJournalTestFixture, OperationJournal_TornLastRecord_PreviousOperationsRecovered)
+{
+    // Arrange
+    std::vector<std::shared_ptr<IOperation>> recovered;
+    {
+        OperationJournal journal(JOURNAL_BIN_FILE, SerializeTimestamp, DeserializeTimestamp, TestLogger::Log);
+        ASSERT_TRUE(journal.Open(recovered));
+        journal.Append(makeOperation(1));
+        journal.Append(makeOperation(2));
+    }
+
+    // Act
+    // Simulate a crash in the middle of an append by writing half of a record
+    {
+        std::ofstream os(JOURNAL_BIN_FILE, std::ios::binary | std::ios::app);
+        BinWrite(os, std::string("incomplete record"));
+        os.close();
+
+        std::ifstream is(JOURNAL_BIN_FILE, std::ios::binary | std::ios::ate);
+        std::streamoff size = is.tellg();
+        is.close();
+
+        std::string contents(static_cast<size_t>(size), '\0');
+        std::ifstream in(JOURNAL_BIN_FILE, std::ios::binary);
+        in.read(&contents[0], size);
+        in.close();
+
+        std::ofstream out(JOURNAL_BIN_FILE, std::ios::binary | std::ios::trunc);
+        out.write(contents.data(), size - 4);
+        out.close();
+    }
+
+    recovered = reopen(TestLogger::Log);
+
+    // Assert
+    ASSERT_EQ(2, recovered.size());
+    ASSERT_EQ(1, recovered[0]->Timestamp.count());
+    ASSERT_EQ(2, recovered[1]->Timestamp.count());
+}
+
+TEST_F(GameKitOperationJournalTestFixture, OperationJournal_CorruptRecord_LaterRecordsIgnored)
+{
+    // Arrange
+    std::vector<std::shared_ptr<IOperation>> recovered;
+    {
+        OperationJournal journal(JOURNAL_BIN_FILE, SerializeTimestamp, DeserializeTimestamp, TestLogger::Log);
+        ASSERT_TRUE(journal.Open(recovered));
+        journal.Append(makeOperation(1));
+        journal.Append(makeOperation(2));
+    }
+
+    // Act
+    // Flip the last byte of the second record's body, its CRC no longer matches
+    {
+        std::fstream file(JOURNAL_BIN_FILE, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
+        std::streamoff size = file.tellg();
+        file.seekg(size - sizeof(unsigned int) - 1);
+        char last = 0;
+        file.read(&last, 1);
+        last = ~last;
+        file.seekp(size - sizeof(unsigned int) - 1);
+        file.write(&last, 1);
+        file.close();
+    }
+
+    recovered = reopen(TestLogger::Log);
+
+    // Assert
+    ASSERT_EQ(1, recovered.size());
+    ASSERT_EQ(1, recovered[0]->Timestamp.count());
+}
+
+TEST_F(GameKitOperationJournalTestFixture, OperationJournal_CompactIfNeeded_LiveOperationsKept)
+{
+    // Arrange
+    std::vector<std::shared_ptr<IOperation>> recovered;
+    OperationQueue live;
+    {
+        OperationJournal journal(JOURNAL_BIN_FILE, SerializeTimestamp, DeserializeTimestamp, TestLogger::Log);
+        ASSERT_TRUE(journal.Open(recovered));
+
+        for (long long i = 1; i <= 2 * JOURNAL_COMPACTION_SLACK; ++i)
+        {
+            auto operation = makeOperation(i);
+            journal.Append(operation);
+            if (i % 10 == 0)
+            {
+                live.push_back(operation);
+            }
+            else
+            {
+                journal.Remove(operation);
+            }
+        }
+
+        // Act
+        journal.CompactIfNeeded(live);
+    }
+
+    std::ifstream is(JOURNAL_BIN_FILE, std::ios::binary | std::ios::ate);
+    std::streamoff compactedSize = is.tellg();
+    is.close();
+
+    recovered = reopen(TestLogger::Log);
+
+    // Assert
+    ASSERT_EQ(live.size(), recovered.size());
+    for (size_t i = 0; i < live.size(); ++i)
+    {
+        ASSERT_EQ(live[i]->Timestamp.count(), recovered[i]->Timestamp.count());
+    }
+
+    // Only the live operations are left, each record is a length, type, sequence, timestamp and CRC
+    const std::streamoff recordSize = sizeof(size_t) + sizeof(uint32_t) + sizeof(uint64_t) + sizeof(long long) + sizeof(unsigned int);
+    ASSERT_EQ(static_cast<std::streamoff>(live.size()) * recordSize, compactedSize);
+}
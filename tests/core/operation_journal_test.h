@@ -0,0 +1,29 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+#include <gtest/gtest.h>
+#include "aws/gamekit/core/utils/gamekit_httpclient_journal.h"
+#include "test_log.h"
+
+namespace GameKit
+{
+    namespace Tests
+    {
+        namespace Utils
+        {
+            class GameKitOperationJournalTestFixture : public ::testing::Test
+            {
+            protected:
+                typedef TestLog<GameKitOperationJournalTestFixture> TestLogger;
+
+            public:
+                GameKitOperationJournalTestFixture();
+                ~GameKitOperationJournalTestFixture();
+
+                void SetUp();
+                void TearDown();
+            };
+        }
+    }
+}
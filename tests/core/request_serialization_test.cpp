@@ -198,3 +198,63 @@ TEST_F(GameKitRequestSerializationTestFixture, HttpRequest_BinarySerializeDeseri
     ASSERT_FALSE(deserializeResult);
 }
 
+
+TEST_F(GameKitRequestSerializationTestFixture, Record_BinaryWriteRead_RecordsMatch)
+{
+    // Arrange
+    using namespace GameKit::Utils::Serialization;
+
+    std::stringstream buffer;
+    BinWriteRecord(buffer, "first record");
+    BinWriteRecord(buffer, "second record");
+    const std::string contents = buffer.str();
+
+    // Act
+    size_t offset = 0;
+    const char* record = nullptr;
+    size_t recordLength = 0;
+
+    bool firstResult = TryReadRecord(contents.data(), contents.size(), offset, record, recordLength);
+    std::string first(record, recordLength);
+
+    bool secondResult = TryReadRecord(contents.data(), contents.size(), offset, record, recordLength);
+    std::string second(record, recordLength);
+
+    bool endResult = TryReadRecord(contents.data(), contents.size(), offset, record, recordLength);
+
+    // Assert
+    ASSERT_TRUE(firstResult);
+    ASSERT_TRUE(secondResult);
+    ASSERT_FALSE(endResult);
+    ASSERT_STREQ("first record", first.c_str());
+    ASSERT_STREQ("second record", second.c_str());
+    ASSERT_EQ(contents.size(), offset);
+}
+
+TEST_F(GameKitRequestSerializationTestFixture, Record_BinaryWriteRead_TornOrCorrupt_Fail)
+{
+    // Arrange
+    using namespace GameKit::Utils::Serialization;
+
+    std::stringstream buffer;
+    BinWriteRecord(buffer, "a record");
+    const std::string contents = buffer.str();
+
+    std::string corrupt = contents;
+    corrupt[sizeof(size_t)] ^= 0x1;
+
+    // Act
+    size_t tornOffset = 0;
+    size_t corruptOffset = 0;
+    const char* record = nullptr;
+    size_t recordLength = 0;
+
+    bool tornResult = TryReadRecord(contents.data(), contents.size() - 1, tornOffset, record, recordLength);
+    bool corruptResult = TryReadRecord(corrupt.data(), corrupt.size(), corruptOffset, record, recordLength);
+
+    // Assert
+    ASSERT_FALSE(tornResult);
+    ASSERT_FALSE(corruptResult);
+    ASSERT_EQ(0, tornOffset);
+    ASSERT_EQ(0, corruptOffset);
+}
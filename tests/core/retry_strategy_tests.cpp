@@ -0,0 +1,148 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <thread>
+
+// GameKit
+#include "custom_test_flags.h"
+#include "retry_strategy_tests.h"
+
+using namespace GameKit::Tests::Utils;
+using namespace GameKit::Utils::HttpClient;
+
+namespace
+{
+    std::shared_ptr<IOperation> makeOperation(const std::string& host, unsigned int attempts)
+    {
+        auto request = std::make_shared<FakeHttpRequest>(Aws::Http::URI(("https://" + host + "/foo").c_str()), Aws::Http::HttpMethod::HTTP_POST);
+        auto operation = std::make_shared<IOperation>(OPERATION_ATTEMPTS_NO_LIMIT, false, request, Aws::Http::HttpResponseCode::OK);
+        operation->Attempts = attempts;
+
+        return operation;
+    }
+}
+
+GameKitRetryStrategyTestFixture::GameKitRetryStrategyTestFixture()
+{}
+
+GameKitRetryStrategyTestFixture::~GameKitRetryStrategyTestFixture()
+{}
+
+void GameKitRetryStrategyTestFixture::SetUp()
+{
+    testStack.Initialize();
+}
+
+void GameKitRetryStrategyTestFixture::TearDown()
+{
+    testStack.CleanupAndLog<TestLogger>();
+    TestExecutionUtils::AbortOnFailureIfEnabled();
+}
+
+TEST_F(GameKitRetryStrategyTestFixture, RetryBudgetStrategy_RetriesExhaustBudget_RetriesHeldBackAndFirstAttemptsAllowed)
+{
+    // Arrange
+    RetryBudgetStrategy strategy(std::make_shared<ConstantIntervalStrategy>(), 10, 5, 1, 0, TestLogger::Log);
+    auto retry = makeOperation("123.aws.com", 1);
+    auto firstAttempt = makeOperation("123.aws.com", 0);
+
+    // Act
+    bool firstRetryAcquired = strategy.AcquireAttempt(*retry);
+    bool secondRetryAcquired = strategy.AcquireAttempt(*retry);
+    bool thirdRetryAcquired = strategy.AcquireAttempt(*retry);
+    bool firstAttemptAcquired = strategy.AcquireAttempt(*firstAttempt);
+
+    // Assert
+    ASSERT_TRUE(firstRetryAcquired);
+    ASSERT_TRUE(secondRetryAcquired);
+    ASSERT_FALSE(thirdRetryAcquired);
+    ASSERT_TRUE(firstAttemptAcquired);
+}
+
+TEST_F(GameKitRetryStrategyTestFixture, RetryBudgetStrategy_SuccessfulAttempts_RefillBudget)
+{
+    // Arrange
+    RetryBudgetStrategy strategy(std::make_shared<ConstantIntervalStrategy>(), 5, 5, 5, 0, TestLogger::Log);
+    auto retry = makeOperation("123.aws.com", 1);
+    strategy.AcquireAttempt(*retry);
+    bool acquiredWhenExhausted = strategy.AcquireAttempt(*retry);
+
+    // Act
+    strategy.RecordAttempt(*retry, true);
+    bool acquiredAfterFailure = strategy.AcquireAttempt(*retry);
+    strategy.RecordAttempt(*retry, false);
+    bool acquiredAfterSuccess = strategy.AcquireAttempt(*retry);
+
+    // Assert
+    ASSERT_FALSE(acquiredWhenExhausted);
+    ASSERT_FALSE(acquiredAfterFailure);
+    ASSERT_TRUE(acquiredAfterSuccess);
+}
+
+TEST_F(GameKitRetryStrategyTestFixture, RetryBudgetStrategy_TimePasses_RefillsBudget)
+{
+    // Arrange
+    RetryBudgetStrategy strategy(std::make_shared<ConstantIntervalStrategy>(), 5, 5, 0, 10, TestLogger::Log);
+    auto retry = makeOperation("123.aws.com", 1);
+    strategy.AcquireAttempt(*retry);
+    bool acquiredWhenExhausted = strategy.AcquireAttempt(*retry);
+
+    // Act
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    bool acquiredAfterRefill = strategy.AcquireAttempt(*retry);
+
+    // Assert
+    ASSERT_FALSE(acquiredWhenExhausted);
+    ASSERT_TRUE(acquiredAfterRefill);
+}
+
+TEST_F(GameKitRetryStrategyTestFixture, CircuitBreakerStrategy_ConsecutiveFailures_OpensThenHalfOpensThenCloses)
+{
+    // Arrange
+    CircuitBreakerStrategy strategy(std::make_shared<ConstantIntervalStrategy>(), std::chrono::milliseconds(200), 2, TestLogger::Log);
+    auto operation = makeOperation("123.aws.com", 1);
+    auto otherHostOperation = makeOperation("456.aws.com", 1);
+
+    // Act
+    strategy.RecordAttempt(*operation, true);
+    bool acquiredBelowThreshold = strategy.AcquireAttempt(*operation);
+    strategy.RecordAttempt(*operation, true);
+    bool acquiredWhenOpen = strategy.AcquireAttempt(*operation);
+    bool otherHostAcquiredWhenOpen = strategy.AcquireAttempt(*otherHostOperation);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    bool trialAcquired = strategy.AcquireAttempt(*operation);
+    bool acquiredDuringTrial = strategy.AcquireAttempt(*operation);
+
+    strategy.RecordAttempt(*operation, false);
+    bool acquiredWhenClosed = strategy.AcquireAttempt(*operation);
+    bool acquiredAgainWhenClosed = strategy.AcquireAttempt(*operation);
+
+    // Assert
+    ASSERT_TRUE(acquiredBelowThreshold);
+    ASSERT_FALSE(acquiredWhenOpen);
+    ASSERT_TRUE(otherHostAcquiredWhenOpen);
+    ASSERT_TRUE(trialAcquired);
+    ASSERT_FALSE(acquiredDuringTrial);
+    ASSERT_TRUE(acquiredWhenClosed);
+    ASSERT_TRUE(acquiredAgainWhenClosed);
+}
+
+TEST_F(GameKitRetryStrategyTestFixture, CircuitBreakerStrategy_TrialFails_OpensAgain)
+{
+    // Arrange
+    CircuitBreakerStrategy strategy(std::make_shared<ConstantIntervalStrategy>(), std::chrono::milliseconds(200), 1, TestLogger::Log);
+    auto operation = makeOperation("123.aws.com", 1);
+    strategy.RecordAttempt(*operation, true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    bool trialAcquired = strategy.AcquireAttempt(*operation);
+
+    // Act
+    strategy.RecordAttempt(*operation, true);
+    bool acquiredAfterFailedTrial = strategy.AcquireAttempt(*operation);
+
+    // Assert
+    ASSERT_TRUE(trialAcquired);
+    ASSERT_FALSE(acquiredAfterFailedTrial);
+}
@@ -15,9 +15,9 @@ void GameKitUtilsTickerTestFixture::Test_Ticker_ExecuteCallback_Success()
 
     // act
     // the Ticker will execute every second for 4 seconds. At each tick, it will add an item
-    // to the std::vector "callBacks". All ticks will be executed, Stop() will wait for thread completion.
+    // to the std::vector "callBacks". Stop() is called half way through the fifth interval so it doesn't race the fourth tick.
     t->Start();
-    std::this_thread::sleep_for(std::chrono::seconds(4));
+    std::this_thread::sleep_for(std::chrono::seconds(4) + std::chrono::milliseconds(500));
     t->Stop();
 
     // assert
@@ -47,12 +47,12 @@ void GameKitUtilsTickerTestFixture::Test_SharedTicker_ThreadStopsAfterTickerDest
 
     // act
     sharedTicker->Start();
-    std::this_thread::sleep_for(std::chrono::seconds(2));
+    std::this_thread::sleep_for(std::chrono::seconds(2) + std::chrono::milliseconds(500));
     sharedTicker->Stop();
 
     sharedTicker.reset(CreateTicker(1, std::bind(&GameKitUtilsTickerTestFixture::MockTickCallback2, this), TestLogger::Log).release());
     sharedTicker->Start();
-    std::this_thread::sleep_for(std::chrono::seconds(3));
+    std::this_thread::sleep_for(std::chrono::seconds(3) + std::chrono::milliseconds(500));
     sharedTicker->Stop();
 
     // assert
@@ -69,10 +69,29 @@ void GameKitUtilsTickerTestFixture::Test_Ticker_StartCalledTwice_NewThreadNotSta
     t->Start();
     std::this_thread::sleep_for(std::chrono::seconds(2));
     t->Start();
-    std::this_thread::sleep_for(std::chrono::seconds(3));
+    std::this_thread::sleep_for(std::chrono::seconds(3) + std::chrono::milliseconds(500));
     t->Stop();
 
     // assert
     ASSERT_EQ(5, GetCallbacks1().size());
 }
+
+void GameKitUtilsTickerTestFixture::Test_Ticker_Stop_ReturnsBeforeIntervalEnds()
+{
+    // arrange
+    std::unique_ptr<GameKit::Utils::Ticker> t = CreateTicker(60, std::bind(&GameKitUtilsTickerTestFixture::MockTickCallback1, this), TestLogger::Log);
+
+    // act
+    // Stop() cancels the pending tick, it doesn't wait for the 60 seconds interval to end
+    t->Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto stopStart = std::chrono::steady_clock::now();
+    t->Stop();
+    auto stopDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - stopStart);
+
+    // assert
+    ASSERT_EQ(0, GetCallbacks1().size());
+    ASSERT_LT(stopDuration.count(), 1000);
+}
 #pragma endregion
@@ -51,6 +51,7 @@ namespace GameKit
                 void Test_Ticker_Abort_Success();
                 void Test_SharedTicker_ThreadStopsAfterTickerDestroyed();
                 void Test_Ticker_StartCalledTwice_NewThreadNotStarted();
+                void Test_Ticker_Stop_ReturnsBeforeIntervalEnds();
 #pragma  endregion
 
             public:
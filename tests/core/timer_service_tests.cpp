@@ -0,0 +1,250 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+// Standard Library
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+
+// GameKit
+#include "timer_service_tests.h"
+
+using namespace GameKit::Tests::Utils;
+using GameKit::Utils::TimerService;
+
+TEST_F(GameKitUtilsTimerServiceTestFixture, Schedule_CallbackReturnsTrue_RunsRepeatedly)
+{
+    // arrange
+    std::atomic<int> calls(0);
+
+    // act
+    TimerService::TimerId timerId = TimerService::GetInstance().Schedule(std::chrono::milliseconds(100), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+    {
+        calls++;
+        nextDelay = std::chrono::milliseconds(100);
+        return true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(550));
+    TimerService::GetInstance().Cancel(timerId);
+    int callsAfterCancel = calls;
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    // assert
+    ASSERT_GE(callsAfterCancel, 4);
+    ASSERT_LE(callsAfterCancel, 5);
+    ASSERT_EQ(callsAfterCancel, calls);
+}
+
+TEST_F(GameKitUtilsTimerServiceTestFixture, Schedule_CallbackReturnsFalse_RunsOnce)
+{
+    // arrange
+    std::atomic<int> calls(0);
+
+    // act
+    TimerService::GetInstance().Schedule(std::chrono::milliseconds(50), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+    {
+        calls++;
+        return false;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    // assert
+    ASSERT_EQ(1, calls);
+}
+
+TEST_F(GameKitUtilsTimerServiceTestFixture, Cancel_BeforeDeadline_CallbackNotCalled)
+{
+    // arrange
+    std::atomic<int> calls(0);
+    TimerService::TimerId timerId = TimerService::GetInstance().Schedule(std::chrono::milliseconds(200), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+    {
+        calls++;
+        return false;
+    });
+
+    // act
+    TimerService::GetInstance().Cancel(timerId);
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+
+    // assert
+    ASSERT_EQ(0, calls);
+}
+
+TEST_F(GameKitUtilsTimerServiceTestFixture, Reschedule_EarlierDeadline_CallbackReceivesElapsedTime)
+{
+    // arrange
+    std::atomic<int> calls(0);
+    std::atomic<long long> receivedSleepTime(0);
+    TimerService::TimerId timerId = TimerService::GetInstance().Schedule(std::chrono::seconds(60), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+    {
+        calls++;
+        receivedSleepTime = sleepTime.count();
+        return false;
+    });
+
+    // act
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    TimerService::GetInstance().Reschedule(timerId, std::chrono::milliseconds::zero());
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    // assert
+    ASSERT_EQ(1, calls);
+    ASSERT_GE(receivedSleepTime, 100);
+    ASSERT_LT(receivedSleepTime, 60000);
+}
+
+TEST_F(GameKitUtilsTimerServiceTestFixture, Cancel_CallbackRunning_WaitsForCallback)
+{
+    // arrange
+    std::atomic<bool> isCallbackRunning(false);
+    std::atomic<bool> isCallbackCompleted(false);
+    TimerService::TimerId timerId = TimerService::GetInstance().Schedule(std::chrono::milliseconds::zero(), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+    {
+        isCallbackRunning = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        isCallbackCompleted = true;
+        return true;
+    });
+
+    // act
+    while (!isCallbackRunning)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    TimerService::GetInstance().Cancel(timerId);
+
+    // assert
+    ASSERT_TRUE(isCallbackCompleted);
+}
+
+TEST_F(GameKitUtilsTimerServiceTestFixture, Schedule_ManyTimers_ShareExecutorThreads)
+{
+    // arrange
+    const int timerCount = 50;
+    std::mutex threadIdsMutex;
+    std::set<std::thread::id> threadIds;
+    std::atomic<int> calls(0);
+
+    // act
+    for (int i = 0; i < timerCount; ++i)
+    {
+        TimerService::GetInstance().Schedule(std::chrono::milliseconds(5 * i), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+        {
+            {
+                std::lock_guard<std::mutex> lock(threadIdsMutex);
+                threadIds.insert(std::this_thread::get_id());
+            }
+            calls++;
+            return false;
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    // assert
+    ASSERT_EQ(timerCount, calls);
+    ASSERT_LE(threadIds.size(), 4);
+}
+
+TEST_F(GameKitUtilsTimerServiceTestFixture, Schedule_CallbackBlocks_OtherTimersKeepRunning)
+{
+    // arrange
+    std::atomic<bool> isBlockingCallbackCompleted(false);
+    std::atomic<int> calls(0);
+    TimerService::TimerId blockingTimerId = TimerService::GetInstance().Schedule(std::chrono::milliseconds::zero(), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(800));
+        isBlockingCallbackCompleted = true;
+        return false;
+    });
+
+    // act
+    TimerService::TimerId timerId = TimerService::GetInstance().Schedule(std::chrono::milliseconds(50), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+    {
+        calls++;
+        nextDelay = std::chrono::milliseconds(50);
+        return true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    const bool wasBlockingCallbackCompleted = isBlockingCallbackCompleted;
+    const int callsWhileBlocked = calls;
+    TimerService::GetInstance().Cancel(timerId);
+    TimerService::GetInstance().Cancel(blockingTimerId);
+
+    // assert
+    ASSERT_FALSE(wasBlockingCallbackCompleted);
+    ASSERT_GE(callsWhileBlocked, 5);
+}
+
+TEST_F(GameKitUtilsTimerServiceTestFixture, Schedule_MoreBlockingCallbacksThanExecutors_ExtraCallbacksWait)
+{
+    // arrange
+    const int timerCount = 12;
+    std::atomic<int> runningCalls(0);
+    std::atomic<int> maxRunningCalls(0);
+    std::atomic<int> calls(0);
+
+    // act
+    for (int i = 0; i < timerCount; ++i)
+    {
+        TimerService::GetInstance().Schedule(std::chrono::milliseconds::zero(), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+        {
+            const int running = ++runningCalls;
+            int maxRunning = maxRunningCalls;
+            while (running > maxRunning && !maxRunningCalls.compare_exchange_weak(maxRunning, running))
+            {
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            runningCalls--;
+            calls++;
+            return false;
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+    // assert
+    ASSERT_EQ(timerCount, calls);
+    ASSERT_LE(maxRunningCalls, 8);
+}
+
+TEST_F(GameKitUtilsTimerServiceTestFixture, Shutdown_CallbackRunning_WaitsForCallbackAndDropsPendingTimers)
+{
+    // arrange
+    std::atomic<bool> isCallbackRunning(false);
+    std::atomic<bool> isCallbackCompleted(false);
+    std::atomic<int> pendingCalls(0);
+    TimerService::GetInstance().Schedule(std::chrono::milliseconds::zero(), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+    {
+        isCallbackRunning = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        isCallbackCompleted = true;
+        return true;
+    });
+    TimerService::GetInstance().Schedule(std::chrono::milliseconds(200), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+    {
+        pendingCalls++;
+        return false;
+    });
+
+    // act
+    while (!isCallbackRunning)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    TimerService::GetInstance().Shutdown();
+    const bool wasCallbackCompleted = isCallbackCompleted;
+
+    std::atomic<int> callsAfterShutdown(0);
+    TimerService::GetInstance().Schedule(std::chrono::milliseconds::zero(), [&](std::chrono::milliseconds sleepTime, std::chrono::milliseconds& nextDelay)
+    {
+        callsAfterShutdown++;
+        return false;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    // assert
+    ASSERT_TRUE(wasCallbackCompleted);
+    ASSERT_EQ(0, pendingCalls);
+    ASSERT_EQ(1, callsAfterShutdown);
+}
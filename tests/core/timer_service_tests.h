@@ -0,0 +1,46 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// GameKit
+#include "custom_test_flags.h"
+#include "test_log.h"
+#include "aws/gamekit/core/utils/timer_service.h"
+
+// GTest
+#include <gtest/gtest.h>
+
+namespace GameKit
+{
+    namespace Tests
+    {
+        namespace Utils
+        {
+            class GameKitUtilsTimerServiceTestFixture : public ::testing::Test
+            {
+            protected:
+                typedef TestLog<GameKitUtilsTimerServiceTestFixture> TestLogger;
+
+            public:
+                GameKitUtilsTimerServiceTestFixture()
+                {}
+
+                ~GameKitUtilsTimerServiceTestFixture() override
+                {}
+
+                void SetUp() override
+                {
+                }
+
+                void TearDown() override
+                {
+                    GameKit::Utils::TimerService::GetInstance().Shutdown();
+                    TestLogger::DumpToConsoleIfTestFailed();
+                    TestLogger::Clear();
+                    TestExecutionUtils::AbortOnFailureIfEnabled();
+                }
+            };
+        }
+    }
+}
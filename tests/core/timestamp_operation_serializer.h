@@ -0,0 +1,43 @@
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+// Standard Library
+#include <iostream>
+#include <memory>
+
+// AWS SDK
+#include <aws/core/http/HttpResponse.h>
+
+// GameKit
+#include "aws/gamekit/core/utils/gamekit_httpclient_types.h"
+
+namespace GameKit
+{
+    namespace Tests
+    {
+        namespace Utils
+        {
+            // Queue files and journals do not look into the payload, test operations are identified by their timestamp
+            inline bool SerializeTimestamp(std::ostream& os, const std::shared_ptr<GameKit::Utils::HttpClient::IOperation> operation, FuncLogCallback logCb)
+            {
+                GameKit::Utils::Serialization::BinWrite(os, operation->Timestamp.count());
+                return os.good();
+            }
+
+            inline bool DeserializeTimestamp(std::istream& is, std::shared_ptr<GameKit::Utils::HttpClient::IOperation>& outOperation, FuncLogCallback logCb)
+            {
+                long long milliseconds = 0;
+                GameKit::Utils::Serialization::BinRead(is, milliseconds);
+                if (is.fail())
+                {
+                    return false;
+                }
+
+                outOperation = std::make_shared<GameKit::Utils::HttpClient::IOperation>(OPERATION_ATTEMPTS_NO_LIMIT, false, nullptr, Aws::Http::HttpResponseCode::OK, std::chrono::milliseconds(milliseconds));
+                return true;
+            }
+        }
+    }
+}
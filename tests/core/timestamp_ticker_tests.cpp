@@ -27,4 +27,9 @@ TEST_F(GameKitUtilsSystemClockTickerTestFixture, SharedTicker_ThreadStopsAfterTi
 TEST_F(GameKitUtilsSystemClockTickerTestFixture, Ticker_StartCalledTwice_NewThreadNotStarted)
 {
     Test_Ticker_StartCalledTwice_NewThreadNotStarted();
+}
+
+TEST_F(GameKitUtilsSystemClockTickerTestFixture, Ticker_Stop_ReturnsBeforeIntervalEnds)
+{
+    Test_Ticker_Stop_ReturnsBeforeIntervalEnds();
 }
\ No newline at end of file
@@ -1,6 +1,11 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <chrono>
+#include <future>
+#include <thread>
+
 // Gtest
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -29,12 +34,14 @@ static const char* TEST_EXPECTED_SAVED_SLOT_INFORMATION_FILEPATH = "..\\core\\te
 static const char* TEST_INVALID_SAVED_SLOT_INFORMATION_FILEPATH = "..\\core\\test_data\\testFiles\\gameSavingTests\\InvalidSavedSlotInformation.json";
 static const char* TEST_NULL_SAVED_SLOT_INFORMATION_FILEPATH = "..\\core\\test_data\\testFiles\\gameSavingTests\\NullSavedSlotInformation.json";
 static const char* TEST_TEMP_FILEPATH = "..\\core\\test_data\\testFiles\\gameSavingTests\\TempFile";
+static const char* TEST_TEMP_INDEX_FILEPATH = "..\\core\\test_data\\testFiles\\gameSavingTests\\TempIndexFile";
 #else
 static const char* TEST_FAKE_PATH = "./fakePath/fakePath2/FakeFile.txt";
 static const char* TEST_EXPECTED_SAVED_SLOT_INFORMATION_FILEPATH = "../core/test_data/testFiles/gameSavingTests/ExpectedSavedSlotInformation.json";
 static const char* TEST_INVALID_SAVED_SLOT_INFORMATION_FILEPATH = "../core/test_data/testFiles/gameSavingTests/InvalidSavedSlotInformation.json";
 static const char* TEST_NULL_SAVED_SLOT_INFORMATION_FILEPATH = "../core/test_data/testFiles/gameSavingTests/NullSavedSlotInformation.json";
 static const char* TEST_TEMP_FILEPATH = "../core/test_data/testFiles/gameSavingTests/TempFile";
+static const char* TEST_TEMP_INDEX_FILEPATH = "../core/test_data/testFiles/gameSavingTests/TempIndexFile";
 #endif
 
 static const std::string APRIL_28 = "2021-04-28T16:18:23Z";
@@ -63,6 +70,10 @@ static const std::string TEST_RESPONSE_MAX_SLOTS_EXCEEDED = "{\"meta\":{\"code\"
 static const std::string TEST_RESPONSE_OTHER_BAD_REQUEST = "{\"meta\":{\"code\":\"400\",\"message\":\"Malformed Hash Size Mismatch\"},\"data\":{}}";
 static const std::string TEST_RESPONSE_MULTIPLE_ENTRIES = "{\"meta\":{},\"data\":{\"slots_metadata\":[{\"metadata\":\"" + TEST_RESPONSE_METADATA_ENCODED + "\",\"size\":\"73586489\",\"slot_name\":\"testSlot\",\"player_id\":\"testPlayer\",\"last_modified\":" + APRIL_28_EPOCH + "}," \
 "{\"metadata\":\"{'description':'level 4 complete','percentcomplete':50}\",\"size\":\"83986489\",\"slot_name\":\"testSlot2\",\"player_id\":\"testPlayer\",\"last_modified\":" + APRIL_29_EPOCH + "}]}}";
+static const std::string TEST_RESPONSE_MULTIPLE_ENTRIES_CHANGE_TOKEN = "{\"meta\":{},\"data\":{\"change_token\":\"token1\",\"slots_metadata\":[{\"metadata\":\"" + TEST_RESPONSE_METADATA_ENCODED + "\",\"size\":\"73586489\",\"slot_name\":\"testSlot\",\"player_id\":\"testPlayer\",\"last_modified\":" + APRIL_28_EPOCH + "}," \
+"{\"metadata\":\"{'description':'level 4 complete','percentcomplete':50}\",\"size\":\"83986489\",\"slot_name\":\"testSlot2\",\"player_id\":\"testPlayer\",\"last_modified\":" + APRIL_29_EPOCH + "}]}}";
+static const std::string TEST_RESPONSE_CHANGES = "{\"meta\":{},\"data\":{\"change_token\":\"token2\",\"slots_metadata\":[{\"metadata\":\"" + TEST_RESPONSE_METADATA_2_ENCODED + "\",\"size\":\"83986489\",\"slot_name\":\"testSlot2\",\"player_id\":\"testPlayer\",\"last_modified\":" + APRIL_29_EPOCH + "}]," \
+"\"deleted_slots\":[\"testSlot\"]}}";
 static const std::string TEST_RESPONSE_PAGE_1 = "{\"meta\":{},\"data\":{\"slots_metadata\":[{\"metadata\":\"" + TEST_RESPONSE_METADATA_ENCODED + "\",\"size\":\"73586489\",\"slot_name\":\"testSlot\",\"player_id\":\"testPlayer\",\"last_modified\":" + APRIL_28_EPOCH + "}]},\"paging\":{\"next_start_key\":{\"slot_name\":\"testSlot\"},\"paging_token\":\"foo\"}}";
 static const std::string TEST_RESPONSE_PAGE_2 = "{\"meta\":{},\"data\":{\"slots_metadata\":[{\"metadata\":\"" + TEST_RESPONSE_METADATA_2_ENCODED + "\",\"size\":\"83986489\",\"slot_name\":\"testSlot2\",\"player_id\":\"testPlayer\",\"last_modified\":" + APRIL_29_EPOCH + "}]},\"paging\":{\"next_start_key\":{\"slot_name\":\"testSlot2\"},\"paging_token\":\"foo\"}}";
 static const std::string TEST_RESPONSE_PAGE_LAST = "{\"meta\":{},\"data\":{\"slots_metadata\":[]}}";
@@ -102,6 +113,8 @@ void GameKitGameSavingExportsTestFixture::TearDown()
 
     remove(TEST_FAKE_PATH);
     remove(TEST_TEMP_FILEPATH);
+    remove(TEST_TEMP_INDEX_FILEPATH);
+    remove((std::string(TEST_TEMP_INDEX_FILEPATH) + ".2").c_str());
     ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
 
     testStackInitializer.CleanupAndLog<TestLogger>();
@@ -148,6 +161,7 @@ void GameKitGameSavingExportsTestFixture::SetMocks(void* instance)
 
     auto gameSaving = static_cast<GameSaving::GameSaving*>(instance);
     gameSaving->SetHttpClient(mockHttpClient);
+    gameSaving->SetTransferHttpClient(mockHttpClient);
 }
 
 bool GameKitGameSavingExportsTestFixture::HasSlot(const std::vector<GameSaving::CachedSlot>& slots, const char* slotName)
@@ -279,6 +293,101 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingInstanceRelease
     GameKitGameSavingInstanceRelease(gameSavingInstance);
 }
 
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingGetChangedSlotSyncStatuses_sends_change_token_and_applies_changes)
+{
+    // arrange
+    std::vector<Slot> testSlots;
+    testSlots.push_back({ TEST_SLOT_NAME, TEST_METADATA_LOCAL, "", TEST_SIZE_LOCAL, 0, local.Millis(), 0, last.Millis(), SlotSyncStatus::UNKNOWN });
+    testSlots.push_back({ TEST_SLOT_NAME_3, TEST_METADATA_LOCAL, "", TEST_SIZE_LOCAL, 0, local.Millis(), 0, last.Millis(), SlotSyncStatus::UNKNOWN });
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(testSlots.data(), 2);
+    SetMocks(gameSavingInstance);
+
+    std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
+    testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse->SetResponseBody(TEST_RESPONSE_MULTIPLE_ENTRIES_CHANGE_TOKEN);
+
+    std::shared_ptr<FakeHttpResponse> testResponse2 = std::make_shared<FakeHttpResponse>();
+    testResponse2->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse2->SetResponseBody(TEST_RESPONSE_CHANGES);
+
+    std::vector<std::string> requestUris;
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(DoAll(Invoke([&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                requestUris.push_back(std::string(request->GetURIString().c_str()));
+            }), Return(testResponse)))
+        .WillOnce(DoAll(Invoke([&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                requestUris.push_back(std::string(request->GetURIString().c_str()));
+            }), Return(testResponse2)));
+
+    Dispatcher dispatcher;
+    Dispatcher changesDispatcher;
+
+    // act
+    const unsigned int response = GameKitGetChangedSlotSyncStatuses(gameSavingInstance, &dispatcher, slotCallback, true, 0);
+    const unsigned int changesResponse = GameKitGetChangedSlotSyncStatuses(gameSavingInstance, &changesDispatcher, slotCallback, true, 0);
+
+    // assert
+    ASSERT_EQ(response, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(changesResponse, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(2, requestUris.size());
+    ASSERT_EQ(std::string::npos, requestUris[0].find("change_token"));
+    ASSERT_NE(std::string::npos, requestUris[1].find("change_token=token1"));
+
+    ASSERT_EQ(3, changesDispatcher.syncedSlots.size());
+    ASSERT_EQ(SlotSyncStatus::SHOULD_UPLOAD_LOCAL, GetSlot(changesDispatcher.syncedSlots, TEST_SLOT_NAME).slotSyncStatus);
+    ASSERT_EQ(TEST_RESPONSE_METATADA_2_DECODED, GetSlot(changesDispatcher.syncedSlots, TEST_SLOT_NAME_2).metadataCloud);
+    ASSERT_EQ(SlotSyncStatus::SHOULD_UPLOAD_LOCAL, GetSlot(changesDispatcher.syncedSlots, TEST_SLOT_NAME_3).slotSyncStatus);
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingGetChangedSlotSyncStatuses_cleared_during_listing_drops_change_token)
+{
+    // arrange
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance();
+    SetMocks(gameSavingInstance);
+
+    std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
+    testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse->SetResponseBody(TEST_RESPONSE_MULTIPLE_ENTRIES_CHANGE_TOKEN);
+
+    std::shared_ptr<FakeHttpResponse> testResponse2 = std::make_shared<FakeHttpResponse>();
+    testResponse2->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse2->SetResponseBody(TEST_RESPONSE_MULTIPLE_ENTRIES_CHANGE_TOKEN);
+
+    // the cached slots are cleared for a new player while the first listing is in flight
+    std::vector<std::string> requestUris;
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(DoAll(Invoke([&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                requestUris.push_back(std::string(request->GetURIString().c_str()));
+                GameKitClearSyncedSlots(gameSavingInstance);
+            }), Return(testResponse)))
+        .WillOnce(DoAll(Invoke([&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                requestUris.push_back(std::string(request->GetURIString().c_str()));
+            }), Return(testResponse2)));
+
+    Dispatcher dispatcher;
+    Dispatcher changesDispatcher;
+
+    // act
+    const unsigned int response = GameKitGetChangedSlotSyncStatuses(gameSavingInstance, &dispatcher, slotCallback, true, 0);
+    const unsigned int changesResponse = GameKitGetChangedSlotSyncStatuses(gameSavingInstance, &changesDispatcher, slotCallback, true, 0);
+
+    // assert
+    ASSERT_EQ(response, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(changesResponse, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(2, requestUris.size());
+    ASSERT_EQ(std::string::npos, requestUris[0].find("change_token"));
+    ASSERT_EQ(std::string::npos, requestUris[1].find("change_token"));
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
 TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingGetAllSlotSyncStatuses_success)
 {
     // arrange
@@ -920,6 +1029,122 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingGetSlotSyncStat
     GameKitGameSavingInstanceRelease(gameSavingInstance);
 }
 
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingGetSlotSyncStatus_other_slot_not_blocked_by_request_in_flight)
+{
+    // arrange
+    Slot testSlots[] = {
+        { TEST_SLOT_NAME, TEST_METADATA_LOCAL, "", TEST_SIZE_LOCAL, 0, local.Millis(), 0, last.Millis(), SlotSyncStatus::UNKNOWN },
+        { "otherSlot", TEST_METADATA_LOCAL, "", TEST_SIZE_LOCAL, 0, local.Millis(), 0, last.Millis(), SlotSyncStatus::UNKNOWN }
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(testSlots, 2);
+    SetMocks(gameSavingInstance);
+
+    std::promise<void> firstRequestStarted;
+    std::promise<void> otherSlotDone;
+    std::shared_future<void> otherSlotDoneFuture = otherSlotDone.get_future().share();
+    bool otherSlotDoneWhileBlocked = false;
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _)).Times(2).WillRepeatedly(Invoke(
+        [&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*) -> std::shared_ptr<Aws::Http::HttpResponse>
+        {
+            if (request->GetURIString().find("otherSlot") == std::string::npos)
+            {
+                // Hold the first slot's request until the other slot's call has returned
+                firstRequestStarted.set_value();
+                otherSlotDoneWhileBlocked = otherSlotDoneFuture.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+            }
+
+            std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
+            testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+            testResponse->SetResponseBody(TEST_RESPONSE);
+            return testResponse;
+        }));
+
+    Dispatcher dispatcher;
+    Dispatcher otherDispatcher;
+
+    // act
+    unsigned int response = GameKit::GAMEKIT_ERROR_GENERAL;
+    std::thread firstCall([&]()
+    {
+        response = GameKitGetSlotSyncStatus(gameSavingInstance, &dispatcher, slotActionCallback, TEST_SLOT_NAME);
+    });
+
+    firstRequestStarted.get_future().wait();
+    const unsigned int otherResponse = GameKitGetSlotSyncStatus(gameSavingInstance, &otherDispatcher, slotActionCallback, "otherSlot");
+    otherSlotDone.set_value();
+    firstCall.join();
+
+    // assert
+    ASSERT_TRUE(otherSlotDoneWhileBlocked);
+    ASSERT_EQ(response, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(otherResponse, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(0, strcmp(TEST_SLOT_NAME, dispatcher.slot.slotName.c_str()));
+    ASSERT_EQ(0, strcmp("otherSlot", otherDispatcher.slot.slotName.c_str()));
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingGetAllSlotSyncStatuses_waits_for_slot_request_in_flight)
+{
+    // arrange
+    Slot testSlot = { TEST_SLOT_NAME, TEST_METADATA_LOCAL, "", TEST_SIZE_LOCAL, 0, local.Millis(), 0, last.Millis(), SlotSyncStatus::UNKNOWN };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::promise<void> slotRequestStarted;
+    std::promise<void> listingDone;
+    std::shared_future<void> listingDoneFuture = listingDone.get_future().share();
+    bool listingDoneWhileBlocked = true;
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _)).Times(2).WillRepeatedly(Invoke(
+        [&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*) -> std::shared_ptr<Aws::Http::HttpResponse>
+        {
+            std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
+            testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+            if (request->GetURIString().find(TEST_SLOT_NAME) != std::string::npos)
+            {
+                // Hold the slot's request, the listing must not merge the slot until the slot's call has returned
+                slotRequestStarted.set_value();
+                listingDoneWhileBlocked = listingDoneFuture.wait_for(std::chrono::milliseconds(200)) == std::future_status::ready;
+                testResponse->SetResponseBody(TEST_RESPONSE);
+            }
+            else
+            {
+                testResponse->SetResponseBody(TEST_RESPONSE_MULTIPLE_ENTRIES);
+            }
+
+            return testResponse;
+        }));
+
+    Dispatcher dispatcher;
+    Dispatcher listingDispatcher;
+
+    // act
+    unsigned int response = GameKit::GAMEKIT_ERROR_GENERAL;
+    std::thread slotCall([&]()
+    {
+        response = GameKitGetSlotSyncStatus(gameSavingInstance, &dispatcher, slotActionCallback, TEST_SLOT_NAME);
+    });
+
+    slotRequestStarted.get_future().wait();
+    const unsigned int listingResponse = GameKitGetAllSlotSyncStatuses(gameSavingInstance, &listingDispatcher, slotCallback, true, 0);
+    listingDone.set_value();
+    slotCall.join();
+
+    // assert
+    ASSERT_FALSE(listingDoneWhileBlocked);
+    ASSERT_EQ(response, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(listingResponse, GameKit::GAMEKIT_SUCCESS);
+    const auto& syncedSlots = static_cast<GameSaving::GameSaving*>(gameSavingInstance)->GetSyncedSlots();
+    ASSERT_EQ(2, syncedSlots.size());
+    ASSERT_EQ(std::stoll(APRIL_28_EPOCH), syncedSlots.at(TEST_SLOT_NAME).lastModifiedCloud.Millis());
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
 TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_success)
 {
     // arrange
@@ -988,7 +1213,7 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_succes
     GameKitGameSavingInstanceRelease(gameSavingInstance);
 }
 
-TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_s3_upload_failed)
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_slot_metadata_index_updated_and_reloaded)
 {
     // arrange
     last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
@@ -1008,7 +1233,6 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_s3_upl
     SetMocks(gameSavingInstance);
 
     std::string testBuffer = "I'm a test buffer";
-
     const GameSavingModel testModel = {
         TEST_SLOT_NAME,
         TEST_METADATA_LOCAL,
@@ -1016,7 +1240,7 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_s3_upl
         false, // override sync
         (uint8_t*)testBuffer.data(),
         (unsigned int)testBuffer.size(),
-        TEST_TEMP_FILEPATH, // local slot info file path
+        TEST_TEMP_FILEPATH, // local slot info file path, unused with an index
     };
 
     std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
@@ -1028,58 +1252,53 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_s3_upl
     testResponse2->SetResponseBody(TEST_RESPONSE_PUT_URL);
 
     std::shared_ptr<FakeHttpResponse> testResponse3 = std::make_shared<FakeHttpResponse>();
-    testResponse3->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(403));
+    testResponse3->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
 
-    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _)).WillOnce(Return(testResponse)).WillOnce(Return(testResponse2)).WillOnce(Return(testResponse3));
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(testResponse))
+        .WillOnce(Return(testResponse2))
+        .WillOnce(Return(testResponse3));
 
     Dispatcher dispatcher;
 
     // act
+    const unsigned int newIndexResponse = GameKitSetSlotMetadataIndex(gameSavingInstance, TEST_TEMP_INDEX_FILEPATH);
     const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
 
+    GameKitClearSyncedSlots(gameSavingInstance);
+    const unsigned int reloadResponse = GameKitSetSlotMetadataIndex(gameSavingInstance, TEST_TEMP_INDEX_FILEPATH);
+
     // assert
-    AssertCallFailed(GameKit::GAMEKIT_ERROR_HTTP_REQUEST_FAILED, response, dispatcher);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, newIndexResponse);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, response);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, reloadResponse);
+    ASSERT_FALSE(boost::filesystem::exists(TEST_TEMP_FILEPATH));
+
+    const auto& syncedSlots = static_cast<GameSaving::GameSaving*>(gameSavingInstance)->GetSyncedSlots();
+    ASSERT_EQ(1, syncedSlots.size());
+    const CachedSlot& reloadedSlot = syncedSlots.at(TEST_SLOT_NAME);
+    AssertEqual(dispatcher.slot, reloadedSlot);
 
     GameKitGameSavingInstanceRelease(gameSavingInstance);
 }
 
-TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_missing_token)
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSetSlotMetadataIndex_torn_write_falls_back_to_other_copy)
 {
     // arrange
-    const unsigned int expectedSlotCount = 0;
-    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(nullptr, expectedSlotCount);
-    SetMocks(gameSavingInstance);
-    sessionManager->DeleteToken(GameKit::TokenType::IdToken);
-
-    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _)).Times(0);
-
-    const GameSavingModel testModel = {
+    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
+    Slot testSlot = {
         TEST_SLOT_NAME,
         TEST_METADATA_LOCAL,
-        0, // epoch time
-        false, // override sync
-        nullptr,
-        0,
-        TEST_TEMP_FILEPATH, // local slot info file path
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is updated from the response
+        local.Millis(),
+        0, // cloud time is update from the response
+        last.Millis(),
+        SlotSyncStatus::UNKNOWN
     };
 
-    Dispatcher dispatcher;
-
-    // act
-    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
-
-    // assert
-    AssertCallFailed(GameKit::GAMEKIT_ERROR_NO_ID_TOKEN, response, dispatcher, expectedSlotCount);
-    ASSERT_FALSE(boost::filesystem::exists(TEST_TEMP_FILEPATH));
-
-    GameKitGameSavingInstanceRelease(gameSavingInstance);
-}
-
-TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_slot_not_found)
-{
-    // arrange
-    const unsigned int expectedSlotCount = 0;
-    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(nullptr, expectedSlotCount);
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
     SetMocks(gameSavingInstance);
 
     std::string testBuffer = "I'm a test buffer";
@@ -1090,12 +1309,12 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_slot_n
         false, // override sync
         (uint8_t*)testBuffer.data(),
         (unsigned int)testBuffer.size(),
-        TEST_TEMP_FILEPATH, // local slot info file path
+        TEST_TEMP_FILEPATH, // local slot info file path, unused with an index
     };
 
     std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
     testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
-    testResponse->SetResponseBody(TEST_RESPONSE_NO_ENTRY);
+    testResponse->SetResponseBody(TEST_RESPONSE_OLD_CLOUD_TIME);
 
     std::shared_ptr<FakeHttpResponse> testResponse2 = std::make_shared<FakeHttpResponse>();
     testResponse2->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
@@ -1103,130 +1322,198 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_slot_n
 
     std::shared_ptr<FakeHttpResponse> testResponse3 = std::make_shared<FakeHttpResponse>();
     testResponse3->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+
     EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
         .WillOnce(Return(testResponse))
         .WillOnce(Return(testResponse2))
         .WillOnce(Return(testResponse3));
 
+    // The new index holds the cached slot, then the save writes the slot before and after uploading it, alternating between the copies
+    const unsigned int newIndexResponse = GameKitSetSlotMetadataIndex(gameSavingInstance, TEST_TEMP_INDEX_FILEPATH);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, newIndexResponse);
+
     Dispatcher dispatcher;
+    const unsigned int saveResponse = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, saveResponse);
+
+    // A crash cut the last write, the one after the upload, short
+    std::string index;
+    GameKit::Utils::FileUtils::ReadFileIntoString(TEST_TEMP_INDEX_FILEPATH, index);
+    index.resize(index.size() / 2);
+    GameKit::Utils::FileUtils::WriteStringToFile(index, TEST_TEMP_INDEX_FILEPATH);
 
     // act
-    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+    GameKitClearSyncedSlots(gameSavingInstance);
+    const unsigned int response = GameKitSetSlotMetadataIndex(gameSavingInstance, TEST_TEMP_INDEX_FILEPATH);
 
     // assert
-    ASSERT_EQ(response, GameKit::GAMEKIT_SUCCESS);
-    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_SUCCESS);
-    ASSERT_EQ(1, dispatcher.slotCount);
-    ASSERT_EQ(1, dispatcher.syncedSlots.size());
-    ASSERT_EQ(dispatcher.slot.metadataCloud, dispatcher.slot.metadataLocal);
-    ASSERT_EQ(dispatcher.slot.sizeCloud, dispatcher.slot.sizeLocal);
-    ASSERT_EQ(dispatcher.slot.lastModifiedCloud, dispatcher.slot.lastModifiedLocal);
-    ASSERT_EQ(dispatcher.slot.lastSync, dispatcher.slot.lastModifiedLocal);
-    ASSERT_EQ(SlotSyncStatus::SYNCED, dispatcher.slot.slotSyncStatus);
-    AssertSlotInfoEqual(dispatcher.slot, TEST_TEMP_FILEPATH);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, response);
+    const auto& syncedSlots = static_cast<GameSaving::GameSaving*>(gameSavingInstance)->GetSyncedSlots();
+    ASSERT_EQ(1, syncedSlots.size());
+    const CachedSlot& reloadedSlot = syncedSlots.at(TEST_SLOT_NAME);
+
+    // the slot as it was written before the upload
+    ASSERT_EQ(testBuffer.size(), reloadedSlot.sizeLocal);
+    ASSERT_EQ(last.Millis(), reloadedSlot.lastSync.Millis());
+    ASSERT_NE(last.Millis(), dispatcher.slot.lastSync.Millis());
 
-    // teardown
-    remove(TEST_TEMP_FILEPATH);
     GameKitGameSavingInstanceRelease(gameSavingInstance);
 }
 
-TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_malformed_slot_name)
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSetSlotMetadataIndex_corrupt_record_dropped)
 {
     // arrange
-    const unsigned int expectedSlotCount = 0;
-    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(nullptr, expectedSlotCount);
+    Slot testSlots[] = {
+        { TEST_SLOT_NAME, TEST_METADATA_LOCAL, TEST_METADATA_CLOUD, TEST_SIZE_LOCAL, TEST_SIZE_CLOUD, local.Millis(), cloud.Millis(), last.Millis(), SlotSyncStatus::SYNCED },
+        { TEST_SLOT_NAME_2, TEST_METADATA_LOCAL, TEST_METADATA_CLOUD, TEST_SIZE_LOCAL, TEST_SIZE_CLOUD, local.Millis(), cloud.Millis(), last.Millis(), SlotSyncStatus::SYNCED }
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(testSlots, 2);
     SetMocks(gameSavingInstance);
 
-    const GameSavingModel testModel = {
-        TEST_MALFORMED_SLOT_NAME,
-        TEST_METADATA_LOCAL,
-        0, // epoch time
-        false, // override sync
-        nullptr,
-        0,
-        TEST_TEMP_FILEPATH, // local slot info file path
-    };
+    // The cached slots are written to the new index in slot name order, so the last byte of the file belongs to TEST_SLOT_NAME_2's record
+    const unsigned int newIndexResponse = GameKitSetSlotMetadataIndex(gameSavingInstance, TEST_TEMP_INDEX_FILEPATH);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, newIndexResponse);
 
-    Dispatcher dispatcher;
+    std::string index;
+    GameKit::Utils::FileUtils::ReadFileIntoString(TEST_TEMP_INDEX_FILEPATH, index);
+    index.back() ^= 0x5A;
+    GameKit::Utils::FileUtils::WriteStringToFile(index, TEST_TEMP_INDEX_FILEPATH);
 
     // act
-    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+    GameKitClearSyncedSlots(gameSavingInstance);
+    const unsigned int response = GameKitSetSlotMetadataIndex(gameSavingInstance, TEST_TEMP_INDEX_FILEPATH);
 
     // assert
-    AssertCallFailed(GameKit::GAMEKIT_ERROR_GAME_SAVING_MALFORMED_SLOT_NAME, response, dispatcher, expectedSlotCount);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, response);
+    const auto& syncedSlots = static_cast<GameSaving::GameSaving*>(gameSavingInstance)->GetSyncedSlots();
+    ASSERT_EQ(1, syncedSlots.size());
+    ASSERT_EQ(1, syncedSlots.count(TEST_SLOT_NAME));
 
     GameKitGameSavingInstanceRelease(gameSavingInstance);
 }
 
-TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_metadata_too_long)
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_conditional_write_sends_precondition_with_upload)
 {
     // arrange
-    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
     Slot testSlot = {
         TEST_SLOT_NAME,
         TEST_METADATA_LOCAL,
-        "", // cloud metadata is updated from the response
+        "",
         TEST_SIZE_LOCAL,
-        0, // cloud size is updated from the response
-        local.Millis(),
-        0, // cloud time is update from the response
+        0,
         last.Millis(),
-        SlotSyncStatus::UNKNOWN
+        0, // no cloud slot yet
+        0,
+        SlotSyncStatus::SHOULD_UPLOAD_LOCAL
     };
 
     GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
     SetMocks(gameSavingInstance);
 
-    std::vector<char> metadata(TEST_MAX_METADATA_BYTES + 1, 'a');
-    metadata.push_back('\n');
-    const GameSavingModel testModel = {
+    std::string testBuffer = "I'm a test buffer";
+    GameSavingModel testModel = {
         TEST_SLOT_NAME,
-        metadata.data(),
+        TEST_METADATA_LOCAL,
         0, // epoch time
         false, // override sync
-        nullptr,
-        0,
+        (uint8_t*)testBuffer.data(),
+        (unsigned int)testBuffer.size(),
         TEST_TEMP_FILEPATH, // local slot info file path
     };
+    testModel.conditionalWrite = true;
 
-    std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
-    testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
-    testResponse->SetResponseBody(TEST_RESPONSE_OLD_CLOUD_TIME);
+    std::shared_ptr<FakeHttpResponse> putUrlResponse = std::make_shared<FakeHttpResponse>();
+    putUrlResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    putUrlResponse->SetResponseBody(TEST_RESPONSE_PUT_URL);
 
-    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _)).WillOnce(Return(testResponse));
+    Aws::String expectedCloudEpochTime;
+    auto recordPutUrlRequest = [&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+    {
+        expectedCloudEpochTime = request->GetHeaderValue("expected_last_modified_epoch_time");
+        return putUrlResponse;
+    };
+
+    std::shared_ptr<FakeHttpResponse> firstPutResponse = std::make_shared<FakeHttpResponse>();
+    firstPutResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    firstPutResponse->AddHeader("etag", "\"first-etag\"");
+
+    std::shared_ptr<FakeHttpResponse> secondPutResponse = std::make_shared<FakeHttpResponse>();
+    secondPutResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    secondPutResponse->AddHeader("etag", "\"second-etag\"");
+
+    std::vector<std::pair<std::string, std::string>> putPreconditions;
+    auto recordPutRequest = [&](std::shared_ptr<FakeHttpResponse> putResponse)
+    {
+        return [&, putResponse](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+        {
+            putPreconditions.push_back({
+                request->HasHeader("if-match") ? request->GetHeaderValue("if-match").c_str() : "",
+                request->HasHeader("if-none-match") ? request->GetHeaderValue("if-none-match").c_str() : "" });
+            return std::static_pointer_cast<Aws::Http::HttpResponse>(putResponse);
+        };
+    };
+
+    // no sync status request, each save is the upload url request and the upload itself
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(recordPutUrlRequest)
+        .WillOnce(recordPutRequest(firstPutResponse))
+        .WillOnce(recordPutUrlRequest)
+        .WillOnce(recordPutRequest(secondPutResponse));
 
     Dispatcher dispatcher;
 
     // act
-    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+    const unsigned int firstResponse = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+    const Aws::String firstExpectedCloudEpochTime = expectedCloudEpochTime;
+    const int64_t firstUploadTime = dispatcher.slot.lastModifiedLocal;
+    const unsigned int secondResponse = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
 
     // assert
-    AssertCallFailed(GameKit::GAMEKIT_ERROR_GAME_SAVING_EXCEEDED_MAX_SIZE, response, dispatcher);
+    ASSERT_EQ(firstResponse, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(secondResponse, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_SUCCESS);
 
+    // the first upload requires that no cloud save file exists, the second one that it is still the first upload
+    ASSERT_EQ(2, putPreconditions.size());
+    ASSERT_EQ(std::make_pair(std::string(), std::string("*")), putPreconditions[0]);
+    ASSERT_EQ(std::make_pair(std::string("\"first-etag\""), std::string()), putPreconditions[1]);
+    ASSERT_STREQ("0", firstExpectedCloudEpochTime.c_str());
+    ASSERT_EQ(std::to_string(firstUploadTime), std::string(expectedCloudEpochTime.c_str()));
+
+    ASSERT_EQ(dispatcher.slot.lastModifiedCloud, dispatcher.slot.lastModifiedLocal);
+    ASSERT_EQ(dispatcher.slot.lastSync, dispatcher.slot.lastModifiedLocal);
+    ASSERT_EQ(SlotSyncStatus::SYNCED, dispatcher.slot.slotSyncStatus);
+    AssertSlotInfoEqual(dispatcher.slot, TEST_TEMP_FILEPATH);
+
+    const CachedSlot& slot = static_cast<GameKit::GameSaving::GameSaving*>(gameSavingInstance)->GetSyncedSlots().at(TEST_SLOT_NAME);
+    ASSERT_EQ("\"second-etag\"", slot.cloudETag);
+
+    // teardown
+    remove(TEST_TEMP_FILEPATH);
     GameKitGameSavingInstanceRelease(gameSavingInstance);
 }
 
-TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_max_slots_exceeded)
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_conditional_write_s3_refuses_upload)
 {
     // arrange
-    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
     Slot testSlot = {
         TEST_SLOT_NAME,
         TEST_METADATA_LOCAL,
-        "", // cloud metadata is updated from the response
+        "",
         TEST_SIZE_LOCAL,
-        0, // cloud size is updated from the response
-        local.Millis(),
-        0, // cloud time is update from the response
+        0,
         last.Millis(),
-        SlotSyncStatus::UNKNOWN
+        0, // no cloud slot known to this device
+        0,
+        SlotSyncStatus::SHOULD_UPLOAD_LOCAL
     };
 
     GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
     SetMocks(gameSavingInstance);
 
     std::string testBuffer = "I'm a test buffer";
-    const GameSavingModel testModel = {
+    GameSavingModel testModel = {
         TEST_SLOT_NAME,
         TEST_METADATA_LOCAL,
         0, // epoch time
@@ -1235,12 +1522,19 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_max_sl
         (unsigned int)testBuffer.size(),
         TEST_TEMP_FILEPATH, // local slot info file path
     };
+    testModel.conditionalWrite = true;
 
-    std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
-    testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(400));
-    testResponse->SetResponseBody(TEST_RESPONSE_MAX_SLOTS_EXCEEDED);
+    std::shared_ptr<FakeHttpResponse> putUrlResponse = std::make_shared<FakeHttpResponse>();
+    putUrlResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    putUrlResponse->SetResponseBody(TEST_RESPONSE_PUT_URL);
 
-    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _)).WillOnce(Return(testResponse));
+    // another device uploaded the slot first
+    std::shared_ptr<FakeHttpResponse> putResponse = std::make_shared<FakeHttpResponse>();
+    putResponse->SetResponseCode(Aws::Http::HttpResponseCode::PRECONDITION_FAILED);
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(putUrlResponse))
+        .WillOnce(Return(putResponse));
 
     Dispatcher dispatcher;
 
@@ -1248,19 +1542,608 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_max_sl
     const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
 
     // assert
-    AssertCallFailed(GameKit::GAMEKIT_ERROR_GAME_SAVING_MAX_CLOUD_SLOTS_EXCEEDED, response, dispatcher);
+    ASSERT_EQ(response, GameKit::GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT);
+    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT);
 
+    // the new local save is still tracked
+    const CachedSlot& slot = static_cast<GameKit::GameSaving::GameSaving*>(gameSavingInstance)->GetSyncedSlots().at(TEST_SLOT_NAME);
+    ASSERT_EQ(SlotSyncStatus::IN_CONFLICT, slot.slotSyncStatus);
+    ASSERT_GT(slot.lastModifiedLocal.Millis(), slot.lastSync.Millis());
+    AssertSlotInfoEqual(slot, TEST_TEMP_FILEPATH);
+
+    // teardown
+    remove(TEST_TEMP_FILEPATH);
     GameKitGameSavingInstanceRelease(gameSavingInstance);
 }
 
-TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_other_bad_request)
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_conditional_write_backend_refuses)
 {
     // arrange
-    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
     Slot testSlot = {
         TEST_SLOT_NAME,
         TEST_METADATA_LOCAL,
-        "", // cloud metadata is updated from the response
+        TEST_METADATA_LOCAL,
+        TEST_SIZE_LOCAL,
+        TEST_SIZE_LOCAL,
+        last.Millis(),
+        last.Millis(),
+        last.Millis(),
+        SlotSyncStatus::SYNCED
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::string testBuffer = "I'm a test buffer";
+    GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        (uint8_t*)testBuffer.data(),
+        (unsigned int)testBuffer.size(),
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+    testModel.conditionalWrite = true;
+
+    // the cloud save file was never transferred by this device so its ETag is not known, the sync status is fetched first
+    std::shared_ptr<FakeHttpResponse> statusResponse = std::make_shared<FakeHttpResponse>();
+    statusResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    statusResponse->SetResponseBody(TEST_RESPONSE);
+
+    // the cloud slot was uploaded from another device after its sync status was fetched
+    std::shared_ptr<FakeHttpResponse> putUrlResponse = std::make_shared<FakeHttpResponse>();
+    putUrlResponse->SetResponseCode(Aws::Http::HttpResponseCode::PRECONDITION_FAILED);
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(statusResponse))
+        .WillOnce(Return(putUrlResponse));
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+
+    // assert
+    ASSERT_EQ(response, GameKit::GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT);
+    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT);
+
+    // the new local save is still tracked
+    const CachedSlot& slot = static_cast<GameKit::GameSaving::GameSaving*>(gameSavingInstance)->GetSyncedSlots().at(TEST_SLOT_NAME);
+    ASSERT_EQ(SlotSyncStatus::IN_CONFLICT, slot.slotSyncStatus);
+    ASSERT_GT(slot.lastModifiedLocal.Millis(), slot.lastSync.Millis());
+    AssertSlotInfoEqual(slot, TEST_TEMP_FILEPATH);
+
+    // teardown
+    remove(TEST_TEMP_FILEPATH);
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_conditional_write_cloud_changed)
+{
+    // arrange
+    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        TEST_METADATA_LOCAL,
+        TEST_SIZE_LOCAL,
+        TEST_SIZE_LOCAL,
+        last.Millis(),
+        last.Millis(),
+        last.Millis(),
+        SlotSyncStatus::SYNCED
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::string testBuffer = "I'm a test buffer";
+    GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        (uint8_t*)testBuffer.data(),
+        (unsigned int)testBuffer.size(),
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+    testModel.conditionalWrite = true;
+
+    // the sync status shows the cloud slot was uploaded from another device since it was last synced here
+    std::shared_ptr<FakeHttpResponse> statusResponse = std::make_shared<FakeHttpResponse>();
+    statusResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    statusResponse->SetResponseBody(TEST_RESPONSE);
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(statusResponse));
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+
+    // assert
+    ASSERT_EQ(response, GameKit::GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT);
+    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_ERROR_GAME_SAVING_SYNC_CONFLICT);
+
+    // the new local save is still tracked
+    const CachedSlot& slot = static_cast<GameKit::GameSaving::GameSaving*>(gameSavingInstance)->GetSyncedSlots().at(TEST_SLOT_NAME);
+    ASSERT_EQ(SlotSyncStatus::IN_CONFLICT, slot.slotSyncStatus);
+    AssertSlotInfoEqual(slot, TEST_TEMP_FILEPATH);
+
+    // teardown
+    remove(TEST_TEMP_FILEPATH);
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_s3_upload_failed)
+{
+    // arrange
+    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is updated from the response
+        local.Millis(),
+        0, // cloud time is update from the response
+        last.Millis(),
+        SlotSyncStatus::UNKNOWN
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::string testBuffer = "I'm a test buffer";
+
+    const GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        (uint8_t*)testBuffer.data(),
+        (unsigned int)testBuffer.size(),
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
+    testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse->SetResponseBody(TEST_RESPONSE_OLD_CLOUD_TIME);
+
+    std::shared_ptr<FakeHttpResponse> testResponse2 = std::make_shared<FakeHttpResponse>();
+    testResponse2->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse2->SetResponseBody(TEST_RESPONSE_PUT_URL);
+
+    std::shared_ptr<FakeHttpResponse> testResponse3 = std::make_shared<FakeHttpResponse>();
+    testResponse3->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(403));
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _)).WillOnce(Return(testResponse)).WillOnce(Return(testResponse2)).WillOnce(Return(testResponse3));
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+
+    // assert
+    AssertCallFailed(GameKit::GAMEKIT_ERROR_HTTP_REQUEST_FAILED, response, dispatcher);
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_s3_upload_transient_failure_retried)
+{
+    // arrange
+    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is updated from the response
+        local.Millis(),
+        0, // cloud time is update from the response
+        last.Millis(),
+        SlotSyncStatus::UNKNOWN
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::string testBuffer = "I'm a test buffer";
+    const GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        (uint8_t*)testBuffer.data(),
+        (unsigned int)testBuffer.size(),
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
+    testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse->SetResponseBody(TEST_RESPONSE_OLD_CLOUD_TIME);
+
+    std::shared_ptr<FakeHttpResponse> testResponse2 = std::make_shared<FakeHttpResponse>();
+    testResponse2->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse2->SetResponseBody(TEST_RESPONSE_PUT_URL);
+
+    std::shared_ptr<FakeHttpResponse> testResponse3 = std::make_shared<FakeHttpResponse>();
+    testResponse3->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(503));
+
+    std::shared_ptr<FakeHttpResponse> testResponse4 = std::make_shared<FakeHttpResponse>();
+    testResponse4->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+
+    // the second upload attempt sends the whole buffer again
+    std::vector<std::string> uploadedBodies;
+    auto recordUpload = [&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+    {
+        uploadedBodies.push_back(std::string(std::istreambuf_iterator<char>(*request->GetContentBody()), std::istreambuf_iterator<char>()));
+        return uploadedBodies.size() == 1 ? testResponse3 : testResponse4;
+    };
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(testResponse))
+        .WillOnce(Return(testResponse2))
+        .WillOnce(recordUpload)
+        .WillOnce(recordUpload);
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+
+    // assert
+    ASSERT_EQ(response, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(SlotSyncStatus::SYNCED, dispatcher.slot.slotSyncStatus);
+    ASSERT_EQ(2, uploadedBodies.size());
+    ASSERT_EQ(testBuffer, uploadedBodies[0]);
+    ASSERT_EQ(testBuffer, uploadedBodies[1]);
+
+    // teardown
+    remove(TEST_TEMP_FILEPATH);
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_compressed_then_LoadSlot_decompressed)
+{
+    // arrange
+    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is updated from the response
+        local.Millis(),
+        0, // cloud time is update from the response
+        last.Millis(),
+        SlotSyncStatus::UNKNOWN
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::string testBuffer;
+    for (int i = 0; testBuffer.size() < 4096; ++i)
+    {
+        testBuffer += "I'm a test buffer " + std::to_string(i % 10) + "\n";
+    }
+    GameSavingModel saveModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        (uint8_t*)testBuffer.data(),
+        (unsigned int)testBuffer.size(),
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+    saveModel.compressData = true;
+
+    std::shared_ptr<FakeHttpResponse> statusResponse = std::make_shared<FakeHttpResponse>();
+    statusResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    statusResponse->SetResponseBody(TEST_RESPONSE_OLD_CLOUD_TIME);
+
+    std::shared_ptr<FakeHttpResponse> putUrlResponse = std::make_shared<FakeHttpResponse>();
+    putUrlResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    putUrlResponse->SetResponseBody(TEST_RESPONSE_PUT_URL);
+
+    std::shared_ptr<FakeHttpResponse> putResponse = std::make_shared<FakeHttpResponse>();
+    putResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+
+    std::string uploadedBody;
+    Aws::String uploadedSha;
+    Aws::String uploadedUncompressedSize;
+    auto recordUpload = [&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+    {
+        uploadedBody = std::string(std::istreambuf_iterator<char>(*request->GetContentBody()), std::istreambuf_iterator<char>());
+        uploadedSha = request->GetHeaderValue(TEST_SHA_256_METADATA_HEADER.c_str());
+        uploadedUncompressedSize = request->GetHeaderValue("x-amz-meta-uncompressed_size");
+        return putResponse;
+    };
+
+    std::shared_ptr<FakeHttpResponse> slotSyncStatusResponse = std::make_shared<FakeHttpResponse>();
+    slotSyncStatusResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotSyncStatusResponse->SetResponseBody(TEST_RESPONSE);
+
+    std::shared_ptr<FakeHttpResponse> slotS3PresignedUrlResponse = std::make_shared<FakeHttpResponse>();
+    slotS3PresignedUrlResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotS3PresignedUrlResponse->SetResponseBody(TEST_GENERATE_S3_PRESIGNED_URL_RESPONSE);
+
+    // the download returns what was uploaded, with the SHA-256 sent along with it
+    std::shared_ptr<FakeHttpResponse> slotDownloadResponse = std::make_shared<FakeHttpResponse>();
+    auto returnUpload = [&](const std::shared_ptr<Aws::Http::HttpRequest>&, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+    {
+        slotDownloadResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+        slotDownloadResponse->SetResponseBody(uploadedBody);
+        slotDownloadResponse->AddHeader(TEST_SHA_256_METADATA_HEADER, uploadedSha);
+        return slotDownloadResponse;
+    };
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(statusResponse))
+        .WillOnce(Return(putUrlResponse))
+        .WillOnce(recordUpload)
+        .WillOnce(Return(slotSyncStatusResponse))
+        .WillOnce(Return(slotS3PresignedUrlResponse))
+        .WillOnce(returnUpload);
+
+    std::vector<uint8_t> data(testBuffer.size());
+    GameSavingModel loadModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        true, // override sync
+        data.data(),
+        (unsigned int)data.size(),
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    Dispatcher saveDispatcher;
+    Dispatcher loadDispatcher;
+
+    // act
+    const unsigned int saveResponse = GameKitSaveSlot(gameSavingInstance, &saveDispatcher, slotActionCallback, saveModel);
+    const unsigned int loadResponse = GameKitLoadSlot(gameSavingInstance, &loadDispatcher, slotDataResponseCallback, loadModel);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, saveResponse);
+    ASSERT_LT(uploadedBody.size(), testBuffer.size());
+    ASSERT_EQ(0, uploadedBody.compare(0, 4, "GKSZ"));
+    ASSERT_EQ(std::to_string(testBuffer.size()), std::string(uploadedUncompressedSize.c_str()));
+    ASSERT_EQ(testBuffer.size(), saveDispatcher.slot.sizeLocal);
+
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, loadResponse);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, loadDispatcher.callStatus);
+    ASSERT_EQ(testBuffer.size(), loadDispatcher.dataSize);
+    ASSERT_EQ(testBuffer, std::string(data.begin(), data.end()));
+
+    // teardown
+    remove(TEST_TEMP_FILEPATH);
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_missing_token)
+{
+    // arrange
+    const unsigned int expectedSlotCount = 0;
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(nullptr, expectedSlotCount);
+    SetMocks(gameSavingInstance);
+    sessionManager->DeleteToken(GameKit::TokenType::IdToken);
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _)).Times(0);
+
+    const GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        nullptr,
+        0,
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+
+    // assert
+    AssertCallFailed(GameKit::GAMEKIT_ERROR_NO_ID_TOKEN, response, dispatcher, expectedSlotCount);
+    ASSERT_FALSE(boost::filesystem::exists(TEST_TEMP_FILEPATH));
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_slot_not_found)
+{
+    // arrange
+    const unsigned int expectedSlotCount = 0;
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(nullptr, expectedSlotCount);
+    SetMocks(gameSavingInstance);
+
+    std::string testBuffer = "I'm a test buffer";
+    const GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        (uint8_t*)testBuffer.data(),
+        (unsigned int)testBuffer.size(),
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
+    testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse->SetResponseBody(TEST_RESPONSE_NO_ENTRY);
+
+    std::shared_ptr<FakeHttpResponse> testResponse2 = std::make_shared<FakeHttpResponse>();
+    testResponse2->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse2->SetResponseBody(TEST_RESPONSE_PUT_URL);
+
+    std::shared_ptr<FakeHttpResponse> testResponse3 = std::make_shared<FakeHttpResponse>();
+    testResponse3->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(testResponse))
+        .WillOnce(Return(testResponse2))
+        .WillOnce(Return(testResponse3));
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+
+    // assert
+    ASSERT_EQ(response, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(1, dispatcher.slotCount);
+    ASSERT_EQ(1, dispatcher.syncedSlots.size());
+    ASSERT_EQ(dispatcher.slot.metadataCloud, dispatcher.slot.metadataLocal);
+    ASSERT_EQ(dispatcher.slot.sizeCloud, dispatcher.slot.sizeLocal);
+    ASSERT_EQ(dispatcher.slot.lastModifiedCloud, dispatcher.slot.lastModifiedLocal);
+    ASSERT_EQ(dispatcher.slot.lastSync, dispatcher.slot.lastModifiedLocal);
+    ASSERT_EQ(SlotSyncStatus::SYNCED, dispatcher.slot.slotSyncStatus);
+    AssertSlotInfoEqual(dispatcher.slot, TEST_TEMP_FILEPATH);
+
+    // teardown
+    remove(TEST_TEMP_FILEPATH);
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_malformed_slot_name)
+{
+    // arrange
+    const unsigned int expectedSlotCount = 0;
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(nullptr, expectedSlotCount);
+    SetMocks(gameSavingInstance);
+
+    const GameSavingModel testModel = {
+        TEST_MALFORMED_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        nullptr,
+        0,
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+
+    // assert
+    AssertCallFailed(GameKit::GAMEKIT_ERROR_GAME_SAVING_MALFORMED_SLOT_NAME, response, dispatcher, expectedSlotCount);
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_metadata_too_long)
+{
+    // arrange
+    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is updated from the response
+        local.Millis(),
+        0, // cloud time is update from the response
+        last.Millis(),
+        SlotSyncStatus::UNKNOWN
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::vector<char> metadata(TEST_MAX_METADATA_BYTES + 1, 'a');
+    metadata.push_back('\n');
+    const GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        metadata.data(),
+        0, // epoch time
+        false, // override sync
+        nullptr,
+        0,
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
+    testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    testResponse->SetResponseBody(TEST_RESPONSE_OLD_CLOUD_TIME);
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _)).WillOnce(Return(testResponse));
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+
+    // assert
+    AssertCallFailed(GameKit::GAMEKIT_ERROR_GAME_SAVING_EXCEEDED_MAX_SIZE, response, dispatcher);
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_max_slots_exceeded)
+{
+    // arrange
+    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is updated from the response
+        local.Millis(),
+        0, // cloud time is update from the response
+        last.Millis(),
+        SlotSyncStatus::UNKNOWN
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::string testBuffer = "I'm a test buffer";
+    const GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        (uint8_t*)testBuffer.data(),
+        (unsigned int)testBuffer.size(),
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    std::shared_ptr<FakeHttpResponse> testResponse = std::make_shared<FakeHttpResponse>();
+    testResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(400));
+    testResponse->SetResponseBody(TEST_RESPONSE_MAX_SLOTS_EXCEEDED);
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _)).WillOnce(Return(testResponse));
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitSaveSlot(gameSavingInstance, &dispatcher, slotActionCallback, testModel);
+
+    // assert
+    AssertCallFailed(GameKit::GAMEKIT_ERROR_GAME_SAVING_MAX_CLOUD_SLOTS_EXCEEDED, response, dispatcher);
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingSaveSlot_other_bad_request)
+{
+    // arrange
+    last = ToAwsString(TEST_LAST_SYNC_OLD_CLOUD_TIME);
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
         TEST_SIZE_LOCAL,
         0, // cloud size is updated from the response
         local.Millis(),
@@ -1687,33 +2570,110 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingLoadSlot_succes
 
     Dispatcher dispatcher;
     // act
-    const unsigned int response = GameKitLoadSlot(gameSavingInstance, &dispatcher, slotDataResponseCallback, testModel);
+    const unsigned int response = GameKitLoadSlot(gameSavingInstance, &dispatcher, slotDataResponseCallback, testModel);
+
+    // assert
+    ASSERT_EQ(response, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(1, dispatcher.slotCount);
+    ASSERT_EQ(1, dispatcher.syncedSlots.size());
+    ASSERT_EQ(0, strcmp(dispatcher.slot.slotName.c_str(), dispatcher.syncedSlots[0].slotName.c_str()));
+    ASSERT_EQ(0, strcmp(TEST_SLOT_NAME, dispatcher.slot.slotName.c_str()));
+    ASSERT_EQ(0, strcmp(TEST_METADATA_CLOUD, dispatcher.slot.metadataLocal.c_str()));
+    ASSERT_EQ(0, strcmp(TEST_METADATA_CLOUD, dispatcher.slot.metadataCloud.c_str()));
+    ASSERT_EQ(TEST_SIZE_CLOUD, dispatcher.slot.sizeLocal);
+    ASSERT_EQ(TEST_SIZE_CLOUD, dispatcher.slot.sizeCloud);
+    ASSERT_EQ(cloud.Millis(), dispatcher.slot.lastModifiedLocal.Millis());
+    ASSERT_EQ(cloud.Millis(), dispatcher.slot.lastModifiedCloud.Millis());
+    ASSERT_EQ(cloud.Millis(), dispatcher.slot.lastSync.Millis());
+    ASSERT_EQ(SlotSyncStatus::SYNCED, dispatcher.slot.slotSyncStatus);
+    ASSERT_EQ(TEST_SLOT_DOWNLOAD_RESPONSE_SIZE, dispatcher.dataSize);
+    ASSERT_EQ(data, dispatcher.data);
+    uint8_t expectedData[TEST_SLOT_DOWNLOAD_RESPONSE_SIZE];
+    memcpy((void*)expectedData, (void*)TEST_SLOT_DOWNLOAD_RESPONSE.c_str(), TEST_SLOT_DOWNLOAD_RESPONSE_SIZE);
+    for (int i = 0; i < TEST_SLOT_DOWNLOAD_RESPONSE_SIZE; i++)
+    {
+        ASSERT_EQ(expectedData[i], data[i]);
+    }
+
+    AssertSlotInfoEqual(dispatcher.slot, TEST_TEMP_FILEPATH);
+    remove(TEST_TEMP_FILEPATH);
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingLoadSlot_twice_reuses_presigned_url)
+{
+    // arrange
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is update from the response
+        0, // setting local to 0 to force it to be older then cloud
+        0, // cloud time is updated from the response
+        0, // last sync must be equal to local in this case, else it will indicate a conflict
+        SlotSyncStatus::UNKNOWN
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::shared_ptr<FakeHttpResponse> slotSyncStatusResponse = std::make_shared<FakeHttpResponse>();
+    slotSyncStatusResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotSyncStatusResponse->SetResponseBody(TEST_RESPONSE);
+
+    std::shared_ptr<FakeHttpResponse> slotSyncStatusResponse2 = std::make_shared<FakeHttpResponse>();
+    slotSyncStatusResponse2->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotSyncStatusResponse2->SetResponseBody(TEST_RESPONSE);
+
+    std::shared_ptr<FakeHttpResponse> slotS3PresignedUrlResponse = std::make_shared<FakeHttpResponse>();
+    slotS3PresignedUrlResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotS3PresignedUrlResponse->SetResponseBody(TEST_GENERATE_S3_PRESIGNED_URL_RESPONSE);
+
+    std::shared_ptr<FakeHttpResponse> slotDownloadResponse = std::make_shared<FakeHttpResponse>();
+    slotDownloadResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotDownloadResponse->SetResponseBody(TEST_SLOT_DOWNLOAD_RESPONSE);
+    slotDownloadResponse->AddHeader(TEST_SHA_256_METADATA_HEADER, TEST_SLOT_DOWNLOAD_SHA_256);
+
+    std::shared_ptr<FakeHttpResponse> slotDownloadResponse2 = std::make_shared<FakeHttpResponse>();
+    slotDownloadResponse2->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotDownloadResponse2->SetResponseBody(TEST_SLOT_DOWNLOAD_RESPONSE);
+    slotDownloadResponse2->AddHeader(TEST_SHA_256_METADATA_HEADER, TEST_SLOT_DOWNLOAD_SHA_256);
+
+    // the second load skips the pre-signed url request
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(slotSyncStatusResponse))
+        .WillOnce(Return(slotS3PresignedUrlResponse))
+        .WillOnce(Return(slotDownloadResponse))
+        .WillOnce(Return(slotSyncStatusResponse2))
+        .WillOnce(Return(slotDownloadResponse2));
+
+    uint8_t data[TEST_SLOT_DOWNLOAD_RESPONSE_SIZE];
+    const GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        data,
+        TEST_SLOT_DOWNLOAD_RESPONSE_SIZE,
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int firstResponse = GameKitLoadSlot(gameSavingInstance, &dispatcher, slotDataResponseCallback, testModel);
+    const unsigned int secondResponse = GameKitLoadSlot(gameSavingInstance, &dispatcher, slotDataResponseCallback, testModel);
 
     // assert
-    ASSERT_EQ(response, GameKit::GAMEKIT_SUCCESS);
-    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_SUCCESS);
-    ASSERT_EQ(1, dispatcher.slotCount);
-    ASSERT_EQ(1, dispatcher.syncedSlots.size());
-    ASSERT_EQ(0, strcmp(dispatcher.slot.slotName.c_str(), dispatcher.syncedSlots[0].slotName.c_str()));
-    ASSERT_EQ(0, strcmp(TEST_SLOT_NAME, dispatcher.slot.slotName.c_str()));
-    ASSERT_EQ(0, strcmp(TEST_METADATA_CLOUD, dispatcher.slot.metadataLocal.c_str()));
-    ASSERT_EQ(0, strcmp(TEST_METADATA_CLOUD, dispatcher.slot.metadataCloud.c_str()));
-    ASSERT_EQ(TEST_SIZE_CLOUD, dispatcher.slot.sizeLocal);
-    ASSERT_EQ(TEST_SIZE_CLOUD, dispatcher.slot.sizeCloud);
-    ASSERT_EQ(cloud.Millis(), dispatcher.slot.lastModifiedLocal.Millis());
-    ASSERT_EQ(cloud.Millis(), dispatcher.slot.lastModifiedCloud.Millis());
-    ASSERT_EQ(cloud.Millis(), dispatcher.slot.lastSync.Millis());
-    ASSERT_EQ(SlotSyncStatus::SYNCED, dispatcher.slot.slotSyncStatus);
+    ASSERT_EQ(firstResponse, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(secondResponse, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(2, dispatcher.callCount);
     ASSERT_EQ(TEST_SLOT_DOWNLOAD_RESPONSE_SIZE, dispatcher.dataSize);
-    ASSERT_EQ(data, dispatcher.data);
-    uint8_t expectedData[TEST_SLOT_DOWNLOAD_RESPONSE_SIZE];
-    memcpy((void*)expectedData, (void*)TEST_SLOT_DOWNLOAD_RESPONSE.c_str(), TEST_SLOT_DOWNLOAD_RESPONSE_SIZE);
-    for (int i = 0; i < TEST_SLOT_DOWNLOAD_RESPONSE_SIZE; i++)
-    {
-        ASSERT_EQ(expectedData[i], data[i]);
-    }
+    ASSERT_EQ(TEST_SLOT_DOWNLOAD_RESPONSE, std::string((const char*)data, TEST_SLOT_DOWNLOAD_RESPONSE_SIZE));
 
-    AssertSlotInfoEqual(dispatcher.slot, TEST_TEMP_FILEPATH);
     remove(TEST_TEMP_FILEPATH);
 
     GameKitGameSavingInstanceRelease(gameSavingInstance);
@@ -2276,6 +3236,307 @@ TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingLoadSlot_buffer
     GameKitGameSavingInstanceRelease(gameSavingInstance);
 }
 
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingLoadSlot_success_received_into_buffer)
+{
+    // arrange
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is update from the response
+        0, // setting local to 0 to force it to be older then cloud
+        0, // cloud time is updated from the response
+        0, // last sync must be equal to local in this case, else it will indicate a conflict
+        SlotSyncStatus::UNKNOWN
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::shared_ptr<FakeHttpResponse> slotSyncStatusResponse = std::make_shared<FakeHttpResponse>();
+    slotSyncStatusResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotSyncStatusResponse->SetResponseBody(TEST_RESPONSE);
+
+    std::shared_ptr<FakeHttpResponse> slotS3PresignedUrlResponse = std::make_shared<FakeHttpResponse>();
+    slotS3PresignedUrlResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotS3PresignedUrlResponse->SetResponseBody(TEST_GENERATE_S3_PRESIGNED_URL_RESPONSE);
+
+    // the body is written to the stream made by the request's response stream factory, like the SDK http clients do
+    std::shared_ptr<FakeHttpResponse> slotDownloadResponse = std::make_shared<FakeHttpResponse>();
+    auto receiveIntoResponseStream = [&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+    {
+        Aws::IOStream* stream = request->GetResponseStreamFactory()();
+        stream->write(TEST_SLOT_DOWNLOAD_RESPONSE.data(), TEST_SLOT_DOWNLOAD_RESPONSE.size());
+        slotDownloadResponse->SetResponseBodyStream(stream);
+        slotDownloadResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+        slotDownloadResponse->AddHeader(TEST_SHA_256_METADATA_HEADER, TEST_SLOT_DOWNLOAD_SHA_256);
+        return slotDownloadResponse;
+    };
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(slotSyncStatusResponse))
+        .WillOnce(Return(slotS3PresignedUrlResponse))
+        .WillOnce(receiveIntoResponseStream);
+
+    uint8_t data[TEST_SLOT_DOWNLOAD_RESPONSE_SIZE];
+    const GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        data,
+        TEST_SLOT_DOWNLOAD_RESPONSE_SIZE,
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitLoadSlot(gameSavingInstance, &dispatcher, slotDataResponseCallback, testModel);
+
+    // assert
+    ASSERT_EQ(response, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_SUCCESS);
+    ASSERT_EQ(TEST_SLOT_DOWNLOAD_RESPONSE_SIZE, dispatcher.dataSize);
+    ASSERT_EQ(TEST_SLOT_DOWNLOAD_RESPONSE, std::string((const char*)data, TEST_SLOT_DOWNLOAD_RESPONSE_SIZE));
+
+    remove(TEST_TEMP_FILEPATH);
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingLoadSlot_buffer_too_small_from_content_length)
+{
+    // arrange
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is updated from the response
+        local.Millis(),
+        0, // cloud time is update from the response
+        last.Millis(),
+        SlotSyncStatus::UNKNOWN
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::shared_ptr<FakeHttpResponse> slotSyncStatusResponse = std::make_shared<FakeHttpResponse>();
+    slotSyncStatusResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotSyncStatusResponse->SetResponseBody(TEST_RESPONSE);
+
+    std::shared_ptr<FakeHttpResponse> slotS3PresignedUrlResponse = std::make_shared<FakeHttpResponse>();
+    slotS3PresignedUrlResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotS3PresignedUrlResponse->SetResponseBody(TEST_GENERATE_S3_PRESIGNED_URL_RESPONSE);
+
+    // the headers arrive and the client asks whether to go on before receiving the body
+    bool continuedAfterHeaders = true;
+    std::shared_ptr<FakeHttpResponse> slotDownloadResponse = std::make_shared<FakeHttpResponse>();
+    auto abortAfterHeaders = [&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+    {
+        slotDownloadResponse->AddHeader(Aws::Http::CONTENT_LENGTH_HEADER, std::to_string(TEST_SLOT_DOWNLOAD_RESPONSE_SIZE).c_str());
+        slotDownloadResponse->AddHeader(TEST_SHA_256_METADATA_HEADER, TEST_SLOT_DOWNLOAD_SHA_256);
+        request->GetHeadersReceivedEventHandler()(request.get(), slotDownloadResponse.get());
+        continuedAfterHeaders = request->GetContinueRequestHandler()(request.get());
+        slotDownloadResponse->SetResponseCode(Aws::Http::HttpResponseCode::REQUEST_NOT_MADE);
+        return slotDownloadResponse;
+    };
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(slotSyncStatusResponse))
+        .WillOnce(Return(slotS3PresignedUrlResponse))
+        .WillOnce(abortAfterHeaders);
+
+    uint8_t data[TEST_SLOT_DOWNLOAD_RESPONSE_SIZE - 1];
+    const GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        data,
+        TEST_SLOT_DOWNLOAD_RESPONSE_SIZE - 1,
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitLoadSlot(gameSavingInstance, &dispatcher, slotDataResponseCallback, testModel);
+
+    // assert
+    ASSERT_FALSE(continuedAfterHeaders);
+    ASSERT_EQ(response, GameKit::GAMEKIT_ERROR_GAME_SAVING_BUFFER_TOO_SMALL);
+    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_ERROR_GAME_SAVING_BUFFER_TOO_SMALL);
+
+    remove(TEST_TEMP_FILEPATH);
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingLoadSlot_error_body_not_received_into_buffer)
+{
+    // arrange
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is updated from the response
+        0, // setting local to 0 to force it to be older then cloud
+        0, // cloud time is updated from the response
+        0, // last sync must be equal to local in this case, else it will indicate a conflict
+        SlotSyncStatus::UNKNOWN
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::shared_ptr<FakeHttpResponse> slotSyncStatusResponse = std::make_shared<FakeHttpResponse>();
+    slotSyncStatusResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotSyncStatusResponse->SetResponseBody(TEST_RESPONSE);
+
+    std::shared_ptr<FakeHttpResponse> slotS3PresignedUrlResponse = std::make_shared<FakeHttpResponse>();
+    slotS3PresignedUrlResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotS3PresignedUrlResponse->SetResponseBody(TEST_GENERATE_S3_PRESIGNED_URL_RESPONSE);
+
+    // S3 rejects the url with an error body larger than the buffer, written to the stream made by the response stream factory
+    const std::string errorBody = "<?xml version=\"1.0\" encoding=\"UTF-8\"?><Error><Code>AccessDenied</Code><Message>Request has expired</Message></Error>";
+    std::shared_ptr<FakeHttpResponse> slotDownloadResponse = std::make_shared<FakeHttpResponse>();
+    auto receiveError = [&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+    {
+        Aws::IOStream* stream = request->GetResponseStreamFactory()();
+        slotDownloadResponse->SetResponseCode(Aws::Http::HttpResponseCode::FORBIDDEN);
+        slotDownloadResponse->AddHeader(Aws::Http::CONTENT_LENGTH_HEADER, std::to_string(errorBody.size()).c_str());
+        request->GetHeadersReceivedEventHandler()(request.get(), slotDownloadResponse.get());
+        stream->write(errorBody.data(), errorBody.size());
+        slotDownloadResponse->SetResponseBodyStream(stream);
+        return slotDownloadResponse;
+    };
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(slotSyncStatusResponse))
+        .WillOnce(Return(slotS3PresignedUrlResponse))
+        .WillOnce(receiveError);
+
+    std::string data(TEST_SLOT_DOWNLOAD_RESPONSE_SIZE, 'x');
+    const GameSavingModel testModel = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        0, // epoch time
+        false, // override sync
+        (uint8_t*)data.data(),
+        TEST_SLOT_DOWNLOAD_RESPONSE_SIZE,
+        TEST_TEMP_FILEPATH, // local slot info file path
+    };
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitLoadSlot(gameSavingInstance, &dispatcher, slotDataResponseCallback, testModel);
+
+    // assert
+    ASSERT_LT((size_t)TEST_SLOT_DOWNLOAD_RESPONSE_SIZE, errorBody.size());
+    ASSERT_EQ(response, GameKit::GAMEKIT_ERROR_HTTP_REQUEST_FAILED);
+    ASSERT_EQ(dispatcher.callStatus, GameKit::GAMEKIT_ERROR_HTTP_REQUEST_FAILED);
+    ASSERT_EQ(std::string(TEST_SLOT_DOWNLOAD_RESPONSE_SIZE, 'x'), data);
+
+    remove(TEST_TEMP_FILEPATH);
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
+TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingLoadSlots_reports_each_slot_then_completes)
+{
+    // arrange
+    Slot testSlot = {
+        TEST_SLOT_NAME,
+        TEST_METADATA_LOCAL,
+        "", // cloud metadata is updated from the response
+        TEST_SIZE_LOCAL,
+        0, // cloud size is update from the response
+        0, // setting local to 0 to force it to be older then cloud
+        0, // cloud time is updated from the response
+        0, // last sync must be equal to local in this case, else it will indicate a conflict
+        SlotSyncStatus::UNKNOWN
+    };
+
+    GAMEKIT_GAME_SAVING_INSTANCE_HANDLE const gameSavingInstance = CreateGameSavingInstance(&testSlot, 1);
+    SetMocks(gameSavingInstance);
+
+    std::shared_ptr<FakeHttpResponse> slotSyncStatusResponse = std::make_shared<FakeHttpResponse>();
+    slotSyncStatusResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotSyncStatusResponse->SetResponseBody(TEST_RESPONSE);
+
+    std::shared_ptr<FakeHttpResponse> slotS3PresignedUrlResponse = std::make_shared<FakeHttpResponse>();
+    slotS3PresignedUrlResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotS3PresignedUrlResponse->SetResponseBody(TEST_GENERATE_S3_PRESIGNED_URL_RESPONSE);
+
+    std::shared_ptr<FakeHttpResponse> slotDownloadResponse = std::make_shared<FakeHttpResponse>();
+    slotDownloadResponse->SetResponseCode(static_cast<Aws::Http::HttpResponseCode>(200));
+    slotDownloadResponse->SetResponseBody(TEST_SLOT_DOWNLOAD_RESPONSE);
+    slotDownloadResponse->AddHeader(TEST_SHA_256_METADATA_HEADER, TEST_SLOT_DOWNLOAD_SHA_256);
+
+    // only the cached slot makes requests, the unknown slot fails before any request is made
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(slotSyncStatusResponse))
+        .WillOnce(Return(slotS3PresignedUrlResponse))
+        .WillOnce(Return(slotDownloadResponse));
+
+    uint8_t data[TEST_SLOT_DOWNLOAD_RESPONSE_SIZE];
+    uint8_t unknownSlotData[TEST_SLOT_DOWNLOAD_RESPONSE_SIZE];
+    const GameSavingModel testModels[] = {
+        {
+            TEST_SLOT_NAME,
+            TEST_METADATA_LOCAL,
+            0, // epoch time
+            false, // override sync
+            data,
+            TEST_SLOT_DOWNLOAD_RESPONSE_SIZE,
+            TEST_TEMP_FILEPATH, // local slot info file path
+        },
+        {
+            "unknownSlot",
+            TEST_METADATA_LOCAL,
+            0, // epoch time
+            false, // override sync
+            unknownSlotData,
+            TEST_SLOT_DOWNLOAD_RESPONSE_SIZE,
+            TEST_TEMP_FILEPATH, // local slot info file path
+        }
+    };
+
+    Dispatcher dispatcher;
+
+    // act
+    const unsigned int response = GameKitLoadSlots(gameSavingInstance, &dispatcher, slotDataResponseCallback, slotCallback, testModels, 2, LOAD_SLOTS_DEFAULT_MAX_CONCURRENT_TRANSFERS);
+
+    // assert
+    ASSERT_EQ(response, GameKit::GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND);
+    ASSERT_EQ(3, dispatcher.callCount); // one call per slot, then the completion call
+
+    // the cached slot is reported last, its download completes after the unknown slot failed
+    ASSERT_EQ(0, strcmp(TEST_SLOT_NAME, dispatcher.slot.slotName.c_str()));
+    ASSERT_EQ(SlotSyncStatus::SYNCED, dispatcher.slot.slotSyncStatus);
+    ASSERT_EQ(data, dispatcher.data);
+    ASSERT_EQ(TEST_SLOT_DOWNLOAD_RESPONSE_SIZE, dispatcher.dataSize);
+    ASSERT_EQ(TEST_SLOT_DOWNLOAD_RESPONSE, std::string((const char*)data, TEST_SLOT_DOWNLOAD_RESPONSE_SIZE));
+
+    ASSERT_TRUE(dispatcher.complete);
+    ASSERT_EQ(1, dispatcher.callStatuses.size());
+    ASSERT_EQ(GameKit::GAMEKIT_ERROR_GAME_SAVING_SLOT_NOT_FOUND, dispatcher.callStatus);
+    ASSERT_EQ(1, dispatcher.slotCounts.size());
+    ASSERT_EQ(1, dispatcher.slotCounts[0]);
+    ASSERT_EQ(SlotSyncStatus::SYNCED, dispatcher.syncedSlots.back().slotSyncStatus);
+
+    AssertSlotInfoEqual(dispatcher.slot, TEST_TEMP_FILEPATH);
+    remove(TEST_TEMP_FILEPATH);
+
+    GameKitGameSavingInstanceRelease(gameSavingInstance);
+}
+
 TEST_F(GameKitGameSavingExportsTestFixture, TestGameKitGameSavingDeleteCloudSlot_success)
 {
     // arrange
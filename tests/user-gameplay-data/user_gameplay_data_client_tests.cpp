@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 // Standard library
+#include <atomic>
 #include <fstream>
 
 // AWS SDK
@@ -162,6 +163,109 @@ TEST_F(UserGameplayDataClientTestFixture, MakeSingleRequest_ClientOffline_WithBa
     ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
 }
 
+TEST_F(UserGameplayDataClientTestFixture, MakeMultipleRequests_ClientOffline_WithBackgroundThread_DroppedAboveQueueLimit)
+{
+    // Arrange
+    using namespace ::testing;
+
+    std::shared_ptr<Aws::Http::HttpRequest> request = std::make_shared<FakeHttpRequest>(
+        Aws::Http::URI("https://123.aws.com/foo"), Aws::Http::HttpMethod::HTTP_POST);
+
+    std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    std::shared_ptr<Aws::Http::HttpResponse> notMadeResponse = std::make_shared<FakeHttpResponse>();
+    notMadeResponse->SetResponseCode(Aws::Http::HttpResponseCode(-1));
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillRepeatedly(Return(notMadeResponse));
+
+    // Act
+    UserGameplayDataHttpClient client(mockHttpClient, authSetter, 1, retryLogic, MAX_QUEUE_SIZE, TestLogger::Log);
+    client.StartRetryBackgroundThread();
+
+    auto firstResult = client.MakeRequest(UserGameplayDataOperationType::Write,
+        false, "Foo", "", request, Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT);
+
+    // Enqueue in two rounds, the background thread moves the first round into the pending queue in between
+    int enqueuedCount = 0;
+    int droppedCount = 0;
+    for (int round = 0; round < 2; ++round)
+    {
+        for (int i = 0; i < MAX_QUEUE_SIZE; ++i)
+        {
+            const std::string bundle = "Foo" + std::to_string(round) + "_" + std::to_string(i);
+            auto result = client.MakeRequest(UserGameplayDataOperationType::Write,
+                true, bundle.c_str(), "", request, Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT);
+            enqueuedCount += result.ResultType == RequestResultType::RequestEnqueued ? 1 : 0;
+            droppedCount += result.ResultType == RequestResultType::RequestDropped ? 1 : 0;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    }
+
+    client.StopRetryBackgroundThread();
+
+    // Assert
+    ASSERT_EQ(firstResult.ResultType, RequestResultType::RequestAttemptedAndEnqueued);
+    ASSERT_LE(enqueuedCount, MAX_QUEUE_SIZE); // the operation enqueued for retry takes the remaining slot
+    ASSERT_EQ(2 * MAX_QUEUE_SIZE, enqueuedCount + droppedCount);
+    ASSERT_GE(droppedCount, MAX_QUEUE_SIZE);
+}
+
+TEST_F(UserGameplayDataClientTestFixture, MakeSingleRequest_ClientOffline_WithAuthorizationVersion_HeaderOnlySetWhenVersionChanges)
+{
+    // Arrange
+    using namespace ::testing;
+
+    std::shared_ptr<Aws::Http::HttpRequest> request = std::make_shared<FakeHttpRequest>(
+        Aws::Http::URI("https://123.aws.com/foo"), Aws::Http::HttpMethod::HTTP_POST);
+
+    std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    std::shared_ptr<Aws::Http::HttpResponse> notMadeResponse = std::make_shared<FakeHttpResponse>();
+    notMadeResponse->SetResponseCode(Aws::Http::HttpResponseCode(-1));
+
+    std::atomic<uint64_t> authorizationVersion(1);
+    std::atomic<int> authorizationHeaderSets(0);
+    auto countingAuthSetter = [&authorizationHeaderSets](std::shared_ptr<Aws::Http::HttpRequest> request)
+    {
+        authorizationHeaderSets++;
+        request->SetHeaderValue(HEADER_AUTHORIZATION, "Bearer 123XYZ");
+    };
+
+    // the token changes during the second attempt
+    int attempts = 0;
+    auto changeVersionOnSecondAttempt = [&attempts, &authorizationVersion, &notMadeResponse]()
+    {
+        if (++attempts == 2)
+        {
+            authorizationVersion = 2;
+        }
+
+        return notMadeResponse;
+    };
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .Times(4)
+        .WillRepeatedly(InvokeWithoutArgs(changeVersionOnSecondAttempt));
+
+    // Act
+    UserGameplayDataHttpClient client(mockHttpClient, countingAuthSetter, 1, retryLogic, MAX_QUEUE_SIZE, TestLogger::Log);
+    client.SetAuthorizationVersionGetter([&authorizationVersion]() { return authorizationVersion.load(); });
+    client.StartRetryBackgroundThread();
+
+    auto result = client.MakeRequest(UserGameplayDataOperationType::Write,
+        false, "Foo", "", request, Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3000));
+
+    client.StopRetryBackgroundThread();
+
+    // Assert
+    ASSERT_EQ(result.ResultType, RequestResultType::RequestAttemptedAndEnqueued);
+    ASSERT_EQ(2, authorizationHeaderSets.load());
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
 TEST_F(UserGameplayDataClientTestFixture, MakeSingleRequest_ClientOffline_WithoutBackgroundThread_NoRetry)
 {
     // Arrange
@@ -354,6 +458,349 @@ TEST_F(UserGameplayDataClientTestFixture, MakeMultipleRequests_ClientOfflineThen
     mockHttpClient.reset();
 }
 
+TEST_F(UserGameplayDataClientTestFixture, MakeMultipleRequests_ConcurrentRequests_WithBackgroundThread_BundleOrderPreserved)
+{
+    // Arrange
+    using namespace ::testing;
+
+    std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    std::shared_ptr<Aws::Http::HttpResponse> successResponse = std::make_shared<FakeHttpResponse>();
+    successResponse->SetResponseCode(Aws::Http::HttpResponseCode(201));
+
+    std::mutex sentMutex;
+    std::vector<std::string> sentUris;
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .Times(6)
+        .WillRepeatedly([&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                std::lock_guard<std::mutex> lock(sentMutex);
+                sentUris.push_back(ToStdString(request->GetURIString(false)));
+                return successResponse;
+            });
+
+    // Act
+    unsigned int retryIntervalSeconds = 1;
+    size_t maxConcurrentRequests = 4;
+    UserGameplayDataHttpClient client(mockHttpClient, authSetter, retryIntervalSeconds, retryLogic, MAX_QUEUE_SIZE, TestLogger::Log, maxConcurrentRequests);
+    client.StartRetryBackgroundThread();
+
+    std::vector<RequestResultType> resultTypes;
+    for (const std::string& item : { "Item1", "Item2", "Item3" })
+    {
+        for (const std::string& bundle : { "Foo", "Bar" })
+        {
+            std::shared_ptr<Aws::Http::HttpRequest> request = std::make_shared<FakeHttpRequest>(
+                Aws::Http::URI(ToAwsString("https://123.aws.com/" + bundle + "/" + item)), Aws::Http::HttpMethod::HTTP_POST);
+
+            auto result = client.MakeRequest(UserGameplayDataOperationType::Write,
+                true, bundle.c_str(), item.c_str(), request, Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT);
+            resultTypes.push_back(result.ResultType);
+
+            // keep timestamps distinct so the queue order is deterministic
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    client.StopRetryBackgroundThread();
+
+    // Assert
+    for (auto resultType : resultTypes)
+    {
+        ASSERT_EQ(resultType, RequestResultType::RequestEnqueued);
+    }
+
+    ASSERT_EQ(sentUris.size(), 6);
+    for (const std::string& bundle : { "Foo", "Bar" })
+    {
+        std::vector<std::string> bundleUris;
+        std::copy_if(sentUris.begin(), sentUris.end(), std::back_inserter(bundleUris),
+            [&](const std::string& uri) { return uri.find("/" + bundle + "/") != std::string::npos; });
+
+        ASSERT_EQ(bundleUris.size(), 3);
+        ASSERT_STREQ(bundleUris[0].c_str(), ("https://123.aws.com/" + bundle + "/Item1").c_str());
+        ASSERT_STREQ(bundleUris[1].c_str(), ("https://123.aws.com/" + bundle + "/Item2").c_str());
+        ASSERT_STREQ(bundleUris[2].c_str(), ("https://123.aws.com/" + bundle + "/Item3").c_str());
+    }
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
+TEST_F(UserGameplayDataClientTestFixture, MakeMultipleRequests_SynchronousWhileFlushingQueue_DefaultConcurrency_RequestsNotOverlapped)
+{
+    // Arrange
+    using namespace ::testing;
+
+    std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    std::shared_ptr<Aws::Http::HttpResponse> successResponse = std::make_shared<FakeHttpResponse>();
+    successResponse->SetResponseCode(Aws::Http::HttpResponseCode(201));
+
+    std::atomic<int> inFlight(0);
+    std::atomic<int> maxInFlight(0);
+    std::atomic<int> queuedSent(0);
+
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillRepeatedly([&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                int current = ++inFlight;
+                int previousMax = maxInFlight;
+                while (current > previousMax && !maxInFlight.compare_exchange_weak(previousMax, current))
+                {
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                if (ToStdString(request->GetURIString(false)).find("/Queued") != std::string::npos)
+                {
+                    queuedSent++;
+                }
+
+                --inFlight;
+                return successResponse;
+            });
+
+    // Act
+    UserGameplayDataHttpClient client(mockHttpClient, authSetter, 1, retryLogic, MAX_QUEUE_SIZE, TestLogger::Log);
+    client.StartRetryBackgroundThread();
+
+    for (const std::string& bundle : { "Queued1", "Queued2", "Queued3" })
+    {
+        std::shared_ptr<Aws::Http::HttpRequest> request = std::make_shared<FakeHttpRequest>(
+            Aws::Http::URI(ToAwsString("https://123.aws.com/" + bundle + "/Item")), Aws::Http::HttpMethod::HTTP_POST);
+        client.MakeRequest(UserGameplayDataOperationType::Write,
+            true, bundle.c_str(), "Item", request, Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT);
+    }
+
+    // Keep making synchronous requests until the background thread has flushed the queue
+    int synchronousRequests = 0;
+    for (int i = 0; i < 200 && queuedSent < 3; ++i)
+    {
+        std::shared_ptr<Aws::Http::HttpRequest> request = std::make_shared<FakeHttpRequest>(
+            Aws::Http::URI("https://123.aws.com/Sync/Item"), Aws::Http::HttpMethod::HTTP_POST);
+        client.MakeRequest(UserGameplayDataOperationType::Write,
+            false, "Sync", "Item", request, Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT);
+        synchronousRequests++;
+    }
+
+    client.StopRetryBackgroundThread();
+
+    // Assert
+    ASSERT_EQ(3, queuedSent);
+    ASSERT_GT(synchronousRequests, 0);
+    ASSERT_EQ(1, maxInFlight);
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
+TEST_F(UserGameplayDataClientTestFixture, MakeMultipleRequests_WritesToSameBundle_WithBackgroundThread_BatchedIntoSingleRequest)
+{
+    // Arrange
+    using namespace ::testing;
+
+    auto makeWriteRequest = [](const std::string& path, Aws::Http::HttpMethod method, const std::string& body)
+    {
+        std::shared_ptr<Aws::Http::HttpRequest> request = std::make_shared<FakeHttpRequest>(
+            Aws::Http::URI(ToAwsString("https://123.aws.com" + path)), method);
+
+        std::shared_ptr<Aws::IOStream> payloadStream = Aws::MakeShared<Aws::StringStream>("BatchTestBody");
+        *payloadStream << body;
+        request->AddContentBody(payloadStream);
+
+        return request;
+    };
+
+    std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    std::shared_ptr<FakeHttpResponse> successResponse = std::make_shared<FakeHttpResponse>();
+    successResponse->SetResponseCode(Aws::Http::HttpResponseCode(201));
+    successResponse->SetResponseBody("{\"data\":{\"unprocessed_items\":[{\"bundle_item_key\":\"Item3\",\"bundle_item_value\":\"3\"}]}}");
+
+    std::string sentUri;
+    std::string sentBody;
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce([&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                sentUri = ToStdString(request->GetURIString(false));
+                sentBody = std::string(std::istreambuf_iterator<char>(*request->GetContentBody()), std::istreambuf_iterator<char>());
+                return successResponse;
+            });
+
+    Aws::Http::HttpResponseCode successCode1 = Aws::Http::HttpResponseCode(-1);
+    Aws::Http::HttpResponseCode successCode2 = Aws::Http::HttpResponseCode(-1);
+    Aws::Http::HttpResponseCode failureCode3 = Aws::Http::HttpResponseCode(-1);
+    ResponseCallback responseCallback =
+        std::bind(&UserGameplayDataClientTestFixture::MockResponseCallback, this, std::placeholders::_1, std::placeholders::_2);
+
+    // Act
+    unsigned int retryIntervalSeconds = 1;
+    UserGameplayDataHttpClient client(mockHttpClient, authSetter, retryIntervalSeconds, retryLogic, MAX_QUEUE_SIZE, TestLogger::Log);
+    client.StartRetryBackgroundThread();
+
+    auto result1 = client.MakeRequest(UserGameplayDataOperationType::Write, true, "Foo", "",
+        makeWriteRequest("/bundles/Foo", Aws::Http::HttpMethod::HTTP_POST, "{\"Item1\":\"1\",\"Item2\":\"2\"}"),
+        Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT, (CallbackContext)(&successCode1), responseCallback);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    auto result2 = client.MakeRequest(UserGameplayDataOperationType::Write, true, "Foo", "Item1",
+        makeWriteRequest("/bundles/Foo/items/Item1", Aws::Http::HttpMethod::HTTP_PUT, "{\"bundle_item_value\":\"10\"}"),
+        Aws::Http::HttpResponseCode(204), OPERATION_ATTEMPTS_NO_LIMIT, (CallbackContext)(&successCode2), responseCallback);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+    auto result3 = client.MakeRequest(UserGameplayDataOperationType::Write, true, "Foo", "Item3",
+        makeWriteRequest("/bundles/Foo/items/Item3", Aws::Http::HttpMethod::HTTP_PUT, "{\"bundle_item_value\":\"3\"}"),
+        Aws::Http::HttpResponseCode(204), OPERATION_ATTEMPTS_NO_LIMIT, (CallbackContext)(&failureCode3), nullptr, responseCallback);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    client.StopRetryBackgroundThread();
+
+    // Assert
+    ASSERT_EQ(result1.ResultType, RequestResultType::RequestEnqueued);
+    ASSERT_EQ(result2.ResultType, RequestResultType::RequestEnqueued);
+    ASSERT_EQ(result3.ResultType, RequestResultType::RequestEnqueued);
+
+    // newer writes to the same item win, all items are written to the bundle
+    ASSERT_STREQ(sentUri.c_str(), "https://123.aws.com/bundles/Foo");
+    ASSERT_STREQ(sentBody.c_str(), "{\"Item1\":\"10\",\"Item2\":\"2\",\"Item3\":\"3\"}");
+
+    // each operation is notified, the operation with an unprocessed item fails
+    ASSERT_EQ(successCode1, Aws::Http::HttpResponseCode(201));
+    ASSERT_EQ(successCode2, Aws::Http::HttpResponseCode(201));
+    ASSERT_EQ(failureCode3, Aws::Http::HttpResponseCode(201));
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
+TEST_F(UserGameplayDataClientTestFixture, MakeMultipleRequests_SameItemAndBundleDelete_WithBackgroundThread_SupersededOperationsNotSent)
+{
+    // Arrange
+    using namespace ::testing;
+
+    std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    std::shared_ptr<Aws::Http::HttpResponse> successResponse = std::make_shared<FakeHttpResponse>();
+    successResponse->SetResponseCode(Aws::Http::HttpResponseCode(201));
+
+    std::vector<std::string> sentUris;
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .Times(2)
+        .WillRepeatedly([&](const std::shared_ptr<Aws::Http::HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface*, Aws::Utils::RateLimits::RateLimiterInterface*)
+            {
+                sentUris.push_back(ToStdString(request->GetURIString(false)));
+                return successResponse;
+            });
+
+    // Act
+    unsigned int retryIntervalSeconds = 1;
+    UserGameplayDataHttpClient client(mockHttpClient, authSetter, retryIntervalSeconds, retryLogic, MAX_QUEUE_SIZE, TestLogger::Log);
+    client.StartRetryBackgroundThread();
+
+    auto makeRequest = [&](UserGameplayDataOperationType type, const char* bundle, const char* item, const std::string& path)
+    {
+        std::shared_ptr<Aws::Http::HttpRequest> request = std::make_shared<FakeHttpRequest>(
+            Aws::Http::URI(ToAwsString("https://123.aws.com/" + path)), Aws::Http::HttpMethod::HTTP_POST);
+
+        return client.MakeRequest(type, true, bundle, item, request, Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT).ResultType;
+    };
+
+    std::vector<RequestResultType> resultTypes;
+    resultTypes.push_back(makeRequest(UserGameplayDataOperationType::Write, "Foo", "Item1", "Foo/Item1/First"));
+    resultTypes.push_back(makeRequest(UserGameplayDataOperationType::Write, "Foo", "Item1", "Foo/Item1/Second"));
+    resultTypes.push_back(makeRequest(UserGameplayDataOperationType::Write, "Bar", "", "Bar/Write"));
+    resultTypes.push_back(makeRequest(UserGameplayDataOperationType::Delete, "Bar", "", "Bar/Delete"));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+    client.StopRetryBackgroundThread();
+
+    // Assert
+    for (auto resultType : resultTypes)
+    {
+        ASSERT_EQ(resultType, RequestResultType::RequestEnqueued);
+    }
+
+    // the newest item write and the bundle delete are sent, the operations they supersede are not
+    ASSERT_EQ(sentUris.size(), 2);
+    ASSERT_STREQ(sentUris[0].c_str(), "https://123.aws.com/Foo/Item1/Second");
+    ASSERT_STREQ(sentUris[1].c_str(), "https://123.aws.com/Bar/Delete");
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
+TEST_F(UserGameplayDataClientTestFixture, MakeSingleRequest_ClientOffline_WithJitteredRetry_RetriedOnlyWhenDue)
+{
+    // Arrange
+    using namespace ::testing;
+
+    std::shared_ptr<Aws::Http::HttpRequest> request = std::make_shared<FakeHttpRequest>(
+        Aws::Http::URI("https://123.aws.com/foo"), Aws::Http::HttpMethod::HTTP_POST);
+
+    std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    std::shared_ptr<Aws::Http::HttpResponse> notMadeResponse = std::make_shared<FakeHttpResponse>();
+    notMadeResponse->SetResponseCode(Aws::Http::HttpResponseCode(-1));
+
+    // the first attempt and a single retry two seconds later, the pump ticks every second in between
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .Times(2)
+        .WillRepeatedly(Return(notMadeResponse));
+
+    // Act
+    std::shared_ptr<IRetryStrategy> jitteredRetryLogic = std::make_shared<DecorrelatedJitterStrategy>(std::chrono::milliseconds(2000), std::chrono::milliseconds(2000), TestLogger::Log);
+    UserGameplayDataHttpClient client(mockHttpClient, authSetter, 1, jitteredRetryLogic, MAX_QUEUE_SIZE, TestLogger::Log);
+    client.StartRetryBackgroundThread();
+
+    auto result = client.MakeRequest(UserGameplayDataOperationType::Write,
+        false, "Foo", "", request, Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3500));
+
+    client.StopRetryBackgroundThread();
+
+    // Assert
+    ASSERT_EQ(result.ResultType, RequestResultType::RequestAttemptedAndEnqueued);
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
+TEST_F(UserGameplayDataClientTestFixture, MakeSingleRequest_ClientOffline_WithOperationTimeout_FailedAfterDeadline)
+{
+    // Arrange
+    using namespace ::testing;
+
+    std::shared_ptr<Aws::Http::HttpRequest> request = std::make_shared<FakeHttpRequest>(
+        Aws::Http::URI("https://123.aws.com/foo"), Aws::Http::HttpMethod::HTTP_POST);
+
+    std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    std::shared_ptr<Aws::Http::HttpResponse> notMadeResponse = std::make_shared<FakeHttpResponse>();
+    notMadeResponse->SetResponseCode(Aws::Http::HttpResponseCode(-1));
+
+    // the first attempt and the retry in the first tick, the operation expires before the second tick
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .Times(2)
+        .WillRepeatedly(Return(notMadeResponse));
+
+    bool failureCalled = false;
+    ResponseCallback failureCallback = [&](CallbackContext, std::shared_ptr<Aws::Http::HttpResponse>)
+    {
+        failureCalled = true;
+    };
+
+    // Act
+    UserGameplayDataHttpClient client(mockHttpClient, authSetter, 1, retryLogic, MAX_QUEUE_SIZE, TestLogger::Log);
+    client.SetOperationTimeout(std::chrono::milliseconds(1500));
+    client.StartRetryBackgroundThread();
+
+    auto result = client.MakeRequest(UserGameplayDataOperationType::Write,
+        false, "Foo", "", request, Aws::Http::HttpResponseCode(201), OPERATION_ATTEMPTS_NO_LIMIT,
+        nullptr, nullptr, failureCallback);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(3500));
+
+    client.StopRetryBackgroundThread();
+
+    // Assert
+    ASSERT_EQ(result.ResultType, RequestResultType::RequestAttemptedAndEnqueued);
+    ASSERT_TRUE(failureCalled);
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
 TEST_F(UserGameplayDataClientTestFixture, MakeOperation_BinarySerializeDeserialize_OperationsMatch)
 {
     // Arrange
@@ -1,6 +1,11 @@
 // Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+// Standard Library
+#include <chrono>
+#include <future>
+#include <thread>
+
 // AWS SDK
 #include <aws/core/utils/StringUtils.h>
 
@@ -10,9 +15,11 @@
 #include "aws/gamekit/user-gameplay-data/exports.h"
 #include "aws/gamekit/user-gameplay-data/gamekit_user_gameplay_data_models.h"
 #include "aws/gamekit/authentication/exports.h"
+#include <aws/gamekit/core/internal/wrap_boost_filesystem.h>
 
 using namespace GameKit::Tests;
 using namespace ::testing;
+namespace fs = boost::filesystem;
 
 #define TEST_ID_TOKEN   "test_token123"
 #define TEST_AUTH_HEADER    "Bearer test_token123"
@@ -35,6 +42,11 @@ bool GameKitUserGameplayDataExportsTestFixture::ValidateItemKeysProxy(const char
     return UserGameplayData::UserGameplayData::validateBundleItemKeys(bundleItemKeys, numKeys, tempBuffer);
 }
 
+GameKit::UserGameplayDataClientSettings GameKitUserGameplayDataExportsTestFixture::GetClientSettingsProxy(void* handle)
+{
+    return static_cast<GameKit::UserGameplayData::UserGameplayData*>(handle)->m_clientSettings;
+}
+
 void GameKitUserGameplayDataExportsTestFixture::SetUp()
 {
     testStackInitializer.Initialize();
@@ -295,6 +307,86 @@ TEST_F(GameKitUserGameplayDataExportsTestFixture, TestGetBundle_RequestIsWellFor
     ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
 }
 
+TEST_F(GameKitUserGameplayDataExportsTestFixture, TestGetBundleBatch_MultiplePages_NextPageRequestedWhileDispatching)
+{
+    // arrange
+    char* bundle = "TestBundle";
+    void* instance = CreateDefault();
+    const std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    SetMocks(instance, mockHttpClient);
+
+    std::shared_ptr<Aws::Http::HttpResponse> firstPageResponse = std::make_shared<FakeHttpResponse>();
+    firstPageResponse->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+    static_cast<FakeHttpResponse*>(firstPageResponse.get())->SetResponseBody(
+        "{\"data\":{\"bundle_items\":[{\"bundle_item_key\":\"k1\",\"bundle_item_value\":\"v1\"},{\"bundle_item_key\":\"k2\",\"bundle_item_value\":\"v2\"}]},"
+        "\"paging\":{\"next_start_key\":\"k2\",\"paging_token\":\"token\"}}");
+
+    std::shared_ptr<Aws::Http::HttpResponse> secondPageResponse = std::make_shared<FakeHttpResponse>();
+    secondPageResponse->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+    static_cast<FakeHttpResponse*>(secondPageResponse.get())->SetResponseBody(
+        "{\"data\":{\"bundle_items\":[{\"bundle_item_key\":\"k3\",\"bundle_item_value\":\"v3\"}]}}");
+
+    std::promise<void> secondPageRequested;
+    std::shared_ptr<Aws::Http::HttpRequest> secondPageRequest;
+
+    auto signalAndReturnSecondPage = [&secondPageRequested, &secondPageRequest, &secondPageResponse](const std::shared_ptr<Aws::Http::HttpRequest>& request)
+    {
+        secondPageRequest = request;
+        secondPageRequested.set_value();
+
+        return secondPageResponse;
+    };
+
+    EXPECT_CALL(
+        *mockHttpClient,
+        MakeRequest(_, _, _)).
+        WillOnce(Return(firstPageResponse)).
+        WillOnce(WithArg<0>(signalAndReturnSecondPage));
+
+    // the first page is only released once the second page was requested
+    std::future<void> secondPageRequestedFuture = secondPageRequested.get_future();
+    bool isNextPagePrefetched = false;
+    std::vector<std::vector<std::pair<std::string, std::string>>> retrievedPages;
+    auto pageSetter = [&](const char* const* keys, const char* const* values, unsigned int count)
+    {
+        if (retrievedPages.empty())
+        {
+            isNextPagePrefetched = secondPageRequestedFuture.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+        }
+
+        std::vector<std::pair<std::string, std::string>> page;
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            page.emplace_back(keys[i], values[i]);
+        }
+        retrievedPages.push_back(page);
+    };
+    typedef LambdaDispatcher<decltype(pageSetter), void, const char* const*, const char* const*, unsigned int> PageSetter;
+
+    // act
+    const unsigned int result = GameKitGetUserGameplayDataBundleBatch(instance, bundle, &pageSetter, PageSetter::Dispatch);
+    GameKitUserGameplayDataInstanceRelease(instance);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, result);
+    ASSERT_TRUE(isNextPagePrefetched);
+    ASSERT_EQ(2, retrievedPages.size());
+    ASSERT_EQ(2, retrievedPages[0].size());
+    ASSERT_STREQ("k1", retrievedPages[0][0].first.c_str());
+    ASSERT_STREQ("v1", retrievedPages[0][0].second.c_str());
+    ASSERT_STREQ("k2", retrievedPages[0][1].first.c_str());
+    ASSERT_STREQ("v2", retrievedPages[0][1].second.c_str());
+    ASSERT_EQ(1, retrievedPages[1].size());
+    ASSERT_STREQ("k3", retrievedPages[1][0].first.c_str());
+    ASSERT_STREQ("v3", retrievedPages[1][0].second.c_str());
+
+    Aws::Http::QueryStringParameterCollection params = secondPageRequest->GetQueryStringParameters();
+    ASSERT_STREQ("k2", params.find("next_start_key")->second.c_str());
+    ASSERT_STREQ("token", params.find("paging_token")->second.c_str());
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
 TEST_F(GameKitUserGameplayDataExportsTestFixture, TestGetBundleItem_RequestIsWellFormed_Success)
 {
     // arrange
@@ -522,6 +614,321 @@ TEST_F(GameKitUserGameplayDataExportsTestFixture, TestDeleteBundleItems_RequestI
     ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
 }
 
+TEST_F(GameKitUserGameplayDataExportsTestFixture, TestGetBundle_ReadCacheEnabled_ServedFromCacheAndWrittenThrough)
+{
+    // arrange
+    char* bundle = "TestBundle";
+    void* instance = CreateDefault();
+    GameKit::UserGameplayDataClientSettings settings{};
+    settings.ReadCacheTtlSeconds = 60;
+    GameKitSetUserGameplayDataClientSettings(instance, settings);
+    const std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    SetMocks(instance, mockHttpClient);
+
+    std::shared_ptr<Aws::Http::HttpResponse> bundleResponse = std::make_shared<FakeHttpResponse>();
+    bundleResponse->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+    static_cast<FakeHttpResponse*>(bundleResponse.get())->SetResponseBody(
+        "{\"data\":{\"bundle_items\":[{\"bundle_item_key\":\"k1\",\"bundle_item_value\":\"v1\"},{\"bundle_item_key\":\"k2\",\"bundle_item_value\":\"v2\"}]}}");
+
+    std::shared_ptr<Aws::Http::HttpResponse> noContentResponse = std::make_shared<FakeHttpResponse>();
+    noContentResponse->SetResponseCode(Aws::Http::HttpResponseCode::NO_CONTENT);
+
+    std::shared_ptr<Aws::Http::HttpResponse> itemResponse = std::make_shared<FakeHttpResponse>();
+    itemResponse->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+    static_cast<FakeHttpResponse*>(itemResponse.get())->SetResponseBody("{\"data\":{\"bundle_item_value\":\"v2.1\"}}");
+
+    // bundle read, item update, bundle delete and item read after the delete, the other reads are served from the cache
+    EXPECT_CALL(
+        *mockHttpClient,
+        MakeRequest(_, _, _)).
+        WillOnce(Return(bundleResponse)).
+        WillOnce(Return(noContentResponse)).
+        WillOnce(Return(noContentResponse)).
+        WillOnce(Return(itemResponse));
+
+    std::map<std::string, std::string> retrievedPairs;
+    auto bundleSetter = [&retrievedPairs](const char* key, const char* value)
+    {
+        retrievedPairs[key] = value;
+    };
+    typedef LambdaDispatcher<decltype(bundleSetter), void, const char*, const char*> BundleSetter;
+
+    std::string retrievedValue;
+    auto valueSetter = [&retrievedValue](const char* value)
+    {
+        retrievedValue = value;
+    };
+    typedef LambdaDispatcher<decltype(valueSetter), void, const char*> ValueSetter;
+
+    GameKit::UserGameplayDataBundleItemValue bundleItemValue;
+    bundleItemValue.bundleName = "TestBundle";
+    bundleItemValue.bundleItemKey = "k1";
+    bundleItemValue.bundleItemValue = "v1.1";
+
+    GameKit::UserGameplayDataBundleItem firstItem;
+    firstItem.bundleName = "TestBundle";
+    firstItem.bundleItemKey = "k1";
+
+    GameKit::UserGameplayDataBundleItem secondItem;
+    secondItem.bundleName = "TestBundle";
+    secondItem.bundleItemKey = "k2";
+
+    // act
+    const unsigned int firstGetResult = GameKitGetUserGameplayDataBundle(instance, bundle, &bundleSetter, BundleSetter::Dispatch);
+    retrievedPairs.clear();
+    const unsigned int cachedGetResult = GameKitGetUserGameplayDataBundle(instance, bundle, &bundleSetter, BundleSetter::Dispatch);
+
+    const unsigned int updateResult = GameKitUpdateUserGameplayDataBundleItem(instance, bundleItemValue);
+    const unsigned int writtenThroughResult = GameKitGetUserGameplayDataBundleItem(instance, firstItem, &valueSetter, ValueSetter::Dispatch);
+    const std::string writtenThroughValue = retrievedValue;
+
+    const unsigned int deleteResult = GameKitDeleteUserGameplayDataBundle(instance, bundle);
+    const unsigned int afterDeleteResult = GameKitGetUserGameplayDataBundleItem(instance, secondItem, &valueSetter, ValueSetter::Dispatch);
+    GameKitUserGameplayDataInstanceRelease(instance);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, firstGetResult);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, cachedGetResult);
+    ASSERT_EQ(2, retrievedPairs.size());
+    ASSERT_STREQ("v1", retrievedPairs["k1"].c_str());
+    ASSERT_STREQ("v2", retrievedPairs["k2"].c_str());
+
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, updateResult);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, writtenThroughResult);
+    ASSERT_STREQ("v1.1", writtenThroughValue.c_str());
+
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, deleteResult);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, afterDeleteResult);
+    ASSERT_STREQ("v2.1", retrievedValue.c_str());
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
+TEST_F(GameKitUserGameplayDataExportsTestFixture, TestGetBundleItem_ReadCacheStale_RevalidatedThenServedWhileOffline)
+{
+    // arrange
+    GameKit::UserGameplayDataBundleItem bundleItem;
+    bundleItem.bundleName = "TestBundle";
+    bundleItem.bundleItemKey = "k1";
+    void* instance = CreateDefault();
+    GameKit::UserGameplayDataClientSettings settings{};
+    settings.ReadCacheTtlSeconds = 1;
+    GameKitSetUserGameplayDataClientSettings(instance, settings);
+    const std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    SetMocks(instance, mockHttpClient);
+
+    std::shared_ptr<Aws::Http::HttpResponse> successResponse = std::make_shared<FakeHttpResponse>();
+    successResponse->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+    successResponse->AddHeader("etag", "\"abc\"");
+    static_cast<FakeHttpResponse*>(successResponse.get())->SetResponseBody("{\"data\":{\"bundle_item_value\":\"123\"}}");
+
+    std::shared_ptr<Aws::Http::HttpResponse> notModifiedResponse = std::make_shared<FakeHttpResponse>();
+    notModifiedResponse->SetResponseCode(Aws::Http::HttpResponseCode::NOT_MODIFIED);
+
+    std::shared_ptr<Aws::Http::HttpResponse> notMadeResponse = std::make_shared<FakeHttpResponse>();
+    notMadeResponse->SetResponseCode(Aws::Http::HttpResponseCode::REQUEST_NOT_MADE);
+
+    std::shared_ptr<Aws::Http::HttpRequest> revalidationRequest;
+
+    auto saveRequestAndReturnResponse = [&revalidationRequest, &notModifiedResponse](const std::shared_ptr<Aws::Http::HttpRequest>& request)
+    {
+        revalidationRequest = request;
+
+        return notModifiedResponse;
+    };
+
+    EXPECT_CALL(
+        *mockHttpClient,
+        MakeRequest(_, _, _)).
+        WillOnce(Return(successResponse)).
+        WillOnce(WithArg<0>(saveRequestAndReturnResponse)).
+        WillOnce(Return(notMadeResponse));
+
+    std::vector<std::string> retrievedValues;
+    auto valueSetter = [&retrievedValues](const char* value)
+    {
+        retrievedValues.push_back(value);
+    };
+    typedef LambdaDispatcher<decltype(valueSetter), void, const char*> ValueSetter;
+
+    // act
+    const unsigned int firstResult = GameKitGetUserGameplayDataBundleItem(instance, bundleItem, &valueSetter, ValueSetter::Dispatch);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    const unsigned int revalidatedResult = GameKitGetUserGameplayDataBundleItem(instance, bundleItem, &valueSetter, ValueSetter::Dispatch);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    const unsigned int offlineResult = GameKitGetUserGameplayDataBundleItem(instance, bundleItem, &valueSetter, ValueSetter::Dispatch);
+    GameKitUserGameplayDataInstanceRelease(instance);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, firstResult);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, revalidatedResult);
+    ASSERT_EQ(GameKit::GAMEKIT_WARNING_USER_GAMEPLAY_DATA_CACHED_VALUE, offlineResult);
+    ASSERT_EQ(std::vector<std::string>({ "123", "123", "123" }), retrievedValues);
+    ASSERT_STREQ("\"abc\"", revalidationRequest->GetHeaderValue("if-none-match").c_str());
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
+TEST_F(GameKitUserGameplayDataExportsTestFixture, TestSyncBundle_PersistedVersion_OnlyChangesRequestedAndApplied)
+{
+    // arrange
+    char* bundle = "TestBundle";
+    const std::string syncStateFile = fs::temp_directory_path().append("TestBundleSyncState.bin").string();
+    fs::remove(syncStateFile);
+
+    std::shared_ptr<Aws::Http::HttpResponse> fullResponse = std::make_shared<FakeHttpResponse>();
+    fullResponse->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+    static_cast<FakeHttpResponse*>(fullResponse.get())->SetResponseBody(
+        "{\"data\":{\"bundle_version\":\"1\",\"bundle_items\":[{\"bundle_item_key\":\"k1\",\"bundle_item_value\":\"v1\"},{\"bundle_item_key\":\"k2\",\"bundle_item_value\":\"v2\"}]}}");
+
+    std::shared_ptr<Aws::Http::HttpResponse> deltaResponse = std::make_shared<FakeHttpResponse>();
+    deltaResponse->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+    static_cast<FakeHttpResponse*>(deltaResponse.get())->SetResponseBody(
+        "{\"data\":{\"bundle_version\":\"2\",\"bundle_items\":[{\"bundle_item_key\":\"k3\",\"bundle_item_value\":\"v3\"}],\"deleted_bundle_item_keys\":[\"k1\"]}}");
+
+    std::shared_ptr<Aws::Http::HttpRequest> deltaRequest;
+    auto saveRequestAndReturnDelta = [&deltaRequest, &deltaResponse](const std::shared_ptr<Aws::Http::HttpRequest>& request)
+    {
+        deltaRequest = request;
+
+        return deltaResponse;
+    };
+
+    std::vector<std::pair<std::string, std::string>> changes;
+    auto changeSetter = [&changes](const char* key, const char* value)
+    {
+        changes.emplace_back(key, value == nullptr ? "<deleted>" : value);
+    };
+    typedef LambdaDispatcher<decltype(changeSetter), void, const char*, const char*> ChangeSetter;
+
+    // act
+    // the first session syncs the whole bundle and keeps its version
+    void* firstSession = CreateDefault();
+    const std::shared_ptr<MockHttpClient> firstMockHttpClient = std::make_shared<MockHttpClient>();
+    SetMocks(firstSession, firstMockHttpClient);
+    EXPECT_CALL(*firstMockHttpClient, MakeRequest(_, _, _)).WillOnce(Return(fullResponse));
+
+    const unsigned int fullSyncResult = GameKitSyncUserGameplayDataBundle(firstSession, bundle, &changeSetter, ChangeSetter::Dispatch);
+    const std::vector<std::pair<std::string, std::string>> fullSyncChanges = changes;
+    const unsigned int persistResult = GameKitUserGameplayDataPersistBundleSyncState(firstSession, syncStateFile.c_str());
+    GameKitUserGameplayDataInstanceRelease(firstSession);
+
+    // the next session only receives what changed since
+    changes.clear();
+    void* secondSession = CreateDefault();
+    const std::shared_ptr<MockHttpClient> secondMockHttpClient = std::make_shared<MockHttpClient>();
+    SetMocks(secondSession, secondMockHttpClient);
+    EXPECT_CALL(*secondMockHttpClient, MakeRequest(_, _, _)).WillOnce(WithArg<0>(saveRequestAndReturnDelta));
+
+    const unsigned int loadResult = GameKitUserGameplayDataLoadBundleSyncState(secondSession, syncStateFile.c_str());
+    const unsigned int deltaSyncResult = GameKitSyncUserGameplayDataBundle(secondSession, bundle, &changeSetter, ChangeSetter::Dispatch);
+    GameKitUserGameplayDataInstanceRelease(secondSession);
+    fs::remove(syncStateFile);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, fullSyncResult);
+    ASSERT_EQ(2, fullSyncChanges.size());
+    ASSERT_STREQ("k1", fullSyncChanges[0].first.c_str());
+    ASSERT_STREQ("v1", fullSyncChanges[0].second.c_str());
+    ASSERT_STREQ("k2", fullSyncChanges[1].first.c_str());
+    ASSERT_STREQ("v2", fullSyncChanges[1].second.c_str());
+
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, persistResult);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, loadResult);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, deltaSyncResult);
+
+    Aws::Http::QueryStringParameterCollection params = deltaRequest->GetQueryStringParameters();
+    ASSERT_STREQ("1", params.find("since_version")->second.c_str());
+
+    ASSERT_EQ(2, changes.size());
+    ASSERT_STREQ("k3", changes[0].first.c_str());
+    ASSERT_STREQ("v3", changes[0].second.c_str());
+    ASSERT_STREQ("k1", changes[1].first.c_str());
+    ASSERT_STREQ("<deleted>", changes[1].second.c_str());
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(firstMockHttpClient.get()));
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(secondMockHttpClient.get()));
+}
+
+TEST_F(GameKitUserGameplayDataExportsTestFixture, TestSyncBundle_AnotherPlayer_MirrorDroppedAndSyncedFromScratch)
+{
+    // arrange
+    char* bundle = "TestBundle";
+
+    std::shared_ptr<Aws::Http::HttpResponse> firstPlayerResponse = std::make_shared<FakeHttpResponse>();
+    firstPlayerResponse->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+    static_cast<FakeHttpResponse*>(firstPlayerResponse.get())->SetResponseBody(
+        "{\"data\":{\"bundle_version\":\"1\",\"bundle_items\":[{\"bundle_item_key\":\"k1\",\"bundle_item_value\":\"v1\"}]}}");
+
+    std::shared_ptr<Aws::Http::HttpResponse> secondPlayerResponse = std::make_shared<FakeHttpResponse>();
+    secondPlayerResponse->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+    static_cast<FakeHttpResponse*>(secondPlayerResponse.get())->SetResponseBody(
+        "{\"data\":{\"bundle_version\":\"1\",\"bundle_items\":[{\"bundle_item_key\":\"k1\",\"bundle_item_value\":\"v1\"}]}}");
+
+    std::shared_ptr<Aws::Http::HttpRequest> secondPlayerRequest;
+    auto saveRequestAndReturnSecondPlayer = [&secondPlayerRequest, &secondPlayerResponse](const std::shared_ptr<Aws::Http::HttpRequest>& request)
+    {
+        secondPlayerRequest = request;
+
+        return secondPlayerResponse;
+    };
+
+    std::vector<std::pair<std::string, std::string>> changes;
+    auto changeSetter = [&changes](const char* key, const char* value)
+    {
+        changes.emplace_back(key, value == nullptr ? "<deleted>" : value);
+    };
+    typedef LambdaDispatcher<decltype(changeSetter), void, const char*, const char*> ChangeSetter;
+
+    void* instance = CreateDefault();
+    const std::shared_ptr<MockHttpClient> mockHttpClient = std::make_shared<MockHttpClient>();
+    SetMocks(instance, mockHttpClient);
+    EXPECT_CALL(*mockHttpClient, MakeRequest(_, _, _))
+        .WillOnce(Return(firstPlayerResponse))
+        .WillOnce(WithArg<0>(saveRequestAndReturnSecondPlayer));
+
+    // act
+    const unsigned int firstPlayerResult = GameKitSyncUserGameplayDataBundle(instance, bundle, &changeSetter, ChangeSetter::Dispatch);
+    changes.clear();
+    static_cast<Authentication::GameKitSessionManager*>(sessionManagerInstance)->SetToken(TokenType::IdToken, "another_player_token");
+    const unsigned int secondPlayerResult = GameKitSyncUserGameplayDataBundle(instance, bundle, &changeSetter, ChangeSetter::Dispatch);
+    GameKitUserGameplayDataInstanceRelease(instance);
+
+    // assert
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, firstPlayerResult);
+    ASSERT_EQ(GameKit::GAMEKIT_SUCCESS, secondPlayerResult);
+
+    Aws::Http::QueryStringParameterCollection params = secondPlayerRequest->GetQueryStringParameters();
+    ASSERT_EQ(params.end(), params.find("since_version"));
+
+    ASSERT_EQ(1, changes.size());
+    ASSERT_STREQ("k1", changes[0].first.c_str());
+    ASSERT_STREQ("v1", changes[0].second.c_str());
+
+    ASSERT_TRUE(Mock::VerifyAndClearExpectations(mockHttpClient.get()));
+}
+
+TEST_F(GameKitUserGameplayDataExportsTestFixture, TestSetClientSettings_OutOfRangeValues_Clamped)
+{
+    // arrange
+    void* instance = CreateDefault();
+    GameKit::UserGameplayDataClientSettings settings{};
+    settings.MaxConcurrentRequests = 100000;
+    settings.OperationTimeoutSeconds = 0xFFFFFFFF;
+    settings.ReadCacheTtlSeconds = 0xFFFFFFFF;
+
+    // act
+    GameKitSetUserGameplayDataClientSettings(instance, settings);
+
+    // assert
+    const GameKit::UserGameplayDataClientSettings applied = GetClientSettingsProxy(instance);
+    ASSERT_EQ(16, applied.MaxConcurrentRequests);
+    ASSERT_EQ(86400, applied.OperationTimeoutSeconds);
+    ASSERT_EQ(86400, applied.ReadCacheTtlSeconds);
+
+    GameKitUserGameplayDataInstanceRelease(instance);
+}
+
 TEST_F(GameKitUserGameplayDataExportsTestFixture, TestValidateItemKeys_ValidKeys_ReturnsTrue)
 {
     // arrange
@@ -25,6 +25,7 @@ namespace GameKit
             void SetMocks(void* handle, std::shared_ptr<Aws::Http::HttpClient> mockHttpClient);
 
             bool ValidateItemKeysProxy(const char* const* bundleItemKeys, int numKeys, std::stringstream& tempBuffer);
+            GameKit::UserGameplayDataClientSettings GetClientSettingsProxy(void* handle);
 
         public:
             GameKitUserGameplayDataExportsTestFixture() : sessionManagerInstance(nullptr) 